@@ -0,0 +1,34 @@
+/*------------------------------------------------------------------------
+名称：CityGame 基准测试
+说明：基准测试入口
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：结果格式为 [bench] 前缀的文本行
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "DebugLog.h"
+#include "Profiler.h"
+
+void Bench_RunAll()
+{
+    Profiler_Init();
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] CityGame begin");
+
+    Bench_WaitState();
+    Bench_Entities();
+    Bench_PathFind();
+    Bench_Text();
+    Bench_Blit();
+    Bench_Surface();
+    Bench_Mem();
+    Bench_Palette();
+    Bench_Camera();
+    Bench_Affine();
+    Bench_Mode7();
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] CityGame end");
+}
@@ -0,0 +1,72 @@
+/*------------------------------------------------------------------------
+名称：CityGame 基准测试
+说明：启动时运行的微基准集合，结果通过调试日志（mGBA）输出
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：仅在 make BENCH=1 时编译并在 main() 开头调用
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 运行全部基准测试（会关闭中断并改写部分硬件状态，需在游戏初始化前调用）。
+/// </summary>
+void Bench_RunAll();
+
+/// <summary>
+/// ROM 等待周期基准：各档位下顺序/随机读取与 Thumb 取指的周期数。
+/// </summary>
+void Bench_WaitState();
+
+/// <summary>
+/// 实体系统基准：100 个行人的每帧更新周期与预算比较。
+/// </summary>
+void Bench_Entities();
+
+/// <summary>
+/// 寻路基准：分时 A* 的每帧扩展数与周期、路径缓存命中率、流场构建与查询耗时。
+/// </summary>
+void Bench_PathFind();
+
+/// <summary>
+/// 文本基准：对话框整页文本在字形缓存冷/热时的绘制周期与命中率，长对话 UTF-8 解码吞吐，长对话排版与缓存命中开销。
+/// </summary>
+void Bench_Text();
+
+/// <summary>
+/// Mode 3 字形贴图基准：无效果 / 阴影 / 描边每帧可绘制字数，与 zhfont.a 逐像素绘制对比。
+/// </summary>
+void Bench_Blit();
+
+/// <summary>
+/// Mode 4 双缓冲文本画面基准：整页清除与菜单整页 / 增量重画（含翻页同步）的周期数。
+/// </summary>
+void Bench_Surface();
+
+/// <summary>
+/// 内存填充与复制基准：MemOps 各后端在 64B / 1KB / 16KB 下的字节/周期，与逐半字循环对比。
+/// </summary>
+void Bench_Mem();
+
+/// <summary>
+/// 调色板混合基准：整套 512 色混合一次的周期数（ROM Thumb 逐通道对照、IWRAM 查表、IWRAM 定点插值）与 DMA 提交。
+/// </summary>
+void Bench_Palette();
+
+/// <summary>
+/// 镜头基准：固定输入回放 1 分钟，锁定镜头与死区镜头的流式写入列 / 行数、滚动帧数与更新周期。
+/// </summary>
+void Bench_Camera();
+
+/// <summary>
+/// 仿射 OBJ 基准：32 个旋转 OBJ 每帧更新矩阵的周期数（各自角度 / 共享 / 整组 / 旋转加缩放），与一条扫描线比较。
+/// </summary>
+void Bench_Affine();
+
+/// <summary>
+/// 总览地图基准：Mode7_Build 生成 160 行透视参数的平均 / 最坏周期数与占一帧的比例。
+/// </summary>
+void Bench_Mode7();
@@ -0,0 +1,95 @@
+/*------------------------------------------------------------------------
+名称：仿射 OBJ 基准
+说明：32 个旋转 OBJ 每帧更新矩阵的周期数：各自角度（独占矩阵原地改写）、同一角度（逐个 Change 后共享一个矩阵）、
+      同一角度整组持有一个矩阵（每帧一次 Change）、旋转加缩放（需要求倒数），与一条扫描线（1232 周期）比较
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：只写影子 OAM，不提交；测量期间关闭中断，结束后重新 ObjAffine_Init
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../graphics/ObjAffine.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+#define BENCH_AFFINE_SPRITES 32
+#define BENCH_AFFINE_FRAMES 64
+#define BENCH_SCANLINE_CYCLES 1232
+
+enum BenchAffineMode
+{
+    BENCH_AFFINE_SPIN,      // 各自角度
+    BENCH_AFFINE_SHARED,    // 同一角度，逐个 Change
+    BENCH_AFFINE_GROUP,     // 同一角度，整组一个矩阵
+    BENCH_AFFINE_SQUASH,    // 各自角度 + 非 1 缩放
+};
+
+/// <summary>
+/// 运行若干帧，返回平均每帧周期数；inUse 输出最后一帧使用中的矩阵数。
+/// </summary>
+static u32 RunFrames(BenchAffineMode mode, int* inUse)
+{
+    int matrices[BENCH_AFFINE_SPRITES];
+    ObjAffine_Init();
+    for(int i = 0; i < BENCH_AFFINE_SPRITES; i++) {
+        matrices[i] = OBJAFFINE_NONE;
+    }
+
+    u32 total = 0;
+    for(int frame = 0; frame < BENCH_AFFINE_FRAMES; frame++) {
+        const u32 t0 = Profiler_Cycles();
+        if(mode == BENCH_AFFINE_GROUP) {
+            matrices[0] = ObjAffine_Change(matrices[0], (u8)(frame * 2), OBJAFFINE_SCALE_ONE, OBJAFFINE_SCALE_ONE);
+            for(int i = 0; i < BENCH_AFFINE_SPRITES; i++) {
+                ObjAffine_SetObj(&g_ShadowOam[i], matrices[0], true);
+            }
+            total += Profiler_Cycles() - t0;
+            continue;
+        }
+        for(int i = 0; i < BENCH_AFFINE_SPRITES; i++) {
+            const u8 angle = (u8)(frame * 2 + (mode == BENCH_AFFINE_SHARED ? 0 : i * 8));
+            s16 scaleX = OBJAFFINE_SCALE_ONE;
+            s16 scaleY = OBJAFFINE_SCALE_ONE;
+            if(mode == BENCH_AFFINE_SQUASH) {
+                scaleX = (s16)(OBJAFFINE_SCALE_ONE + ((frame + i) & 15) * 4);
+                scaleY = (s16)(OBJAFFINE_SCALE_ONE - ((frame + i) & 15) * 4);
+            }
+            matrices[i] = ObjAffine_Change(matrices[i], angle, scaleX, scaleY);
+            ObjAffine_SetObj(&g_ShadowOam[i], matrices[i], true);
+        }
+        total += Profiler_Cycles() - t0;
+    }
+
+    *inUse = ObjAffine_InUse();
+    return total / BENCH_AFFINE_FRAMES;
+}
+
+void Bench_Affine()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    int spinUsed;
+    int sharedUsed;
+    int groupUsed;
+    int squashUsed;
+    const u32 spin = RunFrames(BENCH_AFFINE_SPIN, &spinUsed);
+    const u32 shared = RunFrames(BENCH_AFFINE_SHARED, &sharedUsed);
+    const u32 group = RunFrames(BENCH_AFFINE_GROUP, &groupUsed);
+    const u32 squash = RunFrames(BENCH_AFFINE_SQUASH, &squashUsed);
+
+    ObjAffine_Init();
+    ObjShadow_HideFrom(0);
+
+    REG_IME = oldIme;
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] affine %d sprites cyc/frame: spin %lu (%d matrices), shared %lu (%d), group %lu (%d), spin+scale %lu (%d); scanline %d",
+                    BENCH_AFFINE_SPRITES,
+                    (unsigned long)spin, spinUsed, (unsigned long)shared, sharedUsed, (unsigned long)group, groupUsed,
+                    (unsigned long)squash, squashUsed, BENCH_SCANLINE_CYCLES);
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] affine %% of scanline: spin %lu, shared %lu, group %lu, spin+scale %lu",
+                    (unsigned long)(spin * 100 / BENCH_SCANLINE_CYCLES), (unsigned long)(shared * 100 / BENCH_SCANLINE_CYCLES),
+                    (unsigned long)(group * 100 / BENCH_SCANLINE_CYCLES), (unsigned long)(squash * 100 / BENCH_SCANLINE_CYCLES));
+}
@@ -0,0 +1,100 @@
+/*------------------------------------------------------------------------
+名称：Mode 3 字形贴图基准
+说明：ZhFontBlit 在无效果 / 阴影 / 描边三种模式下每字的周期数与每帧可绘制字数；
+      同一行 UTF-8 文本用 zhfont.a 的 ZhFont_DrawUtf8TextMode3 与 ZhBlit_Utf8 绘制的对比
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：直接写 0x06000000 处的 Mode 3 帧缓冲（此时 BG 图块尚未加载），在游戏初始化之前运行
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "ZhFont.h"
+#include "ZhFontBlit.h"
+#include "ZhFontCache.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+// 中英混排一行（约 20 字，字形缓存足够容纳）
+static const char* const g_BenchBlitLine = "小镇广场 Town Square 欢迎你！";
+
+#define BENCH_BLIT_MAX_GLYPHS 32
+#define BENCH_BLIT_ROWS 8
+
+/// <summary>
+/// 按 style 把 glyphs 逐行绘制 BENCH_BLIT_ROWS 遍，返回总周期数。
+/// </summary>
+static u32 TimeGlyphs(const ZhGlyph* glyphs, int count, const ZhBlitStyle* style)
+{
+    const u32 t0 = Profiler_Cycles();
+    for(int row = 0; row < BENCH_BLIT_ROWS; row++) {
+        int x = 4;
+        const int y = 4 + row * 18;
+        for(int i = 0; i < count; i++) {
+            x += ZhBlit_Glyph(&glyphs[i], x, y, style);
+        }
+    }
+    return Profiler_Cycles() - t0;
+}
+
+void Bench_Blit()
+{
+    static const char* const modeNames[3] = { "plain", "shadow", "outline" };
+
+    // 预先取出字形（复制出缓存，只测贴图本身）
+    ZhGlyph glyphs[BENCH_BLIT_MAX_GLYPHS];
+    int count = 0;
+    const char* p = g_BenchBlitLine;
+    while(count < BENCH_BLIT_MAX_GLYPHS) {
+        const ZhGlyph* glyph = ZhCache_NextUtf8(&p);
+        if(glyph == 0) {
+            break;
+        }
+        glyphs[count++] = *glyph;
+    }
+    const u32 total = (u32)count * BENCH_BLIT_ROWS;
+
+    ZhBlit_ResetClip();
+
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    u32 cycles[3];
+    for(int mode = 0; mode < 3; mode++) {
+        ZhBlitStyle style;
+        style.color = RGB5(31, 31, 31);
+        style.effectColor = RGB5(0, 0, 0);
+        style.effect = (u8)mode;
+        cycles[mode] = TimeGlyphs(glyphs, count, &style);
+    }
+
+    // 整行 UTF-8（含解码）：zhfont.a 逐像素绘制 vs ZhBlit_Utf8
+    u32 t0 = Profiler_Cycles();
+    for(int row = 0; row < BENCH_BLIT_ROWS; row++) {
+        ZhFont_DrawUtf8TextMode3(g_BenchBlitLine, 4, 4 + row * 18, RGB5(31, 31, 31));
+    }
+    const u32 lib = Profiler_Cycles() - t0;
+
+    ZhBlitStyle plain;
+    plain.color = RGB5(31, 31, 31);
+    plain.effectColor = 0;
+    plain.effect = ZHBLIT_PLAIN;
+    t0 = Profiler_Cycles();
+    for(int row = 0; row < BENCH_BLIT_ROWS; row++) {
+        ZhBlit_Utf8(g_BenchBlitLine, 4, 4 + row * 18, &plain);
+    }
+    const u32 utf8 = Profiler_Cycles() - t0;
+
+    REG_IME = oldIme;
+
+    for(int mode = 0; mode < 3; mode++) {
+        const u32 perGlyph = total ? cycles[mode] / total : 0;
+        DebugLog_Printf(DEBUGLOG_INFO, "[bench] blit %s: %lu glyphs %lu cyc, %lu cyc/glyph, %lu glyphs/frame",
+                        modeNames[mode], (unsigned long)total, (unsigned long)cycles[mode], (unsigned long)perGlyph,
+                        (unsigned long)(cycles[mode] ? (u32)(((u64)g_CyclesPerFrame * total) / cycles[mode]) : 0));
+    }
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] blit utf8 line x%lu: zhfont.a %lu cyc, ZhBlit_Utf8 %lu cyc (%lu.%02lux)",
+                    (unsigned long)BENCH_BLIT_ROWS, (unsigned long)lib, (unsigned long)utf8,
+                    (unsigned long)(utf8 ? lib / utf8 : 0), (unsigned long)(utf8 ? (lib % utf8) * 100 / utf8 : 0));
+}
@@ -0,0 +1,138 @@
+/*------------------------------------------------------------------------
+名称：镜头基准
+说明：回放一段 3600 帧（约 1 分钟）的固定输入，比较锁定镜头与默认镜头（死区 + 前瞻 + 平滑）
+      的流式写入列 / 行数、BG 滚动帧数与 Camera_Update 周期
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：只模拟角色位置（不做碰撞）、镜头与缓冲窗口，不写 VRAM；输入包含长距离行走、来回踱步、
+      对角抖动与停顿
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../generated_assets.h"
+#include "../world/Camera.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+/// <summary>
+/// 一段输入：方向保持 frames 帧，重复 repeat 次，每次重复方向取反（来回走动）。
+/// </summary>
+struct CameraReplayStep
+{
+    s8 dx;
+    s8 dy;
+    u16 frames;
+    u16 repeat;
+};
+
+static const CameraReplayStep g_CameraReplay[] =
+{
+    {  1,  0, 240,  1 },    // 向右走
+    { -1,  0,  12, 40 },    // 原地左右踱步
+    {  0,  1, 160,  1 },    // 向下走
+    {  0, -1,  10, 48 },    // 上下踱步
+    {  0,  0, 120,  1 },    // 停顿
+    { -1,  0, 300,  1 },    // 向左走
+    {  1,  1, 200,  1 },    // 斜向走
+    {  1,  0,  24, 30 },    // 在两点间巡走
+    {  0, -1, 200,  1 },    // 向上走
+    { -1, -1,   8, 60 },    // 对角抖动
+    {  0,  0, 220,  1 },    // 停顿
+};
+
+struct CameraReplayResult
+{
+    u32 columns;
+    u32 rows;
+    u32 scrollFrames;
+    u32 frames;
+    u32 updateCycles;
+};
+
+static void RunReplay(const CameraConfig* config, CameraReplayResult* result)
+{
+    const int mapPixelW = g_MapWidth * g_TileWidth;
+    const int mapPixelH = g_MapHeight * g_TileHeight;
+
+    int playerX = mapPixelW / 2;
+    int playerY = mapPixelH / 2;
+
+    Camera camera;
+    Camera_Init(&camera, config, mapPixelW, mapPixelH, playerX, playerY);
+    int camX = Camera_X(&camera);
+    int camY = Camera_Y(&camera);
+
+    // 初次填充不计入：窗口直接对准初始镜头
+    int bufX = 0;
+    int bufY = 0;
+    Camera_BufferTarget(camX, camY, bufX, bufY, &bufX, &bufY);
+
+    result->columns = 0;
+    result->rows = 0;
+    result->scrollFrames = 0;
+    result->frames = 0;
+    result->updateCycles = 0;
+
+    const int stepCount = (int)(sizeof(g_CameraReplay) / sizeof(g_CameraReplay[0]));
+    for(int s = 0; s < stepCount; s++) {
+        const CameraReplayStep* step = &g_CameraReplay[s];
+        for(int r = 0; r < step->repeat; r++) {
+            const int dx = (r & 1) ? -step->dx : step->dx;
+            const int dy = (r & 1) ? -step->dy : step->dy;
+            for(int f = 0; f < step->frames; f++) {
+                playerX += dx;
+                playerY += dy;
+                if(playerX < 0) playerX = 0;
+                if(playerY < 0) playerY = 0;
+                if(playerX > mapPixelW) playerX = mapPixelW;
+                if(playerY > mapPixelH) playerY = mapPixelH;
+
+                const u32 t0 = Profiler_Cycles();
+                Camera_Update(&camera, playerX, playerY, dx, dy);
+                result->updateCycles += Profiler_Cycles() - t0;
+
+                const int nextCamX = Camera_X(&camera);
+                const int nextCamY = Camera_Y(&camera);
+                if(nextCamX != camX || nextCamY != camY) {
+                    result->scrollFrames++;
+                }
+                camX = nextCamX;
+                camY = nextCamY;
+
+                int wantBufX;
+                int wantBufY;
+                Camera_BufferTarget(camX, camY, bufX, bufY, &wantBufX, &wantBufY);
+                result->columns += (u32)(wantBufX > bufX ? wantBufX - bufX : bufX - wantBufX);
+                result->rows += (u32)(wantBufY > bufY ? wantBufY - bufY : bufY - wantBufY);
+                bufX = wantBufX;
+                bufY = wantBufY;
+                result->frames++;
+            }
+        }
+    }
+}
+
+void Bench_Camera()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    CameraReplayResult locked;
+    CameraReplayResult smooth;
+    RunReplay(&g_CameraLocked, &locked);
+    RunReplay(&g_CameraDefault, &smooth);
+
+    REG_IME = oldIme;
+
+    // 每分钟 = 3600 帧
+    const u32 frames = locked.frames ? locked.frames : 1;
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] camera replay %lu frames, per minute: locked cols %lu rows %lu scroll frames %lu, update %lu cyc",
+                    (unsigned long)locked.frames,
+                    (unsigned long)(locked.columns * 3600 / frames), (unsigned long)(locked.rows * 3600 / frames),
+                    (unsigned long)(locked.scrollFrames * 3600 / frames), (unsigned long)(locked.updateCycles / frames));
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] camera per minute: deadzone cols %lu rows %lu scroll frames %lu, update %lu cyc",
+                    (unsigned long)(smooth.columns * 3600 / frames), (unsigned long)(smooth.rows * 3600 / frames),
+                    (unsigned long)(smooth.scrollFrames * 3600 / frames), (unsigned long)(smooth.updateCycles / frames));
+}
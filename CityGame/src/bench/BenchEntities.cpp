@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------
+名称：实体系统基准
+说明：100 个行人连续模拟 600 帧（含寻路与流场行走），统计每帧更新 + OAM 输出（含纵向排序）的周期数并与预算比较
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：相机固定在地图中心；寻路工作区与路径缓冲临时借用 g_MapArena，结束后释放；A* 推进不计入实体周期；不等待 VBlank，仅测 CPU 时间
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../generated_assets.h"
+#include "../memory/GameMemory.h"
+#include "../world/Entities.h"
+#include "../world/PathFind.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+void Bench_Entities()
+{
+    const int walkerCount = 100;
+    const int frames = 600;
+
+    const int mapPixelW = g_MapWidth * g_TileWidth;
+    const int mapPixelH = g_MapHeight * g_TileHeight;
+    const int playerX = mapPixelW / 2;
+    const int playerY = mapPixelH / 2;
+    const int camX = playerX - 120;
+    const int camY = playerY - 80;
+
+    const u32 mark = MemArena_Mark(&g_MapArena);
+    PathFind_Init(&g_MapArena);
+    Entities_Init(&g_MapArena);
+    const int spawned = Entities_SpawnWalkers(walkerCount, 0xBE7C);
+    Entities_SetGathering(g_MapWidth / 2, g_MapHeight / 2);
+
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    u32 total = 0;
+    u32 worst = 0;
+    u32 onscreenTotal = 0;
+
+    for(int f = 0; f < frames; f++) {
+        const u32 t0 = Profiler_Cycles();
+        Entities_Update(camX, camY, playerX, playerY);
+        const int nextSlot = Entities_WriteOam(1, camX, camY, 0, 32, &g_FrameArena);
+        const u32 cycles = Profiler_Cycles() - t0;
+
+        total += cycles;
+        if(cycles > worst) {
+            worst = cycles;
+        }
+        onscreenTotal += (u32)(nextSlot - 1);
+
+        PathFind_Update(64);
+        MemArena_Reset(&g_FrameArena);
+    }
+
+    REG_IME = oldIme;
+
+    const u32 avg = total / frames;
+    const u32 permille = (avg * 1000) / g_CyclesPerFrame;
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] entities %d walkers, %d frames: avg %lu max %lu cyc/frame (%lu.%lu%% of frame), avg on-screen %lu",
+                    spawned, frames, (unsigned long)avg, (unsigned long)worst,
+                    (unsigned long)(permille / 10), (unsigned long)(permille % 10), (unsigned long)(onscreenTotal / frames));
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] entities budget %lu cyc/frame: %s",
+                    (unsigned long)ENTITY_BUDGET_CYCLES_PER_FRAME, (worst <= ENTITY_BUDGET_CYCLES_PER_FRAME) ? "ok" : "OVER");
+
+    EntityRouteStats routes;
+    Entities_GetRouteStats(&routes);
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] entities routes: %lu requests, %lu gathers, %lu arrived, %lu abandoned",
+                    (unsigned long)routes.requests, (unsigned long)routes.gathers,
+                    (unsigned long)routes.arrived, (unsigned long)routes.abandoned);
+
+    Entities_Init(0);
+    MemArena_Release(&g_MapArena, mark);
+}
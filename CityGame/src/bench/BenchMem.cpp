@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------
+名称：内存填充与复制基准
+说明：MemOps 各后端（逐字 / DMA3 / CpuFastSet / stmia）与自动选择在不同大小下的吞吐（字节/周期），
+      以及替换前的逐半字循环作为对照
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：目标为 0x06000000 起的 BG 图块区（此时尚未加载），复制源为 ROM 中的 g_BgTiles；测量期间关闭中断
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../generated_assets.h"
+#include "MemOps.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+static const u32 g_BenchMemSizes[] = { 64, 1024, 16384 };
+
+#define BENCH_MEM_SIZE_COUNT ((int)(sizeof(g_BenchMemSizes) / sizeof(g_BenchMemSizes[0])))
+// 小尺寸重复多次，计时器读数开销可以忽略
+#define BENCH_MEM_REPEAT_BYTES 16384
+
+static volatile u16* const g_BenchMemVram = (volatile u16*)0x06000000;
+
+/// <summary>
+/// 字节/周期，两位小数写入 whole / frac。
+/// </summary>
+static void Throughput(u32 bytes, u32 cycles, u32* whole, u32* frac)
+{
+    if(cycles == 0) {
+        *whole = 0;
+        *frac = 0;
+        return;
+    }
+    const u32 x100 = (u32)(((u64)bytes * 100) / cycles);
+    *whole = x100 / 100;
+    *frac = x100 % 100;
+}
+
+/// <summary>
+/// 单次操作的周期数：backend 为 MEM_BACKEND_COUNT 时表示自动选择（VramFill / VramCopy），-1 表示逐半字循环。
+/// </summary>
+static u32 TimeOp(bool copy, int backend, u32 bytes)
+{
+    const u32 repeat = bytes < BENCH_MEM_REPEAT_BYTES ? BENCH_MEM_REPEAT_BYTES / bytes : 1;
+    const u16* src16 = (const u16*)g_BgTiles;
+    const u32 t0 = Profiler_Cycles();
+    for(u32 r = 0; r < repeat; r++) {
+        if(backend < 0) {
+            const u32 halfwords = bytes >> 1;
+            for(u32 i = 0; i < halfwords; i++) {
+                g_BenchMemVram[i] = copy ? src16[i] : (u16)0x1234;
+            }
+        } else if(backend == MEM_BACKEND_COUNT) {
+            if(copy) {
+                VramCopy((void*)g_BenchMemVram, g_BgTiles, bytes);
+            } else {
+                VramFill((void*)g_BenchMemVram, 0x1234, bytes);
+            }
+        } else if(copy) {
+            MemCopy32_With((MemBackend)backend, (void*)g_BenchMemVram, g_BgTiles, bytes);
+        } else {
+            MemFill32_With((MemBackend)backend, (void*)g_BenchMemVram, 0x12341234, bytes);
+        }
+    }
+    return (Profiler_Cycles() - t0) / repeat;
+}
+
+/// <summary>
+/// 对一个大小测量全部后端，输出一行。
+/// </summary>
+static void BenchOp(bool copy, u32 bytes)
+{
+    u32 whole[MEM_BACKEND_COUNT + 2];
+    u32 frac[MEM_BACKEND_COUNT + 2];
+    for(int b = -1; b <= MEM_BACKEND_COUNT; b++) {
+        Throughput(bytes, TimeOp(copy, b, bytes), &whole[b + 1], &frac[b + 1]);
+    }
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] mem %s %5luB B/cyc: half16 %lu.%02lu %s %lu.%02lu %s %lu.%02lu %s %lu.%02lu %s %lu.%02lu auto %lu.%02lu",
+                    copy ? "copy rom->vram" : "fill vram", (unsigned long)bytes,
+                    (unsigned long)whole[0], (unsigned long)frac[0],
+                    MemBackend_Name(MEM_BACKEND_CPU), (unsigned long)whole[1], (unsigned long)frac[1],
+                    MemBackend_Name(MEM_BACKEND_DMA), (unsigned long)whole[2], (unsigned long)frac[2],
+                    MemBackend_Name(MEM_BACKEND_FASTSET), (unsigned long)whole[3], (unsigned long)frac[3],
+                    MemBackend_Name(MEM_BACKEND_STMIA), (unsigned long)whole[4], (unsigned long)frac[4],
+                    (unsigned long)whole[5], (unsigned long)frac[5]);
+}
+
+void Bench_Mem()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    const u32 available = g_BgTileCount * 64;
+    for(int i = 0; i < BENCH_MEM_SIZE_COUNT; i++) {
+        BenchOp(false, g_BenchMemSizes[i]);
+    }
+    for(int i = 0; i < BENCH_MEM_SIZE_COUNT; i++) {
+        if(g_BenchMemSizes[i] <= available) {
+            BenchOp(true, g_BenchMemSizes[i]);
+        }
+    }
+
+    REG_IME = oldIme;
+}
@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------
+名称：总览地图基准
+说明：Mode7_Build 生成 160 行透视参数的周期数（不同高度与朝向），与一帧的周期预算比较
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：进入总览模式只为写入 VRAM 与生成倒数表，测完立即恢复显示设置；测量期间关闭中断，不提交 DMA
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../graphics/Mode7.h"
+#include "../graphics/Raster.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+#define BENCH_MODE7_REPEAT 16
+#define BENCH_FRAME_CYCLES 280896
+
+void Bench_Mode7()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    if(!Mode7_Enter()) {
+        REG_IME = oldIme;
+        DebugLog_Printf(DEBUGLOG_WARN, "[bench] mode7 skipped: BG tiles overlap overview VRAM");
+        return;
+    }
+
+    Mode7Camera camera;
+    camera.x = 152 << 8;
+    camera.y = 216 << 8;
+    camera.angle = 0;
+    camera.height = MODE7_HEIGHT_MIN;
+
+    u32 worst = 0;
+    u32 total = 0;
+    for(int r = 0; r < BENCH_MODE7_REPEAT; r++) {
+        camera.angle = (u8)(r * 16);
+        camera.height = MODE7_HEIGHT_MIN + (MODE7_HEIGHT_MAX - MODE7_HEIGHT_MIN) * r / (BENCH_MODE7_REPEAT - 1);
+        const u32 t0 = Profiler_Cycles();
+        Mode7_Build(&camera);
+        const u32 cycles = Profiler_Cycles() - t0;
+        total += cycles;
+        if(cycles > worst) {
+            worst = cycles;
+        }
+    }
+
+    Mode7_Leave();
+    Raster_Init();
+
+    REG_IME = oldIme;
+
+    const u32 average = total / BENCH_MODE7_REPEAT;
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] mode7 build %d lines: avg %lu cyc, worst %lu cyc (%lu cyc/line), %lu.%lu%% of frame %d",
+                    RASTER_LINES, (unsigned long)average, (unsigned long)worst, (unsigned long)(average / RASTER_LINES),
+                    (unsigned long)(worst * 100 / BENCH_FRAME_CYCLES), (unsigned long)((worst * 1000 / BENCH_FRAME_CYCLES) % 10),
+                    BENCH_FRAME_CYCLES);
+}
@@ -0,0 +1,93 @@
+/*------------------------------------------------------------------------
+名称：调色板混合基准
+说明：整套 512 色混合一次的周期数：ROM 中 Thumb 逐通道乘法（对照）、IWRAM 查表混合、IWRAM 打包定点插值，
+      以及 1KB DMA 提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：对照组的源色直接从 ROM 的 g_Palette 读取（两遍凑满 512 色）；测量期间关闭中断
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../generated_assets.h"
+#include "../graphics/PaletteFx.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+#define BENCH_PALETTE_REPEAT 8
+
+// 全局变量默认位于 IWRAM
+static u16 g_BenchPalSource[PALFX_COLORS] __attribute__((aligned(4)));
+static u16 g_BenchPalNight[PALFX_COLORS] __attribute__((aligned(4)));
+static u16 g_BenchPalOut[PALFX_COLORS] __attribute__((aligned(4)));
+
+/// <summary>
+/// 对照：逐色拆出 3 个通道，各自乘法插值（Thumb，ROM 取指，源在 ROM）。
+/// </summary>
+__attribute__((noinline)) static void BlendNaive(u16* dst, const u16* src, u32 count, u16 target, int weight)
+{
+    const int tr = target & 31;
+    const int tg = (target >> 5) & 31;
+    const int tb = (target >> 10) & 31;
+    for(u32 i = 0; i < count; i++) {
+        const u16 c = src[i & 255];
+        const int r = c & 31;
+        const int g = (c >> 5) & 31;
+        const int b = (c >> 10) & 31;
+        const int nr = r + (((tr - r) * weight) >> 5);
+        const int ng = g + (((tg - g) * weight) >> 5);
+        const int nb = b + (((tb - b) * weight) >> 5);
+        dst[i] = (u16)(nr | (ng << 5) | (nb << 10));
+    }
+}
+
+void Bench_Palette()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    for(int i = 0; i < PALFX_COLORS; i++) {
+        g_BenchPalSource[i] = g_Palette[i & 255];
+        g_BenchPalNight[i] = (u16)((g_Palette[i & 255] >> 1) & 0x3DEF);
+    }
+
+    const u16 target = RGB5(2, 3, 10);
+    u32 t0 = Profiler_Cycles();
+    for(int r = 0; r < BENCH_PALETTE_REPEAT; r++) {
+        BlendNaive(g_BenchPalOut, g_Palette, PALFX_COLORS, target, 4 + r);
+    }
+    const u32 naive = (Profiler_Cycles() - t0) / BENCH_PALETTE_REPEAT;
+
+    t0 = Profiler_Cycles();
+    for(int r = 0; r < BENCH_PALETTE_REPEAT; r++) {
+        PaletteFx_Blend(g_BenchPalOut, g_BenchPalSource, PALFX_COLORS, target, 4 + r);
+    }
+    const u32 table = (Profiler_Cycles() - t0) / BENCH_PALETTE_REPEAT;
+
+    t0 = Profiler_Cycles();
+    for(int r = 0; r < BENCH_PALETTE_REPEAT; r++) {
+        PaletteFx_Lerp(g_BenchPalOut, g_BenchPalSource, g_BenchPalNight, PALFX_COLORS, 4 + r);
+    }
+    const u32 lerp = (Profiler_Cycles() - t0) / BENCH_PALETTE_REPEAT;
+
+    // 提交：1KB 从 IWRAM 到调色板 RAM（写回原调色板，不影响后续初始化）
+    for(int i = 0; i < PALFX_COLORS; i++) {
+        g_BenchPalOut[i] = ((const u16*)0x05000000)[i];
+    }
+    t0 = Profiler_Cycles();
+    REG_DMA3CNT = 0;
+    REG_DMA3SAD = (u32)g_BenchPalOut;
+    REG_DMA3DAD = (u32)0x05000000;
+    REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | (sizeof(g_BenchPalOut) / 4));
+    const u32 commit = Profiler_Cycles() - t0;
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] palette 512 colours cyc: naive thumb/rom %lu, table iwram %lu (%lu.%02lux), lerp iwram %lu, dma commit %lu",
+                    (unsigned long)naive, (unsigned long)table,
+                    (unsigned long)(table ? naive / table : 0), (unsigned long)(table ? (naive * 100 / table) % 100 : 0),
+                    (unsigned long)lerp, (unsigned long)commit);
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] palette cyc/colour: naive %lu, table %lu, lerp %lu (frame budget 280896)",
+                    (unsigned long)(naive / PALFX_COLORS), (unsigned long)(table / PALFX_COLORS), (unsigned long)(lerp / PALFX_COLORS));
+
+    REG_IME = oldIme;
+}
@@ -0,0 +1,164 @@
+/*------------------------------------------------------------------------
+名称：寻路基准
+说明：模拟 NPC 成批请求前往几个公共目的地，统计每帧扩展数、单次扩展周期、缓存命中率与流场构建耗时
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：工作区临时借用 g_MapArena，结束后释放；不等待 VBlank，仅测 CPU 时间
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../generated_assets.h"
+#include "../memory/GameMemory.h"
+#include "../world/PathFind.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+static u32 g_BenchPathRandom = 1;
+
+static inline u32 BenchPathRandom()
+{
+    g_BenchPathRandom = g_BenchPathRandom * 1664525u + 1013904223u;
+    return g_BenchPathRandom >> 16;
+}
+
+/// <summary>
+/// 随机取一个可通行格子。
+/// </summary>
+static void RandomWalkableCell(int* outX, int* outY)
+{
+    for(;;) {
+        const int x = (int)((BenchPathRandom() * (u32)g_MapWidth) >> 16);
+        const int y = (int)((BenchPathRandom() * (u32)g_MapHeight) >> 16);
+        if(PathFind_IsWalkable(x, y)) {
+            *outX = x;
+            *outY = y;
+            return;
+        }
+    }
+}
+
+void Bench_PathFind()
+{
+    const int expansionsPerFrame = 64;
+    const int rounds = 16;
+    const int goalCount = 4;
+
+    const u32 mark = MemArena_Mark(&g_MapArena);
+    if(!PathFind_Init(&g_MapArena)) {
+        MemArena_Release(&g_MapArena, mark);
+        return;
+    }
+
+    g_BenchPathRandom = 0x9A7F;
+
+    int goalX[goalCount];
+    int goalY[goalCount];
+    for(int i = 0; i < goalCount; i++) {
+        RandomWalkableCell(&goalX[i], &goalY[i]);
+    }
+
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    // 每轮 PATH_MAX_REQUESTS 个 NPC 从随机位置出发去公共目的地，按帧预算推进直到全部完成
+    u32 searchCycles = 0;
+    u32 frames = 0;
+    u32 worstFrame = 0;
+    u32 found = 0;
+    u32 pathCells = 0;
+    for(int round = 0; round < rounds; round++) {
+        int tickets[PATH_MAX_REQUESTS];
+        for(int i = 0; i < PATH_MAX_REQUESTS; i++) {
+            int sx;
+            int sy;
+            RandomWalkableCell(&sx, &sy);
+            const int g = (int)((BenchPathRandom() * goalCount) >> 16);
+            tickets[i] = PathFind_Request(sx, sy, goalX[g], goalY[g]);
+        }
+
+        for(;;) {
+            bool pending = false;
+            for(int i = 0; i < PATH_MAX_REQUESTS; i++) {
+                if(PathFind_Poll(tickets[i]) == PATH_PENDING) {
+                    pending = true;
+                    break;
+                }
+            }
+            if(!pending) {
+                break;
+            }
+
+            const u32 t0 = Profiler_Cycles();
+            PathFind_Update(expansionsPerFrame);
+            const u32 cycles = Profiler_Cycles() - t0;
+            searchCycles += cycles;
+            if(cycles > worstFrame) {
+                worstFrame = cycles;
+            }
+            frames++;
+        }
+
+        for(int i = 0; i < PATH_MAX_REQUESTS; i++) {
+            u16 cells[PATH_MAX_LEN];
+            const int count = PathFind_TakePath(tickets[i], cells, PATH_MAX_LEN);
+            if(count > 0) {
+                found++;
+                pathCells += (u32)count;
+            } else {
+                PathFind_Release(tickets[i]);
+            }
+        }
+    }
+
+    PathStats stats;
+    PathFind_GetStats(&stats);
+
+    // 流场：为第一个目的地构建，再让每个可通行格子查一次方向
+    PathFind_ResetStats();
+    const int field = PathFind_AcquireFlowField(goalX[0], goalY[0]);
+    u32 flowCycles = 0;
+    u32 flowFrames = 0;
+    while(field >= 0 && !PathFind_IsFlowFieldReady(field)) {
+        const u32 t0 = Profiler_Cycles();
+        PathFind_Update(expansionsPerFrame);
+        flowCycles += Profiler_Cycles() - t0;
+        flowFrames++;
+    }
+
+    u32 lookups = 0;
+    const u32 t1 = Profiler_Cycles();
+    for(int y = 0; y < g_MapHeight; y++) {
+        for(int x = 0; x < g_MapWidth; x++) {
+            if(PathFind_FlowDir(field, x, y) != PATH_DIR_NONE) {
+                lookups++;
+            }
+        }
+    }
+    const u32 lookupCycles = Profiler_Cycles() - t1;
+    PathFind_ReleaseFlowField(field);
+
+    PathStats flowStats;
+    PathFind_GetStats(&flowStats);
+
+    REG_IME = oldIme;
+
+    const u32 requests = (u32)rounds * PATH_MAX_REQUESTS;
+    const u32 lookupsTotal = stats.cacheHits + stats.cacheMisses;
+    const u32 frameCount = frames ? frames : 1;
+    const u32 expansions = stats.expansions ? stats.expansions : 1;
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] pathfind %lu requests (%lu found, avg len %lu), budget %d exp/frame: %lu frames, avg %lu max %lu exp/frame",
+                    (unsigned long)requests, (unsigned long)found, (unsigned long)(found ? pathCells / found : 0),
+                    expansionsPerFrame, (unsigned long)frames,
+                    (unsigned long)(stats.expansions / frameCount), (unsigned long)stats.maxExpansionsPerFrame);
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] pathfind avg %lu max %lu cyc/frame, %lu cyc/expansion, cache hit %lu/%lu (%lu%%)",
+                    (unsigned long)(searchCycles / frameCount), (unsigned long)worstFrame,
+                    (unsigned long)(searchCycles / expansions), (unsigned long)stats.cacheHits, (unsigned long)lookupsTotal,
+                    (unsigned long)(lookupsTotal ? stats.cacheHits * 100 / lookupsTotal : 0));
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] flowfield %lu cells in %lu frames (%lu cyc), lookup %lu cyc x %lu",
+                    (unsigned long)flowStats.flowFieldCells, (unsigned long)flowFrames, (unsigned long)flowCycles,
+                    (unsigned long)(lookupCycles / (u32)(g_MapWidth * g_MapHeight)), (unsigned long)lookups);
+
+    MemArena_Release(&g_MapArena, mark);
+}
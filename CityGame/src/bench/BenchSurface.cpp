@@ -0,0 +1,114 @@
+/*------------------------------------------------------------------------
+名称：双缓冲文本画面基准
+说明：Mode 4 整页清除（ZhSurface_Clear 的 MemFill32 填充 vs 逐像素循环）；
+      菜单页整页重画 vs 只改一行的增量重画（含翻页同步）的周期数与同步字节数
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：临时切到 Mode 4 写 0x06000000 起的两页帧缓冲（此时 BG 图块尚未加载），结束后恢复 DISPCNT，在游戏初始化之前运行
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "ZhFontSurface.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+// 菜单页：标题 + 若干选项
+static const char* const g_BenchSurfaceMenu[] = {
+    "小镇菜单",
+    "继续游戏",
+    "物品 Items",
+    "地图 Map",
+    "设置 Options",
+    "存档并退出",
+};
+
+#define BENCH_SURFACE_LINES ((int)(sizeof(g_BenchSurfaceMenu) / sizeof(g_BenchSurfaceMenu[0])))
+#define BENCH_SURFACE_FRAMES 8
+
+/// <summary>
+/// 在后台页绘制整个菜单，selected 行用阴影高亮。
+/// </summary>
+static void DrawMenu(ZhSurface* surface, int selected)
+{
+    ZhBlitStyle style;
+    style.effectColor = 2;
+    for(int i = 0; i < BENCH_SURFACE_LINES; i++) {
+        style.color = 1;
+        style.effect = i == selected ? ZHBLIT_SHADOW : ZHBLIT_PLAIN;
+        ZhSurface_DrawUtf8(surface, g_BenchSurfaceMenu[i], 24, 8 + i * 20, &style);
+    }
+}
+
+/// <summary>
+/// 只重画 line 行：清除该行并重新绘制。
+/// </summary>
+static void DrawMenuLine(ZhSurface* surface, int line, int selected)
+{
+    ZhBlitStyle style;
+    style.color = 1;
+    style.effectColor = 2;
+    style.effect = line == selected ? ZHBLIT_SHADOW : ZHBLIT_PLAIN;
+    ZhSurface_ClearRect(surface, 16, 6 + line * 20, 200, 16, 0);
+    ZhSurface_DrawUtf8(surface, g_BenchSurfaceMenu[line], 24, 8 + line * 20, &style);
+}
+
+void Bench_Surface()
+{
+    const u16 oldDispcnt = REG_DISPCNT;
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    ZhSurface surface;
+    ZhSurface_Init(&surface, 4);
+
+    // 整页清除：MemFill32 vs 逐像素（每次写半字中的一个字节需读改写）
+    u32 t0 = Profiler_Cycles();
+    ZhSurface_Clear(&surface, 0);
+    const u32 fastClear = Profiler_Cycles() - t0;
+
+    vu16* back = (vu16*)ZhSurface_BackBuffer(&surface);
+    t0 = Profiler_Cycles();
+    for(int i = 0; i < surface.width * surface.height; i++) {
+        vu16* p = &back[i >> 1];
+        *p = (i & 1) ? (u16)(*p & 0x00FF) : (u16)(*p & 0xFF00);
+    }
+    const u32 pixelClear = Profiler_Cycles() - t0;
+
+    // 整页重画：每帧清除并重画全部选项，翻页同步整页
+    ZhSurface_Flip(&surface);
+    u32 synced = surface.bytesSynced;
+    t0 = Profiler_Cycles();
+    for(int frame = 0; frame < BENCH_SURFACE_FRAMES; frame++) {
+        ZhSurface_Clear(&surface, 0);
+        DrawMenu(&surface, frame % BENCH_SURFACE_LINES);
+        ZhSurface_Flip(&surface);
+    }
+    const u32 full = Profiler_Cycles() - t0;
+    const u32 fullBytes = surface.bytesSynced - synced;
+
+    // 增量：光标移动只重画旧、新两行
+    synced = surface.bytesSynced;
+    int selected = (BENCH_SURFACE_FRAMES - 1) % BENCH_SURFACE_LINES;
+    t0 = Profiler_Cycles();
+    for(int frame = 0; frame < BENCH_SURFACE_FRAMES; frame++) {
+        const int next = (selected + 1) % BENCH_SURFACE_LINES;
+        DrawMenuLine(&surface, selected, next);
+        DrawMenuLine(&surface, next, next);
+        selected = next;
+        ZhSurface_Flip(&surface);
+    }
+    const u32 incremental = Profiler_Cycles() - t0;
+    const u32 incrementalBytes = surface.bytesSynced - synced;
+
+    REG_DISPCNT = oldDispcnt;
+    REG_IME = oldIme;
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] surface mode4 clear: MemFill32 %lu cyc, per-pixel %lu cyc",
+                    (unsigned long)fastClear, (unsigned long)pixelClear);
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] surface menu x%lu: full redraw %lu cyc/frame (%lu B synced), incremental %lu cyc/frame (%lu B synced)",
+                    (unsigned long)BENCH_SURFACE_FRAMES,
+                    (unsigned long)(full / BENCH_SURFACE_FRAMES), (unsigned long)(fullBytes / BENCH_SURFACE_FRAMES),
+                    (unsigned long)(incremental / BENCH_SURFACE_FRAMES), (unsigned long)(incrementalBytes / BENCH_SURFACE_FRAMES));
+}
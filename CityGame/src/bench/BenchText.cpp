@@ -0,0 +1,256 @@
+/*------------------------------------------------------------------------
+名称：文本基准
+说明：ZhFont 图块后端绘制对话框文本：首帧（缓存冷）与之后各帧（缓存热）的周期数与字形缓存命中率；
+      长对话 UTF-8 解码吞吐：旧的有序数组二分映射、zhfont.a 的宽度计算（库内映射）与新的页表解码 / 免映射测宽对比；
+      长对话排版（折行分页）与缓存命中后取排版结果的周期数
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：画布借用对话框的 OBJ 图块区域，在游戏初始化之前运行，不影响显示；
+      旧映射的两个有序数组由页表在 g_MapArena 中临时重建（EWRAM，原先在 ROM，每次半字读取的等待周期相近）
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "ZhFont.h"
+#include "ZhFontCache.h"
+#include "ZhFontGlyph.h"
+#include "ZhFontLayout.h"
+#include "ZhFontTile.h"
+#include "../memory/GameMemory.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+static const char* const g_BenchTextLines[2] = {
+    "欢迎来到小镇！方向键四处走走看看吧。",
+    "按 A 键关闭或重新打开这段对话。",
+};
+
+// 长对话（无换行，约 150 字）
+static const char* const g_BenchTextLong =
+    "清晨的小镇还笼罩在薄雾里，面包店的烟囱已经冒出了白烟。老板娘一边擦着柜台一边对你说："
+    "听说北边的森林里最近出现了奇怪的光，镇长正在找人去看看。如果你愿意帮忙，就先去广场找他吧，"
+    "记得带上足够的干粮和水。路上小心，天黑之前一定要回来，晚上的森林可不太平。";
+
+// Unicode→GB2312 页表（ZhFontGbMap.cpp）
+extern const int g_zhfont_gbmap_count;
+extern const u8 g_zhfont_gbmap_page_index[];
+extern const u16 g_zhfont_gbmap_pages[];
+
+// 旧映射：按 Unicode 升序的两个平行数组
+static u16* g_BenchOldUnicode = 0;
+static u16* g_BenchOldGb2312 = 0;
+
+/// <summary>
+/// 按页表顺序（即码点升序）展开出旧映射的有序数组。
+/// </summary>
+static bool BuildOldMap()
+{
+    g_BenchOldUnicode = (u16*)MemArena_Alloc(&g_MapArena, (u32)g_zhfont_gbmap_count * 2);
+    g_BenchOldGb2312 = (u16*)MemArena_Alloc(&g_MapArena, (u32)g_zhfont_gbmap_count * 2);
+    if(!g_BenchOldUnicode || !g_BenchOldGb2312) {
+        return false;
+    }
+    int n = 0;
+    for(u32 hi = 0; hi < 256; hi++) {
+        const u32 page = g_zhfont_gbmap_page_index[hi];
+        if(page == 0xFF) {
+            continue;
+        }
+        for(u32 lo = 0; lo < 256 && n < g_zhfont_gbmap_count; lo++) {
+            const u16 gb = g_zhfont_gbmap_pages[(page << 8) | lo];
+            if(gb != 0) {
+                g_BenchOldUnicode[n] = (u16)((hi << 8) | lo);
+                g_BenchOldGb2312[n] = gb;
+                n++;
+            }
+        }
+    }
+    return n == g_zhfont_gbmap_count;
+}
+
+/// <summary>
+/// 旧的 ZhFont_UnicodeToGb2312：在有序数组中二分查找。
+/// </summary>
+static u16 OldUnicodeToGb2312(u32 codepoint)
+{
+    if(codepoint > 0xFFFF) {
+        return 0;
+    }
+
+    int lo = 0;
+    int hi = g_zhfont_gbmap_count - 1;
+    while(lo <= hi) {
+        const int mid = (lo + hi) >> 1;
+        const u32 key = g_BenchOldUnicode[mid];
+        if(key == codepoint) {
+            return g_BenchOldGb2312[mid];
+        }
+        if(key < codepoint) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return 0;
+}
+
+/// <summary>
+/// 周期数换算为每秒字符数（CPU 16.78MHz）。
+/// </summary>
+static u32 CharsPerSecond(u32 chars, u32 cycles)
+{
+    return cycles ? (u32)(((u64)chars << 24) / cycles) : 0;
+}
+
+static void BenchDecode()
+{
+    const int repeats = 16;
+
+    const char* p = g_BenchTextLong;
+    u32 chars = 0;
+    while(ZhFont_NextUtf8Codepoint(&p) != 0) {
+        chars++;
+    }
+    chars *= repeats;
+
+    const u32 mark = MemArena_Mark(&g_MapArena);
+    if(!BuildOldMap()) {
+        MemArena_Release(&g_MapArena, mark);
+        DebugLog_Printf(DEBUGLOG_WARN, "[bench] utf8: cannot rebuild the old sorted map, skipped");
+        return;
+    }
+
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    // 旧：逐字解码码点 + 有序数组二分映射 + 点阵定位（与下面的页表解码做同样的事）
+    volatile int sink = 0;
+    u32 t0 = Profiler_Cycles();
+    for(int i = 0; i < repeats; i++) {
+        const char* s = g_BenchTextLong;
+        ZhGlyphRef ref;
+        for(;;) {
+            const u32 cp = ZhFont_NextUtf8Codepoint(&s);
+            if(cp == 0) {
+                break;
+            }
+            u16 code = (u16)cp;
+            if(cp >= 0x80) {
+                const u16 gb = OldUnicodeToGb2312(cp);
+                code = gb ? gb : ZHFONT_CODE_MISSING;
+            }
+            ZhFont_GetGlyphRef(code, &ref);
+            sink += ref.advance;
+        }
+    }
+    const u32 oldDecode = Profiler_Cycles() - t0;
+
+    // zhfont.a 的宽度计算（逐字查库内映射表）
+    t0 = Profiler_Cycles();
+    for(int i = 0; i < repeats; i++) {
+        sink += ZhFont_GetUtf8TextWidth12(g_BenchTextLong);
+    }
+    const u32 libWidth = Profiler_Cycles() - t0;
+
+    // 新：免映射测宽
+    t0 = Profiler_Cycles();
+    for(int i = 0; i < repeats; i++) {
+        sink += ZhFont_MeasureUtf8(g_BenchTextLong);
+    }
+    const u32 measure = Profiler_Cycles() - t0;
+
+    // 新：页表映射 + 点阵定位（绘制前的完整解码）
+    t0 = Profiler_Cycles();
+    for(int i = 0; i < repeats; i++) {
+        const char* s = g_BenchTextLong;
+        ZhGlyphRef ref;
+        while(ZhFont_DecodeUtf8(&s, &ref) != 0) {
+            sink += ref.advance;
+        }
+    }
+    const u32 decode = Profiler_Cycles() - t0;
+
+    REG_IME = oldIme;
+    MemArena_Release(&g_MapArena, mark);
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] utf8 %lu chars: old decode+bsearch %lu cyc (%lu ch/s), page-table decode+map %lu cyc (%lu ch/s)",
+                    (unsigned long)chars,
+                    (unsigned long)oldDecode, (unsigned long)CharsPerSecond(chars, oldDecode),
+                    (unsigned long)decode, (unsigned long)CharsPerSecond(chars, decode));
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] utf8 width: zhfont.a %lu cyc (%lu ch/s), measure %lu cyc (%lu ch/s)",
+                    (unsigned long)libWidth, (unsigned long)CharsPerSecond(chars, libWidth),
+                    (unsigned long)measure, (unsigned long)CharsPerSecond(chars, measure));
+}
+
+static void BenchLayout()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    ZhLayout_Flush();
+    u32 t0 = Profiler_Cycles();
+    const ZhLayout* layout = ZhLayout_Get(g_BenchTextLong, 224, 2);
+    const u32 build = Profiler_Cycles() - t0;
+
+    // 逐页翻看：每页都取一次排版结果（命中缓存）
+    t0 = Profiler_Cycles();
+    for(int page = 0; page < layout->pageCount; page++) {
+        ZhLayout_Get(g_BenchTextLong, 224, 2);
+    }
+    const u32 hits = Profiler_Cycles() - t0;
+
+    REG_IME = oldIme;
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] layout %lu lines / %lu pages: build %lu cyc, cached get avg %lu cyc",
+                    (unsigned long)layout->lineCount, (unsigned long)layout->pageCount,
+                    (unsigned long)build, (unsigned long)(layout->pageCount ? hits / layout->pageCount : 0));
+}
+
+static u32 DrawPage(ZhTileCanvas* canvas)
+{
+    const u32 t0 = Profiler_Cycles();
+    ZhTile_DrawUtf8(canvas, g_BenchTextLines[0], 8, 3);
+    ZhTile_DrawUtf8(canvas, g_BenchTextLines[1], 8, 17);
+    return Profiler_Cycles() - t0;
+}
+
+void Bench_Text()
+{
+    const int frames = 60;
+
+    ZhTileCanvas canvas;
+    ZhTile_Init(&canvas, 0x06010000, 64, 32, 4, ZHTILE_LAYOUT_OBJ64X32);
+    ZhTile_SetColors(&canvas, 1, 2);
+    ZhTile_Clear(&canvas);
+
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    ZhCache_Flush();
+    ZhCache_ResetStats();
+
+    canvas.bytesWritten = 0;
+    const u32 cold = DrawPage(&canvas);
+    const u32 pageBytes = canvas.bytesWritten;
+
+    u32 warmTotal = 0;
+    for(int f = 0; f < frames; f++) {
+        warmTotal += DrawPage(&canvas);
+    }
+
+    REG_IME = oldIme;
+
+    ZhCacheStats stats;
+    ZhCache_GetStats(&stats);
+    const u32 lookups = stats.hits + stats.misses;
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] text page cold %lu cyc, warm avg %lu cyc (%lu frames), %lu B VRAM/page",
+                    (unsigned long)cold, (unsigned long)(warmTotal / frames), (unsigned long)frames, (unsigned long)pageBytes);
+    DebugLog_Printf(DEBUGLOG_INFO, "[bench] glyph cache hit %lu/%lu (%lu%%), evictions %lu",
+                    (unsigned long)stats.hits, (unsigned long)lookups,
+                    (unsigned long)(lookups ? stats.hits * 100 / lookups : 0), (unsigned long)stats.evictions);
+
+    BenchDecode();
+    BenchLayout();
+}
@@ -0,0 +1,167 @@
+/*------------------------------------------------------------------------
+名称：ROM 等待周期基准
+说明：在每个 WAITCNT 档位下测量本工程实际的 ROM 读取模式与 Thumb 取指开销
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：测量期间关闭中断；TURBO 档位校验失败时跳过
+------------------------------------------------------------------------*/
+
+#include "Bench.h"
+
+#include "../generated_assets.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+#include "WaitState.h"
+
+static volatile u32 g_BenchSink = 0;
+
+/// <summary>
+/// 顺序 16 位读取 g_BgTiles（与 LoadBgTiles 的访问模式一致）。
+/// </summary>
+static u32 ReadBgTilesSequential16(u32* bytes)
+{
+    const int halfwords = (int)(g_BgTileCount * 64) / 2;
+    const u16* src = (const u16*)g_BgTiles;
+    u32 acc = 0;
+    for(int i = 0; i < halfwords; i++) {
+        acc += src[i];
+    }
+    *bytes = (u32)halfwords * 2;
+    return acc;
+}
+
+/// <summary>
+/// 顺序 32 位读取 BGM PCM（与 DMA1 喂 FIFO 的访问宽度一致），取前 16KB。
+/// </summary>
+static u32 ReadPcmSequential32(u32* bytes)
+{
+    u32 size = (u32)(_binary_obj_morningmix_pcm_end - _binary_obj_morningmix_pcm_start);
+    if(size > 16 * 1024) {
+        size = 16 * 1024;
+    }
+    const int words = (int)(size >> 2);
+    const u32* src = (const u32*)_binary_obj_morningmix_pcm_start;
+    u32 acc = 0;
+    for(int i = 0; i < words; i++) {
+        acc ^= src[i];
+    }
+    *bytes = (u32)words * 4;
+    return acc;
+}
+
+/// <summary>
+/// 顺序 8 位读取全部区块的 LZ77 数据（与 BIOS 解压读取源数据的宽度一致），不足 4KB 时重复读取。
+/// </summary>
+static u32 ReadChunkData8(u32* bytes)
+{
+    const u32 size = g_WorldChunkDataBytes > 0 ? g_WorldChunkDataBytes : 1;
+    u32 acc = 0;
+    u32 reads = 0;
+    while(reads < 4096) {
+        for(u32 i = 0; i < size; i++) {
+            acc += g_WorldChunkData[i];
+        }
+        reads += size;
+    }
+    *bytes = reads;
+    return acc;
+}
+
+/// <summary>
+/// 伪随机 16 位读取 g_BgTiles（每次都是非连续的 N 周期访问）。
+/// </summary>
+static u32 ReadBgTilesRandom16(u32* bytes)
+{
+    const u32 halfwords = (g_BgTileCount * 64) / 2;
+    const u16* src = (const u16*)g_BgTiles;
+    u32 seed = 0x1234;
+    u32 acc = 0;
+    for(int i = 0; i < 8192; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        acc += src[(seed >> 16) % halfwords];
+    }
+    *bytes = 8192 * 2;
+    return acc;
+}
+
+/// <summary>
+/// 纯计算的 Thumb 循环（位于 ROM，无数据访问），只测取指开销。
+/// </summary>
+__attribute__((noinline)) static u32 RunThumbFetch(u32* bytes)
+{
+    u32 x = 0x9E3779B9;
+    for(int i = 0; i < 8192; i++) {
+        x = x * 1664525u + 1013904223u;
+        x ^= x >> 13;
+        x += (x << 3);
+    }
+    *bytes = 0;
+    return x;
+}
+
+typedef u32 (*BenchPatternFn)(u32* bytes);
+
+struct BenchPattern
+{
+    const char* name;
+    BenchPatternFn fn;
+};
+
+static const BenchPattern g_BenchPatterns[] = {
+    { "bgtiles seq16", ReadBgTilesSequential16 },
+    { "pcm seq32", ReadPcmSequential32 },
+    { "chunk lz77 seq8", ReadChunkData8 },
+    { "bgtiles rand16", ReadBgTilesRandom16 },
+    { "thumb fetch", RunThumbFetch },
+};
+
+static const int g_BenchPatternCount = (int)(sizeof(g_BenchPatterns) / sizeof(g_BenchPatterns[0]));
+
+void Bench_WaitState()
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    const WaitStateProfile saved = WaitState_Current();
+
+    u32 cycles[g_BenchPatternCount][WAITSTATE_COUNT];
+    u32 bytes[g_BenchPatternCount];
+    bool valid[WAITSTATE_COUNT];
+
+    for(int p = 0; p < WAITSTATE_COUNT; p++) {
+        const WaitStateProfile profile = (WaitStateProfile)p;
+        valid[p] = (WaitState_Init(profile, g_BgTiles, 1024) == profile);
+        if(!valid[p]) {
+            continue;
+        }
+
+        for(int i = 0; i < g_BenchPatternCount; i++) {
+            const u32 t0 = Profiler_Cycles();
+            g_BenchSink = g_BenchPatterns[i].fn(&bytes[i]);
+            cycles[i][p] = Profiler_Cycles() - t0;
+        }
+    }
+
+    WaitState_Apply(saved);
+    REG_IME = oldIme;
+
+    for(int i = 0; i < g_BenchPatternCount; i++) {
+        const u32 base = cycles[i][WAITSTATE_BIOS];
+        for(int p = 0; p < WAITSTATE_COUNT; p++) {
+            const char* profileName = WaitState_GetName((WaitStateProfile)p);
+            if(!valid[p]) {
+                DebugLog_Printf(DEBUGLOG_INFO, "[bench] waitcnt %-14s %-13s skipped (verify failed)", g_BenchPatterns[i].name, profileName);
+                continue;
+            }
+
+            const u32 c = cycles[i][p];
+            // 相对 BIOS 档位的加速比（x100）与吞吐量（KB/s，16.78MHz）
+            const u32 speedup = (c != 0) ? (u32)(((unsigned long long)base * 100) / c) : 0;
+            const u32 kbps = (c != 0) ? (u32)(((unsigned long long)bytes[i] * 16777216ull) / ((unsigned long long)c * 1024)) : 0;
+            DebugLog_Printf(DEBUGLOG_INFO, "[bench] waitcnt %-14s %-13s %8lu cyc  x%lu.%02lu  %6lu KB/s",
+                            g_BenchPatterns[i].name, profileName, (unsigned long)c,
+                            (unsigned long)(speedup / 100), (unsigned long)(speedup % 100), (unsigned long)kbps);
+        }
+    }
+}
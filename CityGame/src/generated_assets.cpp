@@ -14,12 +14,12 @@ extern const int g_TileHeight = 16;
 
 extern const unsigned int g_UsedTileCount = 150;
 
-extern const unsigned int g_BgTileCount = 601;
+extern const unsigned int g_BgTileCount = 409;
 
 extern const unsigned short g_Palette[] __attribute__((aligned(4))) = {
     0x7C1F, 0x7BDE, 0x77BD, 0x739C, 0x739C, 0x6F7B, 0x7377, 0x6739, 0x7B35, 0x7355, 0x7F60, 0x6F35,
-    0x633B, 0x631D, 0x5F18, 0x6318, 0x5AF7, 0x7F21, 0x72AF, 0x6AD1, 0x6EB1, 0x6690, 0x62D3, 0x5EF7,
-    0x5A91, 0x56D6, 0x56B5, 0x475B, 0x4B2C, 0x3319, 0x3B12, 0x3EC8, 0x4706, 0x46E6, 0x42E5, 0x3EA5,
+    0x633B, 0x631D, 0x5F18, 0x6318, 0x5AF7, 0x7F21, 0x4B2C, 0x72AF, 0x6AD1, 0x6EB1, 0x6690, 0x62D3,
+    0x5EF7, 0x5A91, 0x56D6, 0x56B5, 0x475B, 0x3319, 0x3B12, 0x3EC8, 0x4706, 0x46E6, 0x42E5, 0x3EA5,
     0x2ED0, 0x22DB, 0x1AB4, 0x26CE, 0x26AD, 0x6A6D, 0x622B, 0x5A4E, 0x6260, 0x5E2B, 0x5E2B, 0x5E0A,
     0x5A0A, 0x4E78, 0x4A52, 0x4E4F, 0x4A52, 0x4210, 0x4210, 0x4A0E, 0x4252, 0x3A85, 0x3226, 0x4212,
     0x3246, 0x226C, 0x6E08, 0x59E9, 0x55EA, 0x51EA, 0x51C8, 0x4DC9, 0x4587, 0x6184, 0x5964, 0x5144,
@@ -41,462 +41,274 @@ extern const unsigned short g_Palette[] __attribute__((aligned(4))) = {
     0x0000, 0x0000, 0x0000, 0x0000,
 };
 
-extern const unsigned short g_Layer0[] __attribute__((aligned(4))) = {
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0006, 0x0006, 0x0006, 0x0006, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0006, 0x0006, 0x0006, 0x0006,
-    0x0006, 0x0006, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0006, 0x0006, 0x0006, 0x0006, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0003, 0x0004,
-    0x0004, 0x0004, 0x0004, 0x0005, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003C, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0003, 0x0004, 0x0004, 0x0004, 0x0074, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003C, 0x003D, 0x003D, 0x003D,
-    0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003C, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003C, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
-    0x003D, 0x003E, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0003, 0x0074, 0x003D,
-    0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003C, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003A, 0x0076, 0x0076, 0x0077, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003C, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D,
-    0x003E, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003C,
-    0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003D, 0x003E, 0x003F, 0x003F, 0x0006, 0x0006, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x0075, 0x0076, 0x0076, 0x003B, 0x003D, 0x003D, 0x003A, 0x0077, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003C, 0x003D,
-    0x003D, 0x003E, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x0075, 0x0076, 0x0076, 0x0077, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
-    0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F, 0x003F,
+extern const int g_WorldChunksW = 3;
+extern const int g_WorldChunksH = 3;
+
+extern const unsigned int g_WorldChunkCount = 24;
+
+extern const unsigned int g_WorldChunkDataBytes = 2308;
+
+extern const unsigned short g_WorldChunkIndex[] __attribute__((aligned(4))) = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0002, 0x0005, 0x0005, 0x0006, 0xFFFF, 0x0007, 0x0008, 0xFFFF, 0xFFFF, 0x0009, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0xFFFF, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016,
+    0x0017, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
-extern const unsigned short g_Layer1[] __attribute__((aligned(4))) = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0209, 0x020A, 0x020A, 0x020B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0242, 0x0243, 0x0243, 0x0244, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0209,
-    0x020A, 0x0243, 0x0243, 0x0243, 0x0240, 0x020B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399,
-    0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0209, 0x020A, 0x0241, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0244, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0242, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243, 0x0243,
-    0x0243, 0x027C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x027B,
-    0x027C, 0x0208, 0x0243, 0x0243, 0x0243, 0x0207, 0x027D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398,
-    0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x027B, 0x027C, 0x027C, 0x027C, 0x027D, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399,
-    0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398, 0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0398,
-    0x0399, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0360, 0x0397, 0x0000, 0x0399, 0x0399, 0x0399, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D2, 0x035E, 0x0399, 0x0399, 0x0399, 0x0399,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x03D1, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+extern const unsigned int g_WorldChunkOffset[] __attribute__((aligned(4))) = {
+    0x00000000, 0x00000048, 0x000000AC, 0x000000F4, 0x0000013C, 0x0000019C, 0x000001E0, 0x00000228,
+    0x00000290, 0x000002E4, 0x0000032C, 0x000003AC, 0x00000448, 0x000004A8, 0x0000054C, 0x000005F4,
+    0x00000648, 0x00000690, 0x000006D8, 0x0000072C, 0x0000077C, 0x000007DC, 0x00000844, 0x000008B4,
 };
 
-extern const unsigned short g_Layer2[] __attribute__((aligned(4))) = {
-    0x0000, 0x024B, 0x0000, 0x024B, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x028A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0252, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0000, 0x0000, 0x0284,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0269, 0x026A, 0x0000, 0x0000, 0x028B,
-    0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0248, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x024B, 0x0284, 0x024B,
-    0x0284, 0x024B, 0x0284, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0219, 0x0000, 0x0000,
-    0x0000, 0x02A2, 0x02A3, 0x0000, 0x0000, 0x0000, 0x0219, 0x0000, 0x0199, 0x0000, 0x0000, 0x0281, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0000, 0x024B, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x02E0, 0x02E1, 0x0000, 0x0269, 0x026A, 0x0000, 0x0000, 0x0000, 0x0269, 0x026A, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B,
-    0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02A2, 0x02A3, 0x0000, 0x01D7, 0x0000, 0x02A2,
-    0x02A3, 0x0000, 0x01D2, 0x01D2, 0x0196, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0284,
-    0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0251, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0251, 0x0000, 0x0000, 0x007F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x020F, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x0000, 0x0284, 0x0000, 0x0251, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0248, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0248, 0x0000,
-    0x0199, 0x0248, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0000,
-    0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0281, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0281, 0x0000, 0x0199, 0x0281, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x028A, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x00AE, 0x00AF, 0x00B0, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0000, 0x0000, 0x0000,
-    0x021B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x028D, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0199, 0x0000, 0x021B, 0x0248, 0x0000, 0x0000, 0x0000, 0x00E7, 0x00E8, 0x00E9, 0x0284, 0x024B, 0x0284, 0x024B,
-    0x0284, 0x024B, 0x0284, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x021F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0281, 0x0000, 0x0000, 0x0000, 0x0120,
-    0x0121, 0x0122, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x021E,
-    0x0000, 0x021F, 0x0000, 0x0000, 0x0590, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x020F,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x024B, 0x0284, 0x0000, 0x0284, 0x024B, 0x0000, 0x0471,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0438, 0x03C6, 0x0000, 0x0199, 0x0000, 0x020F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0284,
-    0x024B, 0x0000, 0x024B, 0x0284, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0438,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x024B, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x028D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0248, 0x0000, 0x0000, 0x021F, 0x0000,
-    0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0369, 0x036B, 0x0000, 0x024B, 0x0284, 0x0000, 0x0284, 0x024B, 0x0284,
-    0x0000, 0x0000, 0x0000, 0x0369, 0x036B, 0x0000, 0x0352, 0x0353, 0x0000, 0x0354, 0x0000, 0x028D, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0281, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0369, 0x036B, 0x0000, 0x0000, 0x0550, 0x0366, 0x0368, 0x0000,
-    0x0284, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x024B, 0x0000, 0x0366, 0x0368, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0257, 0x0000, 0x058F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0264, 0x0366, 0x0368,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0197, 0x01D2, 0x01D2,
-    0x02B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0251,
-    0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x04E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B,
-    0x0284, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x021E, 0x0000, 0x0000, 0x0000, 0x0015, 0x0000, 0x0199, 0x0589, 0x0589, 0x0589, 0x0589, 0x0589, 0x058C, 0x0000,
-    0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0251,
-    0x0000, 0x0000, 0x04C6, 0x04C7, 0x04C8, 0x0000, 0x0248, 0x0000, 0x0000, 0x021E, 0x0000, 0x0197, 0x01D2, 0x01D2, 0x01CF, 0x01D2,
-    0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0248, 0x0000, 0x0199,
-    0x0000, 0x04C6, 0x04C7, 0x04C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x036A, 0x036A, 0x036A, 0x0000, 0x0281, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0281, 0x0000, 0x0199, 0x0000, 0x036A, 0x036A, 0x036A, 0x04C7, 0x04C7, 0x04C8, 0x0000, 0x0369, 0x036A,
-    0x036B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x020F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x028A, 0x0000, 0x0251, 0x0000, 0x0000, 0x0199, 0x0000, 0x0369, 0x0488, 0x036B,
-    0x0539, 0x0539, 0x053A, 0x0000, 0x0366, 0x0365, 0x0368, 0x0000, 0x0248, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0251,
-    0x0000, 0x0199, 0x0000, 0x0369, 0x036A, 0x036A, 0x036A, 0x036A, 0x036B, 0x0000, 0x0000, 0x0199, 0x0018, 0x0000, 0x0281, 0x0252,
-    0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0409, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0485, 0x0365, 0x0365, 0x0486, 0x0365, 0x0368, 0x0000,
-    0x0000, 0x0199, 0x0000, 0x0251, 0x0000, 0x028B, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x020F, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x01CB,
-    0x01CC, 0x01CC, 0x01CD, 0x0199, 0x0000, 0x0000, 0x0000, 0x0199, 0x0589, 0x0589, 0x0589, 0x0589, 0x0589, 0x058C, 0x0000, 0x0199,
-    0x0000, 0x0000, 0x0000, 0x0409, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0197, 0x01CF, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01CF, 0x01D2, 0x01D2, 0x01D2, 0x01CF, 0x01D2, 0x01D2,
-    0x01D2, 0x0195, 0x01D2, 0x01D2, 0x01D2, 0x027D, 0x0000, 0x020F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x020F, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0409,
-    0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x020F, 0x0000, 0x0199, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x024B, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0284,
-    0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0284,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+extern const unsigned char g_WorldChunkData[] __attribute__((aligned(4))) = {
+    16, 0, 2, 0, 63, 15, 0, 240, 1, 240, 19, 240, 37, 240, 55, 240, 73, 240, 91, 255, 240, 109, 240, 127, 240, 145, 240, 163, 240, 181, 240, 199,
+    240, 217, 240, 235, 255, 240, 253, 241, 15, 241, 33, 241, 51, 241, 69, 241, 87, 241, 105, 241, 123, 237, 241, 141, 241, 159, 145, 177, 1, 241, 189, 161,
+    207, 12, 241, 221, 128, 192, 31, 0, 16, 0, 2, 0, 59, 15, 0, 240, 1, 240, 19, 16, 37, 4, 64, 1, 240, 49, 255, 144, 29, 240, 33, 240,
+    31, 240, 115, 240, 63, 240, 121, 240, 95, 240, 157, 197, 240, 157, 80, 223, 1, 0, 2, 64, 1, 3, 240, 241, 139, 1, 3, 12, 0, 13, 64, 1,
+    14, 240, 55, 0, 59, 127, 18, 240, 31, 192, 55, 240, 63, 240, 31, 240, 95, 240, 63, 176, 127, 241, 112, 119, 240, 159, 17, 187, 144, 125, 10, 0,
+    20, 0, 1, 112, 21, 240, 31, 240, 217, 97, 245, 0, 16, 0, 2, 0, 55, 15, 0, 112, 1, 240, 0, 0, 128, 29, 240, 31, 240, 31, 255, 240,
+    66, 240, 95, 240, 95, 240, 127, 240, 127, 240, 159, 240, 159, 240, 192, 255, 240, 191, 240, 223, 240, 255, 240, 255, 241, 31, 241, 31, 241, 63, 241, 63,
+    255, 241, 98, 241, 127, 241, 127, 241, 159, 241, 159, 241, 191, 241, 191, 241, 224, 0, 0, 0, 16, 0, 2, 0, 54, 15, 0, 240, 1, 112, 19, 12,
+    240, 29, 160, 47, 19, 255, 240, 61, 240, 79, 240, 97, 240, 115, 240, 133, 240, 151, 240, 169, 240, 187, 255, 240, 205, 240, 223, 240, 241, 241, 3, 241,
+    21, 241, 39, 241, 57, 241, 75, 255, 241, 93, 241, 111, 241, 129, 241, 147, 241, 165, 241, 183, 241, 201, 241, 219, 128, 225, 237, 0, 16, 0, 2, 0,
+    34, 13, 0, 112, 1, 14, 0, 15, 0, 1, 4, 234, 0, 1, 16, 7, 48, 3, 20, 0, 1, 11, 32, 35, 10, 54, 0, 21, 128, 23, 144, 9,
+    12, 128, 61, 240, 33, 15, 63, 0, 19, 32, 69, 240, 61, 240, 77, 240, 95, 240, 113, 240, 131, 255, 240, 149, 240, 167, 240, 185, 240, 203, 240, 221,
+    240, 239, 241, 1, 241, 19, 255, 241, 37, 241, 55, 241, 73, 241, 91, 241, 109, 241, 127, 241, 145, 241, 163, 192, 241, 181, 113, 223, 16, 0, 2, 0,
+    63, 15, 0, 240, 1, 240, 19, 240, 37, 80, 55, 240, 0, 240, 18, 255, 240, 36, 240, 54, 240, 72, 240, 90, 240, 108, 240, 126, 240, 144, 240, 162,
+    255, 240, 180, 240, 198, 240, 216, 240, 234, 240, 252, 241, 14, 241, 32, 241, 50, 254, 241, 68, 241, 86, 241, 104, 241, 122, 241, 140, 241, 158, 209, 176,
+    16, 0, 2, 0, 55, 15, 0, 112, 1, 240, 0, 0, 128, 29, 240, 31, 240, 48, 255, 240, 66, 240, 84, 240, 102, 240, 120, 240, 138, 240, 156, 240,
+    174, 240, 192, 255, 240, 210, 240, 228, 240, 246, 241, 8, 241, 26, 241, 44, 241, 62, 241, 80, 255, 241, 98, 241, 116, 241, 134, 241, 152, 241, 170, 241,
+    188, 241, 206, 241, 224, 0, 0, 0, 16, 0, 2, 0, 69, 0, 96, 0, 53, 0, 54, 0, 1, 55, 112, 16, 139, 192, 9, 67, 0, 68, 0, 1,
+    69, 240, 31, 64, 59, 141, 16, 29, 68, 0, 65, 224, 65, 16, 87, 66, 64, 29, 234, 240, 65, 80, 87, 112, 31, 82, 192, 129, 81, 0, 17, 52,
+    143, 64, 93, 51, 0, 83, 240, 159, 64, 35, 16, 1, 240, 29, 255, 240, 206, 240, 224, 240, 242, 241, 4, 241, 22, 241, 40, 241, 58, 241, 76, 255,
+    241, 94, 241, 112, 241, 130, 241, 148, 241, 166, 241, 184, 241, 202, 241, 220, 16, 0, 2, 0, 99, 0, 240, 0, 192, 18, 112, 0, 113, 32, 1, 240,
+    41, 255, 176, 31, 240, 33, 240, 31, 240, 109, 240, 63, 240, 127, 240, 95, 240, 159, 255, 240, 161, 240, 159, 240, 235, 240, 191, 241, 15, 240, 223, 241,
+    31, 241, 33, 252, 241, 63, 241, 65, 241, 63, 241, 141, 241, 95, 177, 177, 104, 0, 113, 111, 1, 194, 241, 161, 81, 215, 116, 0, 103, 241, 159, 128,
+    129, 244, 0, 0, 16, 0, 2, 0, 7, 0, 0, 115, 0, 116, 64, 1, 240, 0, 240, 18, 255, 240, 36, 240, 54, 240, 72, 240, 90, 240, 108, 240,
+    126, 240, 144, 240, 162, 255, 240, 180, 240, 198, 240, 216, 240, 234, 240, 252, 241, 14, 241, 32, 241, 50, 255, 241, 68, 241, 86, 241, 104, 241, 122, 241,
+    140, 241, 158, 241, 176, 241, 194, 192, 241, 212, 177, 230, 16, 0, 2, 0, 12, 0, 0, 71, 0, 112, 3, 240, 2, 71, 0, 111, 85, 128, 3, 16,
+    34, 85, 96, 39, 16, 9, 144, 29, 80, 25, 247, 144, 73, 208, 63, 16, 109, 112, 65, 97, 192, 63, 112, 67, 240, 127, 191, 208, 29, 72, 64, 141,
+    112, 123, 16, 153, 48, 21, 240, 191, 176, 225, 221, 112, 235, 176, 191, 86, 128, 217, 240, 255, 81, 33, 58, 129, 41, 219, 240, 255, 113, 71, 61, 193,
+    63, 176, 91, 60, 32, 33, 112, 187, 191, 17, 135, 119, 161, 131, 16, 33, 113, 55, 112, 127, 80, 91, 240, 191, 226, 241, 194, 112, 93, 81, 183, 108,
+    0, 110, 1, 241, 100, 32, 0, 101, 1, 247, 102, 0, 16, 0, 2, 0, 82, 0, 64, 0, 86, 80, 8, 0, 73, 32, 18, 41, 197, 96, 15, 80,
+    33, 77, 0, 78, 32, 44, 87, 128, 31, 81, 70, 0, 62, 57, 64, 66, 90, 0, 91, 64, 76, 199, 16, 17, 48, 63, 84, 0, 98, 128, 57, 144,
+    9, 144, 95, 170, 48, 57, 48, 96, 67, 47, 0, 1, 39, 192, 127, 72, 190, 32, 168, 22, 96, 165, 80, 159, 16, 129, 208, 170, 16, 149, 41, 183,
+    64, 25, 84, 240, 31, 32, 19, 41, 240, 25, 160, 241, 240, 255, 174, 17, 41, 88, 160, 127, 58, 240, 125, 192, 159, 48, 125, 150, 216, 240, 163, 1,
+    95, 56, 240, 185, 33, 140, 118, 0, 114, 222, 65, 127, 48, 33, 118, 240, 225, 193, 159, 112, 149, 49, 13, 61, 240, 161, 191, 112, 179, 145, 13, 17,
+    223, 108, 0, 110, 0, 0, 0, 0, 16, 0, 2, 0, 127, 0, 240, 0, 240, 18, 240, 36, 240, 54, 240, 72, 240, 90, 240, 108, 223, 240, 126, 192,
+    144, 56, 240, 160, 240, 178, 240, 196, 240, 214, 240, 232, 131, 128, 250, 23, 0, 24, 0, 25, 241, 10, 97, 28, 6, 26, 0, 27, 0, 28, 241, 42,
+    97, 60, 30, 15, 0, 31, 0, 32, 241, 74, 241, 92, 241, 110, 241, 128, 227, 241, 146, 241, 164, 193, 182, 108, 0, 110, 241, 200, 97, 218, 6, 144,
+    0, 106, 0, 107, 241, 232, 33, 250, 16, 0, 2, 0, 52, 85, 0, 48, 0, 48, 7, 71, 0, 13, 106, 0, 112, 107, 64, 19, 144, 6, 16, 25,
+    0, 0, 40, 0, 91, 47, 0, 1, 96, 240, 29, 64, 63, 41, 240, 55, 128, 93, 162, 176, 31, 72, 160, 25, 0, 0, 70, 64, 63, 125, 9, 0,
+    126, 0, 127, 240, 129, 0, 84, 64, 95, 86, 109, 32, 1, 126, 128, 37, 86, 96, 77, 16, 127, 108, 2, 0, 122, 0, 110, 0, 140, 0, 1, 141,
+    247, 160, 199, 16, 111, 48, 31, 48, 65, 109, 0, 37, 208, 232, 16, 191, 23, 120, 0, 105, 0, 1, 121, 0, 5, 241, 7, 16, 223, 22, 43, 0,
+    44, 0, 1, 45, 240, 235, 1, 29, 46, 251, 33, 31, 48, 3, 48, 11, 208, 93, 17, 110, 56, 241, 95, 241, 61, 223, 241, 131, 1, 93, 7, 241,
+    153, 240, 95, 241, 189, 241, 125, 97, 225, 0, 0, 0, 16, 0, 2, 0, 86, 0, 32, 0, 75, 0, 6, 149, 48, 10, 64, 5, 41, 3, 0, 76,
+    0, 106, 0, 107, 160, 19, 48, 43, 106, 72, 64, 31, 240, 26, 60, 64, 65, 6, 32, 63, 147, 130, 32, 1, 125, 0, 126, 0, 127, 0, 100, 70,
+    138, 96, 33, 40, 0, 47, 0, 1, 46, 32, 5, 47, 35, 0, 109, 32, 1, 0, 0, 84, 128, 121, 144, 136, 81, 108, 0, 33, 110, 192, 153, 0,
+    0, 56, 96, 171, 30, 106, 0, 105, 32, 165, 48, 95, 240, 153, 16, 201, 8, 163, 32, 95, 73, 192, 95, 117, 0, 99, 0, 1, 48, 201, 189, 16,
+    211, 87, 160, 127, 112, 97, 80, 201, 16, 207, 148, 224, 63, 175, 112, 201, 38, 64, 209, 83, 160, 159, 176, 183, 145, 98, 80, 127, 221, 80, 109, 209,
+    81, 71, 240, 63, 96, 21, 16, 27, 85, 240, 95, 240, 96, 21, 208, 27, 241, 177, 81, 236, 16, 0, 2, 0, 109, 0, 240, 0, 160, 18, 130, 240,
+    32, 160, 50, 147, 0, 1, 110, 148, 240, 68, 96, 86, 47, 96, 1, 240, 105, 48, 123, 71, 222, 240, 130, 160, 148, 85, 240, 162, 240, 180, 240, 198,
+    64, 216, 99, 255, 96, 1, 240, 233, 240, 101, 241, 13, 240, 63, 241, 49, 241, 67, 240, 127, 255, 240, 127, 176, 255, 240, 229, 144, 255, 241, 35, 241,
+    35, 241, 201, 241, 219, 128, 241, 237, 16, 0, 2, 0, 95, 0, 128, 0, 41, 144, 12, 240, 11, 240, 31, 240, 47, 240, 65, 255, 240, 83, 240, 101,
+    240, 119, 240, 137, 240, 155, 240, 173, 240, 191, 240, 209, 255, 240, 227, 240, 245, 241, 7, 241, 25, 241, 43, 241, 61, 241, 79, 241, 97, 254, 241, 115,
+    241, 133, 241, 151, 241, 169, 241, 187, 241, 205, 241, 223, 0, 0, 0, 0, 16, 0, 2, 0, 95, 0, 96, 0, 41, 112, 10, 240, 9, 240, 31, 240,
+    45, 240, 63, 255, 240, 81, 240, 99, 240, 117, 240, 135, 240, 153, 240, 171, 240, 189, 240, 207, 255, 240, 225, 240, 243, 241, 5, 241, 23, 241, 41, 241,
+    59, 241, 77, 241, 95, 255, 241, 113, 241, 131, 241, 149, 241, 167, 241, 185, 241, 203, 241, 221, 33, 250, 0, 0, 16, 0, 2, 0, 127, 0, 240, 0,
+    240, 18, 240, 36, 240, 54, 240, 72, 240, 90, 240, 108, 255, 240, 126, 240, 144, 240, 162, 240, 180, 240, 198, 240, 216, 240, 234, 240, 252, 183, 129, 14,
+    59, 241, 26, 161, 44, 74, 241, 58, 241, 76, 241, 94, 241, 241, 112, 241, 130, 241, 148, 129, 166, 123, 0, 124, 241, 180, 140, 129, 198, 145, 0, 132,
+    241, 212, 129, 230, 137, 0, 64, 138, 129, 244, 0, 0, 16, 0, 2, 0, 127, 0, 240, 0, 240, 18, 240, 36, 240, 54, 240, 72, 240, 90, 240, 108,
+    255, 240, 126, 240, 144, 240, 162, 240, 180, 240, 198, 240, 216, 240, 234, 240, 252, 255, 241, 14, 241, 32, 241, 50, 241, 68, 241, 86, 241, 104, 241, 122,
+    241, 140, 198, 241, 158, 129, 176, 128, 0, 129, 241, 190, 129, 208, 135, 48, 0, 146, 241, 222, 129, 240, 142, 0, 143, 0, 0, 0, 16, 0, 2, 0,
+    127, 0, 240, 0, 240, 18, 240, 36, 240, 54, 240, 72, 240, 90, 240, 108, 227, 240, 126, 240, 144, 0, 162, 16, 0, 5, 240, 168, 128, 186, 31, 33,
+    0, 29, 240, 200, 240, 218, 240, 236, 240, 254, 241, 16, 252, 241, 34, 241, 52, 241, 70, 241, 88, 241, 106, 97, 124, 128, 0, 96, 129, 241, 136, 97,
+    154, 125, 0, 135, 0, 136, 193, 241, 168, 97, 186, 139, 0, 142, 0, 143, 241, 200, 140, 129, 218, 36, 0, 37, 241, 232, 33, 250, 16, 0, 2, 0,
+    65, 0, 192, 0, 42, 0, 49, 0, 50, 208, 20, 158, 240, 15, 0, 72, 240, 35, 240, 53, 240, 71, 0, 110, 123, 12, 0, 126, 0, 124, 240, 97,
+    96, 136, 131, 0, 24, 134, 0, 132, 240, 129, 96, 168, 137, 0, 133, 61, 0, 138, 240, 161, 240, 179, 240, 197, 64, 236, 34, 160, 244, 107, 71, 240,
+    237, 33, 20, 9, 65, 26, 85, 241, 13, 241, 31, 255, 241, 49, 241, 67, 241, 85, 241, 103, 241, 121, 241, 139, 241, 157, 241, 175, 224, 241, 193, 241,
+    211, 33, 250, 0, 16, 0, 2, 0, 120, 0, 240, 0, 240, 18, 240, 36, 96, 54, 123, 0, 126, 48, 0, 124, 240, 68, 96, 86, 131, 0, 134, 0,
+    80, 132, 192, 100, 79, 128, 116, 137, 0, 133, 0, 86, 138, 192, 132, 92, 160, 148, 35, 240, 162, 32, 180, 80, 42, 0, 63, 32, 188, 17, 96, 194,
+    89, 160, 204, 93, 60, 0, 94, 240, 220, 240, 238, 241, 0, 65, 18, 64, 0, 118, 95, 241, 28, 241, 46, 161, 64, 71, 160, 63, 241, 91, 85, 255,
+    240, 47, 241, 128, 240, 47, 241, 164, 241, 182, 241, 200, 241, 218, 241, 236, 0, 0, 0, 0, 16, 0, 2, 0, 127, 0, 240, 0, 240, 18, 240, 36,
+    240, 54, 240, 72, 240, 90, 240, 108, 246, 240, 126, 240, 144, 240, 162, 160, 180, 94, 240, 194, 240, 212, 0, 99, 71, 240, 232, 32, 250, 62, 0, 63,
+    241, 2, 240, 61, 223, 241, 38, 161, 56, 85, 241, 70, 240, 127, 241, 106, 241, 124, 241, 142, 252, 241, 160, 241, 178, 241, 196, 241, 214, 241, 232, 33,
+    250, 0, 0, 0,
 };
 
-extern const unsigned short g_Layer3[] __attribute__((aligned(4))) = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0044, 0x000B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0129, 0x00F1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021D, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0256, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D0, 0x04D1, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04C2, 0x04C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04D0, 0x04D1, 0x0000, 0x0000,
-    0x04C6, 0x0509, 0x050A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0570, 0x04FC, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0509, 0x057F, 0x0000, 0x0000, 0x0538, 0x0542, 0x0543, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0534, 0x0535, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0542, 0x0543, 0x0000, 0x0000, 0x0000, 0x0175, 0x0176, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01AA, 0x01E5, 0x01E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0251, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04C2, 0x04C7, 0x04C3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04C2, 0x04C7, 0x04C3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x04FB, 0x0500, 0x04FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x026D, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x04FB, 0x0500, 0x04FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0534, 0x04FD, 0x0535, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x02A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0534, 0x04FD, 0x0535, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x014C,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x026E, 0x0236, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x005B, 0x0000, 0x0000, 0x0000, 0x0000, 0x028F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x02A7, 0x02A8, 0x0000, 0x0000, 0x02A8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x014A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000,
-    0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0237, 0x02A9, 0x0000,
-    0x0235, 0x0236, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0237, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x024B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0284, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+extern const int g_WorldSolidStride = 5;
+
+extern const unsigned char g_WorldSolidBits[] __attribute__((aligned(4))) = {
+    42, 0, 16, 18, 0, 127, 66, 96, 146, 0, 127, 4, 98, 148, 0, 127, 133, 141, 17, 0, 255, 1, 172, 29, 0, 255, 32, 144, 16, 25, 95, 1,
+    1, 52, 24, 95, 8, 1, 52, 0, 255, 40, 0, 16, 56, 127, 36, 128, 208, 56, 127, 66, 0, 144, 56, 63, 162, 4, 48, 0, 183, 64, 0, 86,
+    24, 119, 22, 2, 208, 28, 127, 6, 132, 212, 28, 59, 182, 130, 208, 28, 145, 7, 40, 240, 0, 144, 23, 0, 18, 1, 152, 0, 71, 244, 7, 137,
+    46, 151, 254, 31, 161, 14, 23, 6, 2, 160, 126, 7, 106, 2, 148, 126, 87, 98, 2, 160, 126, 54, 226, 31, 130, 126, 42, 114, 19, 130, 62, 254,
+    226, 31, 192, 255, 255, 43, 8, 64, 4, 160, 224, 31, 64, 0, 40, 160, 18, 192, 0, 32, 41, 10, 64, 0, 32, 9, 8, 64, 0, 32, 0, 0,
+    64, 0, 32, 0, 0, 64, 0, 32, 0, 0,
+};
+
+extern const unsigned short g_LayerRowRunIndex[] __attribute__((aligned(4))) = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0022, 0x0023, 0x0025, 0x0027, 0x0029, 0x002B, 0x002D, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0038, 0x0039, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A,
+    0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x003A, 0x0040, 0x0047, 0x004E, 0x0055, 0x005A, 0x0060, 0x0066, 0x006C, 0x0070,
+    0x0076, 0x007C, 0x0082, 0x0089, 0x008E, 0x0094, 0x009E, 0x00A5, 0x00AA, 0x00AF, 0x00B7, 0x00BF, 0x00C6, 0x00CD, 0x00D4, 0x00DC,
+    0x00E1, 0x00E3, 0x00E7, 0x00ED, 0x00F4, 0x00F9, 0x00FB, 0x00FD, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0100,
+    0x0101, 0x0101, 0x0102, 0x0103, 0x0103, 0x0103, 0x0104, 0x0107, 0x010A, 0x010D, 0x010E, 0x010F, 0x0110, 0x0113, 0x0116, 0x0119,
+    0x011D, 0x011F, 0x0123, 0x0125, 0x0128, 0x012B, 0x012C, 0x012C, 0x012C, 0x012C, 0x012C, 0x012C,
+};
+
+extern const unsigned short g_LayerRowRuns[] __attribute__((aligned(4))) = {
+    0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026,
+    0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026,
+    0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026,
+    0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026, 0x0000, 0x0026,
+    0x0000, 0x0026, 0x0000, 0x0026, 0x0015, 0x0019, 0x0015, 0x0019, 0x0021, 0x0025, 0x0013, 0x001A, 0x0021, 0x0026, 0x0011, 0x001A,
+    0x0021, 0x0026, 0x0011, 0x001A, 0x0021, 0x0026, 0x0011, 0x0019, 0x0021, 0x0026, 0x0013, 0x0018, 0x0021, 0x0026, 0x0021, 0x0026,
+    0x0021, 0x0026, 0x0021, 0x0026, 0x0021, 0x0026, 0x0021, 0x0026, 0x0021, 0x0026, 0x0021, 0x0026, 0x0020, 0x0022, 0x0023, 0x0026,
+    0x0020, 0x0026, 0x0021, 0x0026, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0014, 0x0015, 0x0019, 0x001A, 0x001C, 0x001D,
+    0x0000, 0x0007, 0x0009, 0x000A, 0x000E, 0x000F, 0x0015, 0x0017, 0x0019, 0x001A, 0x001C, 0x001D, 0x001F, 0x0020, 0x0000, 0x0007,
+    0x000A, 0x000B, 0x0011, 0x0012, 0x0015, 0x0017, 0x001A, 0x001B, 0x001C, 0x001D, 0x001F, 0x0020, 0x0000, 0x0007, 0x0008, 0x0009,
+    0x000A, 0x000B, 0x000F, 0x0011, 0x0012, 0x0014, 0x0017, 0x0019, 0x001C, 0x001D, 0x0000, 0x0009, 0x0012, 0x0014, 0x0015, 0x0016,
+    0x0017, 0x0019, 0x001A, 0x001D, 0x0000, 0x0008, 0x000D, 0x000E, 0x0014, 0x0015, 0x0017, 0x0018, 0x001C, 0x001D, 0x0020, 0x0021,
+    0x0000, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x0010, 0x0011, 0x001A, 0x001B, 0x001C, 0x001E, 0x0000, 0x0005, 0x0006, 0x0007,
+    0x000B, 0x000C, 0x0010, 0x0011, 0x001A, 0x001B, 0x001C, 0x001E, 0x0000, 0x0008, 0x000B, 0x000C, 0x001C, 0x001D, 0x0023, 0x0026,
+    0x0000, 0x0007, 0x000A, 0x000B, 0x0017, 0x0018, 0x001C, 0x001D, 0x001E, 0x0020, 0x0023, 0x0026, 0x0000, 0x0007, 0x0009, 0x000A,
+    0x000E, 0x000F, 0x001C, 0x001D, 0x001F, 0x0020, 0x0023, 0x0026, 0x0000, 0x0006, 0x0009, 0x000A, 0x000D, 0x000E, 0x000F, 0x0010,
+    0x0012, 0x0013, 0x001C, 0x001E, 0x0000, 0x0003, 0x0004, 0x0006, 0x0007, 0x0008, 0x000E, 0x000F, 0x0019, 0x001B, 0x001C, 0x001D,
+    0x001E, 0x001F, 0x0000, 0x0003, 0x0004, 0x0007, 0x000C, 0x000D, 0x0011, 0x0012, 0x001C, 0x001D, 0x0000, 0x0007, 0x0012, 0x0013,
+    0x0017, 0x0018, 0x001A, 0x001B, 0x001C, 0x001D, 0x0023, 0x0025, 0x0000, 0x0002, 0x0003, 0x0006, 0x0009, 0x000B, 0x000C, 0x000E,
+    0x000F, 0x0010, 0x0011, 0x0012, 0x0017, 0x0018, 0x001C, 0x001D, 0x001E, 0x0020, 0x0022, 0x0025, 0x0000, 0x0001, 0x0004, 0x0005,
+    0x0007, 0x0008, 0x0009, 0x000B, 0x0013, 0x0014, 0x0015, 0x0016, 0x001C, 0x0020, 0x0004, 0x0005, 0x0007, 0x000B, 0x0019, 0x001A,
+    0x001C, 0x001D, 0x0020, 0x0021, 0x0003, 0x0005, 0x0007, 0x0008, 0x0016, 0x0017, 0x001A, 0x001B, 0x001C, 0x0023, 0x0000, 0x0001,
+    0x0003, 0x0004, 0x0007, 0x0008, 0x000D, 0x000E, 0x0010, 0x0013, 0x0014, 0x0015, 0x0017, 0x0018, 0x0019, 0x0025, 0x0000, 0x0001,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000C, 0x0010, 0x0013, 0x0014, 0x0015, 0x0019, 0x001A, 0x0021, 0x0022, 0x0005, 0x0006,
+    0x0007, 0x0008, 0x0009, 0x000F, 0x0010, 0x0013, 0x0019, 0x001A, 0x001B, 0x001C, 0x0021, 0x0022, 0x0002, 0x0003, 0x0004, 0x0005,
+    0x0007, 0x0008, 0x0009, 0x000F, 0x0010, 0x0013, 0x0014, 0x0015, 0x0019, 0x001A, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000F,
+    0x0011, 0x0013, 0x0014, 0x0016, 0x0019, 0x001A, 0x001D, 0x0025, 0x0007, 0x0008, 0x0009, 0x000F, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0019, 0x001A, 0x001C, 0x001D, 0x0024, 0x0025, 0x0007, 0x0008, 0x0009, 0x000E, 0x0011, 0x0018, 0x0019, 0x001A,
+    0x001D, 0x0025, 0x0006, 0x001A, 0x001B, 0x001C, 0x0006, 0x0007, 0x000A, 0x000B, 0x0015, 0x0016, 0x001D, 0x0025, 0x0006, 0x0007,
+    0x0013, 0x0014, 0x0015, 0x0016, 0x001D, 0x001E, 0x0021, 0x0022, 0x0024, 0x0025, 0x0006, 0x0008, 0x0015, 0x0016, 0x0018, 0x0019,
+    0x001B, 0x001C, 0x001D, 0x001E, 0x0021, 0x0022, 0x0023, 0x0024, 0x0006, 0x0007, 0x0015, 0x0016, 0x0018, 0x0019, 0x001B, 0x001C,
+    0x0023, 0x0024, 0x0006, 0x0007, 0x0015, 0x0016, 0x0006, 0x0007, 0x0015, 0x0016, 0x0006, 0x0007, 0x0015, 0x0016, 0x0023, 0x0025,
+    0x0023, 0x0025, 0x000D, 0x000E, 0x000D, 0x000E, 0x0023, 0x0025, 0x0009, 0x000B, 0x001E, 0x0020, 0x0022, 0x0025, 0x0009, 0x000B,
+    0x001E, 0x0020, 0x0022, 0x0025, 0x0009, 0x000B, 0x001E, 0x0020, 0x0023, 0x0025, 0x0008, 0x000B, 0x000C, 0x000D, 0x0010, 0x0013,
+    0x0009, 0x000C, 0x0010, 0x0013, 0x001A, 0x001B, 0x0009, 0x000C, 0x0010, 0x0013, 0x001A, 0x001B, 0x0009, 0x000C, 0x0011, 0x0012,
+    0x001D, 0x001F, 0x0011, 0x0012, 0x0016, 0x0017, 0x001D, 0x001F, 0x0021, 0x0022, 0x000A, 0x000B, 0x0024, 0x0025, 0x0001, 0x0002,
+    0x000D, 0x000E, 0x001D, 0x001F, 0x0020, 0x0022, 0x0001, 0x0002, 0x0023, 0x0024, 0x0017, 0x0018, 0x001D, 0x001E, 0x0023, 0x0024,
+    0x0017, 0x0018, 0x001F, 0x0020, 0x0024, 0x0025, 0x001F, 0x0020,
 };
 
-extern const unsigned short g_GidToBaseTile8[] __attribute__((aligned(4))) = {
-    0x0000, 0x0000, 0x0000, 0x0001, 0x0005, 0x0009, 0x000D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0011, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0015, 0x0019, 0x0000, 0x001D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0025, 0x0029, 0x002D, 0x0031, 0x0035, 0x0039,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x003D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0045, 0x0049, 0x004D, 0x0051, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0055,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0059, 0x005D,
-    0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0065, 0x0069, 0x006D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0071, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0075, 0x0079, 0x007D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0085, 0x0000, 0x0089, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x008D, 0x0091, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0095, 0x0099, 0x009D, 0x0000, 0x00A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00A9, 0x00AD, 0x00B1, 0x0000, 0x00B5,
-    0x0000, 0x0000, 0x00B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x00BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C1, 0x00C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C9, 0x00CD, 0x00D1, 0x00D5, 0x00D9, 0x0000, 0x0000, 0x0000, 0x00DD,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00E1, 0x0000, 0x00E5, 0x0000, 0x00E9, 0x00ED, 0x00F1,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00F5, 0x00F9, 0x00FD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0101, 0x0105, 0x0109, 0x010D, 0x0111, 0x0000, 0x0000, 0x0000, 0x0115, 0x0000, 0x0000, 0x0119, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x011D, 0x0121, 0x0000, 0x0000, 0x0000, 0x0125, 0x0129, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x012D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0135, 0x0000, 0x0000, 0x0139, 0x013D, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0141, 0x0145, 0x0149, 0x0000, 0x0000,
-    0x0000, 0x014D, 0x0000, 0x0000, 0x0151, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0155, 0x0159, 0x0000, 0x015D, 0x0000, 0x0161,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0165, 0x0169, 0x0000, 0x0000, 0x016D, 0x0171, 0x0175, 0x0179, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x017D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0181, 0x0185, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0189, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x018D, 0x0191, 0x0195, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0199, 0x0000,
-    0x019D, 0x0000, 0x0000, 0x0000, 0x0000, 0x01A1, 0x01A5, 0x0000, 0x01A9, 0x01AD, 0x01B1, 0x01B5, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01B9, 0x01BD, 0x01C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x01C9, 0x01CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x01D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DD, 0x01E1, 0x0000, 0x01E5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x01E9, 0x01ED, 0x0000, 0x0000, 0x01F1, 0x01F5, 0x01F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x01FD, 0x0201, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0209, 0x020D, 0x0211, 0x0000, 0x0000,
-    0x0215, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0219, 0x021D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0221, 0x0225, 0x0000, 0x0000, 0x0229, 0x022D, 0x0231, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0235, 0x0239, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x023D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0241, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0245,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0249, 0x0000, 0x0000, 0x024D, 0x0000, 0x0000, 0x0251,
-    0x0255,
+extern const unsigned short g_LayerColRunIndex[] __attribute__((aligned(4))) = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026,
+    0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D,
+    0x002E, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x002F, 0x0030, 0x0031, 0x0033, 0x0034, 0x0035, 0x0036, 0x0036, 0x0038,
+    0x0039, 0x003B, 0x003E, 0x0040, 0x0044, 0x0047, 0x004C, 0x0050, 0x0054, 0x0058, 0x005A, 0x005D, 0x0062, 0x0067, 0x006B, 0x006F,
+    0x0073, 0x0078, 0x007C, 0x0081, 0x0085, 0x0088, 0x008D, 0x0090, 0x0094, 0x009A, 0x009F, 0x00A1, 0x00A8, 0x00AF, 0x00B6, 0x00BB,
+    0x00BF, 0x00C4, 0x00CB, 0x00D0, 0x00D1, 0x00D1, 0x00D1, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D3, 0x00D5,
+    0x00D8, 0x00D9, 0x00DA, 0x00DC, 0x00DC, 0x00DC, 0x00DD, 0x00DE, 0x00DF, 0x00DF, 0x00DF, 0x00DF, 0x00E0, 0x00E1, 0x00E1, 0x00E1,
+    0x00E2, 0x00E2, 0x00E2, 0x00E5, 0x00E8, 0x00EA, 0x00EB, 0x00ED, 0x00EE, 0x00F1, 0x00F5, 0x00F5,
+};
+
+extern const unsigned short g_LayerColRuns[] __attribute__((aligned(4))) = {
+    0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022,
+    0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022,
+    0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022,
+    0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022,
+    0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0003, 0x0006, 0x0003, 0x0006,
+    0x0002, 0x0007, 0x0002, 0x0007, 0x0000, 0x0007, 0x0000, 0x0007, 0x0000, 0x0007, 0x0000, 0x0006, 0x0002, 0x0005, 0x000E, 0x0010,
+    0x0001, 0x0011, 0x0001, 0x000E, 0x000F, 0x0011, 0x0001, 0x0011, 0x0001, 0x0011, 0x0002, 0x0011, 0x0001, 0x0011, 0x0013, 0x0015,
+    0x0000, 0x0010, 0x0001, 0x000F, 0x0016, 0x0017, 0x0000, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x0001, 0x0013, 0x0016, 0x0017,
+    0x0000, 0x0006, 0x0008, 0x0010, 0x0014, 0x0016, 0x0017, 0x0018, 0x0001, 0x000B, 0x000D, 0x000F, 0x001A, 0x0022, 0x0004, 0x0006,
+    0x0008, 0x0009, 0x000C, 0x000D, 0x0010, 0x001B, 0x001D, 0x001E, 0x0003, 0x0005, 0x0006, 0x0007, 0x0011, 0x0012, 0x001A, 0x001B,
+    0x0001, 0x0002, 0x000A, 0x000C, 0x000F, 0x0012, 0x0014, 0x001B, 0x0002, 0x0004, 0x0009, 0x000A, 0x000F, 0x0012, 0x0014, 0x001C,
+    0x0007, 0x0009, 0x0014, 0x001B, 0x000D, 0x000E, 0x000F, 0x0010, 0x0015, 0x001B, 0x0005, 0x0006, 0x000B, 0x000C, 0x000F, 0x0010,
+    0x0013, 0x0014, 0x0015, 0x001B, 0x0001, 0x0002, 0x000A, 0x000B, 0x000C, 0x000D, 0x0015, 0x0019, 0x001A, 0x001B, 0x0003, 0x0004,
+    0x000B, 0x000C, 0x000F, 0x0010, 0x001A, 0x001B, 0x0003, 0x0004, 0x0006, 0x0008, 0x0013, 0x0017, 0x001A, 0x001B, 0x0002, 0x0003,
+    0x000D, 0x000E, 0x000F, 0x0010, 0x0013, 0x001B, 0x0003, 0x0005, 0x000B, 0x000C, 0x000E, 0x000F, 0x0013, 0x0018, 0x0019, 0x001B,
+    0x0003, 0x0005, 0x0010, 0x0011, 0x0018, 0x001B, 0x001C, 0x001D, 0x0000, 0x0001, 0x0005, 0x0006, 0x0013, 0x0015, 0x0016, 0x0018,
+    0x0019, 0x001B, 0x0001, 0x0003, 0x0004, 0x0005, 0x0010, 0x0011, 0x0017, 0x0022, 0x0001, 0x0003, 0x0012, 0x0013, 0x0019, 0x001B,
+    0x0003, 0x0006, 0x0009, 0x000A, 0x000E, 0x0010, 0x0013, 0x0014, 0x0019, 0x001B, 0x0003, 0x0005, 0x001A, 0x001B, 0x001D, 0x001F,
+    0x0000, 0x0002, 0x000C, 0x000D, 0x0011, 0x0012, 0x0013, 0x001B, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0008, 0x000C, 0x000D,
+    0x000E, 0x000F, 0x0012, 0x0014, 0x0004, 0x0005, 0x0013, 0x0014, 0x0015, 0x0016, 0x001A, 0x001B, 0x001D, 0x001F, 0x0000, 0x0014,
+    0x0018, 0x0019, 0x0006, 0x0008, 0x000B, 0x000C, 0x0010, 0x0011, 0x0012, 0x0014, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001E,
+    0x0009, 0x000A, 0x000C, 0x000D, 0x000F, 0x0011, 0x0012, 0x0014, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x0001, 0x0003,
+    0x0009, 0x000B, 0x000F, 0x0011, 0x0012, 0x0014, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x0005, 0x0006, 0x0011, 0x0014,
+    0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x0012, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001E, 0x000F, 0x0010,
+    0x0012, 0x0014, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x0008, 0x000B, 0x000E, 0x0010, 0x0013, 0x0014, 0x0017, 0x0018,
+    0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001F, 0x0008, 0x000B, 0x000E, 0x0010, 0x0013, 0x0014, 0x0017, 0x001A, 0x001B, 0x001D,
+    0x0008, 0x000B, 0x0018, 0x001A, 0x0010, 0x0011, 0x000D, 0x0011, 0x0013, 0x0016, 0x000D, 0x0011, 0x0013, 0x0016, 0x0017, 0x0018,
+    0x0013, 0x0016, 0x0011, 0x0012, 0x0008, 0x000A, 0x0018, 0x0019, 0x0012, 0x0015, 0x0012, 0x0017, 0x0012, 0x0015, 0x0016, 0x0017,
+    0x001A, 0x001C, 0x0013, 0x0015, 0x0015, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x000D, 0x0010, 0x0015, 0x0017, 0x0018, 0x0019,
+    0x000D, 0x0010, 0x001B, 0x001D, 0x0018, 0x0019, 0x0016, 0x0017, 0x0018, 0x0019, 0x000D, 0x000F, 0x0005, 0x0007, 0x000C, 0x0010,
+    0x0019, 0x001B, 0x0005, 0x0007, 0x000C, 0x0010, 0x0017, 0x0018, 0x001B, 0x001C,
+};
+
+extern const unsigned int g_MetatileCount = 151;
+
+extern const unsigned short g_Metatiles[] __attribute__((aligned(4))) = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006, 0x0007, 0x0402, 0x0401, 0x0008, 0x0403,
+    0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000D, 0x000E, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0410, 0x040F, 0x0412, 0x0411,
+    0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0417, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x0C07, 0x001E, 0x001F, 0x0807,
+    0x0020, 0x0021, 0x0020, 0x0408, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0420, 0x0027, 0x0420, 0x0028, 0x0029, 0x002A, 0x002B,
+    0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0430, 0x0018, 0x0019, 0x0031, 0x001A, 0x0C04, 0x001A, 0x0820, 0x0806, 0x0032, 0x0033,
+    0x0034, 0x001A, 0x0035, 0x0035, 0x0427, 0x0C20, 0x0433, 0x0432, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D,
+    0x003B, 0x003B, 0x0407, 0x001A, 0x003B, 0x043A, 0x0C04, 0x043C, 0x003C, 0x0434, 0x003C, 0x0C27, 0x0427, 0x003E, 0x0834, 0x001A,
+    0x041E, 0x043C, 0x003F, 0x043C, 0x0040, 0x0041, 0x0042, 0x0043, 0x003C, 0x0807, 0x0044, 0x0045, 0x003E, 0x0C1E, 0x0045, 0x0045,
+    0x0046, 0x043C, 0x0045, 0x0444, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x044B, 0x004C, 0x044C, 0x004D, 0x044D, 0x004E, 0x044E,
+    0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0467, 0x0068, 0x0468, 0x0069, 0x006A, 0x006B, 0x006C,
+    0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C,
+    0x007D, 0x007E, 0x007F, 0x0080, 0x004F, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B,
+    0x008C, 0x008D, 0x008E, 0x008F, 0x005F, 0x0090, 0x0091, 0x088D, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x045F, 0x0097, 0x005C,
+    0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x0099, 0x009A, 0x009D, 0x009E, 0x049E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4,
+    0x0000, 0x0000, 0x00A5, 0x00A6, 0x0000, 0x0000, 0x00A7, 0x00A8, 0x00A9, 0x04A9, 0x00AA, 0x04AA, 0x00AB, 0x04AB, 0x00AC, 0x04AC,
+    0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x0C8F, 0x00B6, 0x008F, 0x045C, 0x00B7, 0x00B8, 0x00B9,
+    0x00BA, 0x0488, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x04C5, 0x00C6, 0x04C6,
+    0x0000, 0x0000, 0x00C7, 0x00C8, 0x00C9, 0x00C2, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3,
+    0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x0000, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x0000, 0x0000, 0x00DF, 0x00E0,
+    0x00E1, 0x04E1, 0x00E2, 0x04E2, 0x0065, 0x00E3, 0x085F, 0x00E4, 0x088D, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x0C5F,
+    0x00EB, 0x00EC, 0x00ED, 0x04ED, 0x00EE, 0x04EE, 0x00EF, 0x04EF, 0x0000, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00ED, 0x04ED,
+    0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103, 0x0104,
+    0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x010C, 0x010D, 0x0110, 0x0111, 0x0112,
+    0x0057, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0000, 0x0117, 0x0516, 0x0000, 0x0518, 0x0119, 0x011A, 0x011B, 0x011C,
+    0x011D, 0x011E, 0x011F, 0x0120, 0x051E, 0x051D, 0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A,
+    0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x012F, 0x0130, 0x0130, 0x0131, 0x012F, 0x0132, 0x0130, 0x012F, 0x0531, 0x0130, 0x0532,
+    0x0131, 0x012F, 0x0131, 0x012F, 0x012F, 0x012F, 0x012F, 0x012F, 0x012F, 0x0531, 0x012F, 0x0531, 0x0133, 0x0134, 0x0135, 0x0136,
+    0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0146,
+    0x0147, 0x0148, 0x0149, 0x014A, 0x014B, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156,
+    0x0157, 0x0158, 0x0159, 0x015A, 0x015B, 0x015C, 0x0130, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161, 0x0000, 0x0162, 0x0163, 0x0164,
+    0x0165, 0x0000, 0x0166, 0x0167, 0x0168, 0x0169, 0x016A, 0x0166, 0x0169, 0x0169, 0x0166, 0x0166, 0x0169, 0x0568, 0x0166, 0x056A,
+    0x0000, 0x016B, 0x016C, 0x016D, 0x016E, 0x0000, 0x016F, 0x0170, 0x0171, 0x0172, 0x0155, 0x0156, 0x0173, 0x0164, 0x0173, 0x0164,
+    0x0166, 0x0174, 0x0166, 0x0174, 0x0175, 0x0175, 0x0000, 0x0000, 0x0166, 0x0166, 0x0166, 0x0166, 0x0176, 0x016D, 0x0176, 0x016D,
+    0x016F, 0x0177, 0x016F, 0x0177, 0x0173, 0x0178, 0x0179, 0x017A, 0x017B, 0x0174, 0x057A, 0x017C, 0x016A, 0x0166, 0x017D, 0x017E,
+    0x0166, 0x0166, 0x017E, 0x017E, 0x0166, 0x056A, 0x017E, 0x057D, 0x0176, 0x017F, 0x0180, 0x0181, 0x0182, 0x0177, 0x0581, 0x0183,
+    0x0184, 0x0185, 0x0186, 0x0187, 0x0188, 0x0189, 0x0173, 0x0164, 0x018A, 0x018B, 0x018C, 0x098B, 0x018D, 0x0000, 0x018E, 0x018F,
+    0x018D, 0x0000, 0x0190, 0x0000, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198,
 };
 
 extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75,
-    32, 32, 32, 32, 32, 75, 42, 42, 32, 32, 32, 32, 75, 42, 48, 48, 32, 32, 32, 75, 42, 48, 27, 27, 32, 32, 32, 75, 42, 27, 27, 27,
+    32, 32, 32, 32, 32, 75, 42, 42, 32, 32, 32, 32, 75, 42, 48, 48, 32, 32, 32, 75, 42, 48, 28, 28, 32, 32, 32, 75, 42, 28, 28, 28,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48, 48, 48,
-    48, 48, 48, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 75, 42, 48, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29,
-    32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29,
+    48, 48, 48, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    32, 32, 75, 42, 48, 28, 28, 29, 32, 32, 75, 42, 28, 28, 28, 29, 32, 32, 75, 42, 28, 28, 28, 29, 32, 32, 75, 42, 28, 28, 28, 29,
+    32, 75, 42, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48, 48,
-    48, 48, 48, 48, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48, 48,
-    48, 48, 48, 48, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    48, 48, 48, 48, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 75, 75, 75, 32, 32, 32, 42, 42, 42, 42, 42, 75, 75, 75, 48, 48, 48, 48, 48, 42, 42, 42,
-    27, 27, 27, 27, 27, 48, 48, 48, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32,
-    42, 42, 75, 32, 32, 32, 32, 32, 48, 48, 42, 75, 32, 32, 32, 32, 27, 27, 48, 42, 75, 32, 32, 32, 27, 27, 27, 42, 75, 32, 32, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 27, 27, 48, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32,
-    29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 32, 32, 32, 32, 32, 32, 34, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 32, 32, 32,
@@ -505,86 +317,60 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 34, 32, 32, 32, 32, 32,
     34, 34, 34, 32, 32, 32, 32, 32, 34, 34, 34, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    71, 71, 71, 71, 24, 24, 24, 24, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6,
+    71, 71, 71, 71, 25, 25, 25, 25, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6,
     69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6,
-    71, 71, 71, 71, 24, 24, 24, 24, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6,
-    69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6,
-    70, 70, 70, 70, 9, 9, 9, 9, 71, 71, 71, 71, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    70, 70, 70, 70, 9, 9, 9, 9, 71, 71, 71, 71, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    70, 70, 70, 70, 9, 9, 9, 9, 71, 71, 71, 71, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75,
-    0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 75, 21, 21, 21, 21, 0, 0, 75, 21, 45, 45, 45, 45,
+    0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 75, 22, 22, 22, 22, 0, 0, 75, 22, 45, 45, 45, 45,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0,
-    21, 75, 0, 0, 0, 0, 0, 0, 45, 75, 75, 75, 75, 75, 0, 0, 21, 21, 21, 21, 21, 75, 0, 0, 45, 45, 45, 45, 45, 75, 0, 0,
-    0, 75, 21, 45, 45, 45, 45, 45, 0, 0, 75, 45, 45, 45, 45, 45, 0, 0, 0, 75, 45, 45, 45, 45, 0, 0, 0, 0, 75, 75, 75, 75,
+    22, 75, 0, 0, 0, 0, 0, 0, 45, 75, 75, 75, 75, 75, 0, 0, 22, 22, 22, 22, 22, 75, 0, 0, 45, 45, 45, 45, 45, 75, 0, 0,
+    0, 75, 22, 45, 45, 45, 45, 45, 0, 0, 75, 45, 45, 45, 45, 45, 0, 0, 0, 75, 45, 45, 45, 45, 0, 0, 0, 0, 75, 75, 75, 75,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75,
     45, 45, 45, 45, 45, 75, 0, 0, 45, 45, 45, 45, 45, 75, 0, 0, 45, 45, 45, 45, 45, 75, 0, 0, 45, 75, 75, 75, 75, 75, 0, 0,
     45, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75,
-    0, 0, 0, 0, 0, 0, 75, 21, 0, 0, 75, 75, 75, 75, 75, 45, 0, 0, 75, 21, 21, 21, 21, 21, 0, 0, 75, 45, 45, 45, 45, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0,
-    75, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 21, 21, 21, 21, 75, 0, 0, 0, 45, 45, 45, 45, 21, 75, 0, 0,
-    0, 0, 75, 45, 45, 45, 45, 45, 0, 0, 75, 45, 45, 45, 45, 45, 0, 0, 75, 45, 45, 45, 45, 45, 0, 0, 75, 75, 75, 75, 75, 45,
-    0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45,
-    45, 45, 45, 45, 45, 21, 75, 0, 45, 45, 45, 45, 45, 75, 0, 0, 45, 45, 45, 45, 75, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0,
-    75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 75, 21, 21, 21, 21, 0, 0, 0, 75, 21, 21, 21, 21,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0, 21, 21, 21, 75, 0, 0, 0, 0, 21, 45, 21, 75, 0, 0, 0, 0,
-    0, 0, 0, 75, 45, 21, 21, 21, 0, 0, 0, 75, 25, 45, 45, 45, 0, 0, 0, 75, 45, 25, 25, 25, 0, 0, 0, 75, 45, 45, 45, 45,
-    0, 0, 0, 75, 45, 45, 45, 45, 0, 0, 0, 75, 25, 45, 45, 45, 0, 0, 0, 75, 45, 25, 25, 25, 0, 0, 0, 0, 75, 45, 45, 45,
-    21, 21, 45, 75, 0, 0, 0, 0, 45, 45, 25, 75, 0, 0, 0, 0, 25, 25, 45, 75, 0, 0, 0, 0, 45, 45, 45, 75, 0, 0, 0, 0,
-    45, 45, 45, 75, 0, 0, 0, 0, 45, 45, 25, 75, 0, 0, 0, 0, 25, 25, 45, 75, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 75, 75, 21, 21, 21, 0, 0, 75, 21, 21, 45, 45, 45,
-    0, 0, 75, 45, 45, 75, 75, 75, 0, 75, 21, 45, 75, 86, 76, 86, 0, 75, 45, 45, 75, 86, 76, 86, 0, 75, 45, 45, 75, 75, 75, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0, 21, 21, 21, 75, 75, 0, 0, 0, 45, 45, 45, 21, 21, 75, 0, 0,
-    75, 75, 75, 45, 45, 75, 0, 0, 86, 76, 86, 75, 45, 21, 75, 0, 86, 76, 86, 75, 45, 45, 75, 0, 75, 75, 75, 75, 45, 45, 75, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 75, 22, 22, 22, 22, 0, 0, 0, 75, 22, 22, 22, 22,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0, 22, 22, 22, 75, 0, 0, 0, 0, 22, 45, 22, 75, 0, 0, 0, 0,
+    0, 0, 0, 75, 45, 22, 22, 22, 0, 0, 0, 75, 26, 45, 45, 45, 0, 0, 0, 75, 45, 26, 26, 26, 0, 0, 0, 75, 45, 45, 45, 45,
+    0, 0, 0, 75, 45, 45, 45, 45, 0, 0, 0, 75, 26, 45, 45, 45, 0, 0, 0, 75, 45, 26, 26, 26, 0, 0, 0, 0, 75, 45, 45, 45,
+    22, 22, 45, 75, 0, 0, 0, 0, 45, 45, 26, 75, 0, 0, 0, 0, 26, 26, 45, 75, 0, 0, 0, 0, 45, 45, 45, 75, 0, 0, 0, 0,
+    45, 45, 45, 75, 0, 0, 0, 0, 45, 45, 26, 75, 0, 0, 0, 0, 26, 26, 45, 75, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 75, 75, 22, 22, 22, 0, 0, 75, 22, 22, 45, 45, 45,
+    0, 0, 75, 45, 45, 75, 75, 75, 0, 75, 22, 45, 75, 86, 76, 86, 0, 75, 45, 45, 75, 86, 76, 86, 0, 75, 45, 45, 75, 75, 75, 75,
     0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45,
     0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 75, 75, 75, 75, 75, 75,
-    45, 45, 45, 45, 45, 45, 75, 0, 45, 45, 45, 45, 21, 45, 75, 0, 45, 45, 45, 45, 75, 45, 75, 0, 45, 45, 45, 45, 21, 45, 75, 0,
-    45, 45, 45, 45, 21, 45, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0, 75, 75, 75, 75, 75, 75, 75, 0,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    45, 45, 45, 45, 45, 45, 75, 0, 45, 45, 45, 45, 22, 45, 75, 0, 45, 45, 45, 45, 75, 45, 75, 0, 45, 45, 45, 45, 22, 45, 75, 0,
+    45, 45, 45, 45, 22, 45, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0, 75, 75, 75, 75, 75, 75, 75, 0,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 29, 29, 29, 29, 27, 27, 27, 27, 29, 29, 29, 27, 27, 27, 27, 27,
-    29, 29, 27, 27, 27, 27, 27, 42, 29, 29, 27, 27, 27, 27, 42, 75, 29, 27, 27, 27, 27, 42, 75, 32, 29, 27, 27, 27, 42, 75, 32, 32,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 29, 29, 29, 29,
-    27, 27, 27, 27, 27, 29, 29, 29, 42, 27, 27, 27, 27, 27, 29, 29, 75, 42, 27, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 27, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 29, 29, 29, 29, 28, 28, 28, 28, 29, 29, 29, 28, 28, 28, 28, 28,
+    29, 29, 28, 28, 28, 28, 28, 42, 29, 29, 28, 28, 28, 28, 42, 75, 29, 28, 28, 28, 28, 42, 75, 32, 29, 28, 28, 28, 42, 75, 32, 32,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29,
-    32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29,
+    29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 29, 29, 29, 29,
+    28, 28, 28, 28, 28, 29, 29, 29, 42, 28, 28, 28, 28, 28, 29, 29, 75, 42, 28, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 28, 29,
+    32, 32, 75, 42, 28, 28, 28, 29, 32, 32, 75, 42, 28, 28, 28, 29, 32, 32, 75, 42, 28, 28, 28, 29, 32, 32, 75, 42, 28, 28, 28, 29,
+    32, 75, 42, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 29, 29, 32, 75, 42, 28, 28, 28, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29,
-    32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32,
-    29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32,
-    29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32,
+    29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 32, 32, 32, 32,
@@ -593,180 +379,90 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
     32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    71, 71, 71, 71, 71, 24, 24, 24, 71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6,
+    71, 71, 71, 71, 71, 25, 25, 25, 71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6,
     71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6, 71, 69, 69, 69, 69, 6, 6, 6,
-    24, 71, 71, 71, 71, 24, 24, 24, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6,
+    25, 71, 71, 71, 71, 25, 25, 25, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6,
     6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6, 6, 69, 69, 69, 69, 6, 6, 6,
-    71, 70, 70, 70, 70, 9, 9, 9, 71, 71, 71, 71, 71, 24, 24, 24, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    71, 70, 70, 70, 70, 9, 9, 9, 71, 71, 71, 71, 71, 25, 25, 25, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
     75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    9, 70, 70, 70, 70, 9, 9, 9, 24, 71, 71, 71, 71, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 70, 70, 70, 70, 9, 9, 9, 25, 71, 71, 71, 71, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 0, 75, 21, 21, 21, 21, 21, 21, 0, 75, 45, 45, 45, 45, 45, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 0, 75, 22, 22, 22, 22, 22, 22, 0, 75, 45, 45, 45, 45, 45, 45,
     0, 75, 45, 75, 75, 75, 75, 75, 0, 75, 45, 75, 86, 86, 76, 86, 0, 75, 45, 75, 86, 86, 76, 86, 0, 75, 45, 75, 75, 75, 75, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 0, 0, 21, 21, 21, 21, 21, 21, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0,
-    75, 75, 75, 75, 75, 45, 75, 0, 86, 76, 86, 86, 75, 45, 75, 0, 86, 76, 86, 86, 75, 45, 75, 0, 75, 75, 75, 75, 75, 45, 75, 0,
-    0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45,
-    0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 0, 75, 75, 75, 75, 75, 75, 75,
-    45, 45, 45, 45, 45, 45, 75, 0, 45, 45, 45, 45, 21, 45, 75, 0, 45, 45, 45, 45, 75, 45, 75, 0, 45, 45, 45, 45, 21, 45, 75, 0,
-    45, 45, 45, 45, 21, 45, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0, 45, 45, 45, 45, 45, 45, 75, 0, 75, 75, 75, 75, 75, 75, 75, 0,
-    32, 75, 42, 27, 27, 27, 29, 29, 75, 42, 27, 27, 27, 29, 29, 29, 42, 27, 27, 27, 27, 29, 29, 29, 27, 27, 27, 27, 29, 29, 29, 29,
-    27, 27, 27, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29, 32, 75, 42, 27, 27, 27, 29, 29,
-    32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29, 32, 32, 75, 42, 27, 27, 27, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    32, 32, 32, 75, 42, 27, 27, 27, 32, 32, 32, 75, 42, 27, 27, 27, 32, 32, 32, 32, 75, 42, 27, 27, 32, 32, 32, 32, 32, 75, 42, 42,
+    32, 75, 42, 28, 28, 28, 29, 29, 75, 42, 28, 28, 28, 29, 29, 29, 42, 28, 28, 28, 28, 29, 29, 29, 28, 28, 28, 28, 29, 29, 29, 29,
+    28, 28, 28, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    32, 32, 32, 75, 42, 28, 28, 28, 32, 32, 32, 75, 42, 28, 28, 28, 32, 32, 32, 32, 75, 42, 28, 28, 32, 32, 32, 32, 32, 75, 42, 42,
     32, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 29, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    42, 42, 42, 27, 27, 27, 27, 27, 75, 75, 75, 42, 42, 42, 42, 42, 32, 32, 32, 75, 75, 75, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 29, 29, 29, 29, 29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    42, 42, 42, 28, 28, 28, 28, 28, 75, 75, 75, 42, 42, 42, 42, 42, 32, 32, 32, 75, 75, 75, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    42, 42, 42, 42, 27, 27, 27, 27, 75, 75, 75, 75, 42, 42, 42, 42, 32, 32, 32, 32, 75, 75, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    42, 42, 42, 42, 27, 27, 27, 27, 75, 75, 75, 75, 42, 42, 42, 42, 32, 32, 32, 32, 75, 75, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32, 29, 29, 27, 27, 27, 42, 75, 32,
-    29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32, 29, 27, 27, 27, 42, 75, 32, 32,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
-    27, 27, 27, 27, 27, 42, 42, 42, 42, 42, 42, 42, 42, 75, 75, 75, 75, 75, 75, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-    27, 27, 27, 42, 75, 32, 32, 32, 27, 27, 27, 42, 75, 32, 32, 32, 27, 27, 42, 75, 32, 32, 32, 32, 42, 42, 75, 32, 32, 32, 32, 32,
-    75, 75, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 29, 29, 29, 29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    42, 42, 42, 42, 28, 28, 28, 28, 75, 75, 75, 75, 42, 42, 42, 42, 32, 32, 32, 32, 75, 75, 75, 75, 32, 32, 32, 32, 32, 32, 32, 32,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 81, 81, 81, 81, 81,
     81, 40, 40, 40, 61, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 81, 81, 81, 81, 0, 0, 0,
-    40, 61, 40, 40, 81, 24, 24, 9, 40, 40, 40, 40, 40, 6, 6, 24, 40, 40, 40, 40, 40, 6, 6, 24, 40, 40, 40, 40, 40, 6, 6, 24,
+    40, 61, 40, 40, 81, 25, 25, 9, 40, 40, 40, 40, 40, 6, 6, 25, 40, 40, 40, 40, 40, 6, 6, 25, 40, 40, 40, 40, 40, 6, 6, 25,
     81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 61, 40, 40, 40,
     81, 61, 61, 61, 61, 61, 61, 61, 0, 81, 81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    40, 40, 40, 40, 40, 6, 6, 24, 40, 40, 40, 40, 40, 6, 6, 24, 40, 40, 40, 40, 40, 6, 6, 24, 40, 61, 40, 40, 40, 9, 9, 24,
-    61, 61, 61, 61, 81, 24, 24, 9, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    40, 40, 40, 40, 40, 6, 6, 25, 40, 40, 40, 40, 40, 6, 6, 25, 40, 40, 40, 40, 40, 6, 6, 25, 40, 61, 40, 40, 40, 9, 9, 25,
+    61, 61, 61, 61, 81, 25, 25, 9, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0, 54, 5, 5, 5, 5, 5, 5, 0, 54, 5, 5, 4, 4, 4, 4,
-    0, 54, 5, 5, 7, 7, 7, 7, 0, 54, 5, 5, 27, 27, 27, 27, 0, 54, 5, 5, 27, 27, 27, 27, 0, 54, 5, 5, 27, 27, 29, 29,
-    0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
-    7, 7, 7, 7, 7, 7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
-    7, 7, 7, 7, 7, 7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
-    7, 7, 7, 7, 7, 7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    0, 54, 5, 5, 7, 7, 7, 7, 0, 54, 5, 5, 28, 28, 28, 28, 0, 54, 5, 5, 28, 28, 28, 28, 0, 54, 5, 5, 28, 28, 29, 29,
     0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 54, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
-    7, 7, 7, 7, 7, 7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54, 54, 0, 5, 5, 5, 5, 5, 5, 54, 0, 4, 4, 4, 4, 5, 5, 54, 0,
-    7, 7, 7, 7, 5, 5, 54, 0, 27, 27, 27, 27, 5, 5, 54, 0, 27, 27, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29,
+    0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29,
+    0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 84, 0, 0, 0, 0, 0, 0, 44, 65,
-    0, 0, 0, 0, 0, 0, 44, 17, 75, 75, 75, 75, 75, 75, 44, 17, 21, 21, 21, 21, 21, 44, 17, 17, 21, 21, 21, 21, 21, 24, 6, 6,
+    0, 0, 0, 0, 0, 0, 44, 17, 75, 75, 75, 75, 75, 75, 44, 17, 22, 22, 22, 22, 22, 44, 17, 17, 22, 22, 22, 22, 22, 25, 6, 6,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 84, 84, 0, 0, 0, 0, 84, 60, 65, 60, 0, 0, 0, 0, 44, 60, 31, 60, 0, 0, 0, 0,
-    44, 60, 31, 60, 0, 0, 0, 0, 44, 31, 31, 31, 60, 75, 75, 75, 17, 44, 6, 6, 24, 21, 21, 21, 6, 24, 31, 31, 60, 21, 21, 21,
-    21, 21, 21, 21, 21, 44, 17, 17, 21, 21, 21, 21, 21, 44, 44, 44, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45,
+    44, 60, 31, 60, 0, 0, 0, 0, 44, 31, 31, 31, 60, 75, 75, 75, 17, 44, 6, 6, 25, 22, 22, 22, 6, 25, 31, 31, 60, 22, 22, 22,
+    22, 22, 22, 22, 22, 44, 17, 17, 22, 22, 22, 22, 22, 44, 44, 44, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45,
     75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    17, 44, 60, 60, 60, 21, 21, 21, 44, 44, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45,
+    17, 44, 60, 60, 60, 22, 22, 22, 44, 44, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45,
     75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 29, 29, 0, 54, 5, 5, 27, 27, 27, 27, 0, 54, 5, 5, 5, 5, 5, 5,
+    0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 29, 29, 0, 54, 5, 5, 28, 28, 28, 28, 0, 54, 5, 5, 5, 5, 5, 5,
     0, 54, 4, 4, 4, 4, 4, 4, 0, 54, 7, 7, 7, 7, 7, 7, 0, 54, 7, 7, 7, 7, 7, 7, 0, 54, 54, 54, 54, 54, 54, 54,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 5, 5, 5, 5, 5, 5, 5, 5,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 28, 28, 28, 28, 5, 5, 5, 5, 5, 5, 5, 5,
     4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 54, 54, 54, 54, 54, 54, 54, 54,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 54, 54, 54, 54, 54, 54, 54, 54,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 54, 54, 54, 54, 54, 54, 54, 54,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0,
-    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 27, 27, 27, 27, 27, 27, 27, 27, 5, 5, 5, 5, 5, 5, 5, 5,
-    4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 54, 54, 54, 54, 54, 54, 54, 54,
-    29, 29, 27, 27, 5, 5, 54, 0, 29, 29, 27, 27, 5, 5, 54, 0, 27, 27, 27, 27, 5, 5, 54, 0, 5, 5, 5, 5, 5, 5, 54, 0,
-    4, 4, 4, 4, 4, 4, 54, 0, 7, 7, 7, 7, 7, 7, 54, 0, 7, 7, 7, 7, 7, 7, 54, 0, 54, 54, 54, 54, 54, 54, 54, 0,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    75, 45, 75, 0, 0, 0, 0, 60, 75, 45, 75, 75, 75, 75, 60, 31, 75, 45, 75, 21, 21, 79, 31, 31, 75, 45, 75, 21, 21, 79, 31, 31,
+    75, 45, 75, 0, 0, 0, 0, 60, 75, 45, 75, 75, 75, 75, 60, 31, 75, 45, 75, 22, 22, 79, 31, 31, 75, 45, 75, 22, 22, 79, 31, 31,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    60, 0, 0, 0, 0, 0, 0, 0, 31, 60, 84, 84, 84, 75, 75, 75, 31, 31, 65, 65, 74, 84, 21, 21, 31, 31, 74, 65, 65, 84, 21, 21,
-    75, 45, 75, 21, 21, 79, 51, 51, 75, 45, 75, 21, 21, 21, 79, 79, 75, 45, 75, 21, 21, 21, 21, 21, 75, 45, 45, 45, 45, 45, 45, 45,
+    60, 0, 0, 0, 0, 0, 0, 0, 31, 60, 84, 84, 84, 75, 75, 75, 31, 31, 65, 65, 74, 84, 22, 22, 31, 31, 74, 65, 65, 84, 22, 22,
+    75, 45, 75, 22, 22, 79, 51, 51, 75, 45, 75, 22, 22, 22, 79, 79, 75, 45, 75, 22, 22, 22, 22, 22, 75, 45, 45, 45, 45, 45, 45, 45,
     75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    51, 51, 51, 51, 51, 79, 21, 21, 79, 79, 79, 79, 79, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45,
+    51, 51, 51, 51, 51, 79, 22, 22, 79, 79, 79, 79, 79, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45,
     75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 75, 75, 75, 75, 75, 21, 75, 75, 21, 21, 21, 21, 75, 45, 75, 21, 45, 86, 86, 45,
-    75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 15, 45, 21, 21, 21, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 75, 0, 21, 21, 21, 21, 75, 75, 21, 75, 45, 86, 86, 45, 21, 75, 45, 75,
-    45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 21, 21, 21, 45, 15, 45, 75,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 75, 75, 75, 75, 75, 22, 75, 75, 22, 22, 22, 22, 75, 45, 75, 22, 45, 86, 86, 45,
+    75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 15, 45, 22, 22, 22, 45,
     75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45,
-    75, 45, 15, 45, 86, 86, 86, 45, 75, 45, 75, 45, 21, 21, 21, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
-    45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75,
-    45, 86, 86, 86, 45, 15, 45, 75, 45, 21, 21, 21, 45, 75, 45, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 21, 75, 75, 75, 75, 75, 75, 75, 45, 75, 21, 21, 21, 21, 21,
-    75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 15, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 21, 21, 21, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 75, 75, 75, 75, 75, 75, 21, 75, 21, 21, 21, 21, 21, 75, 45, 75,
-    45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 15, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 21, 21, 21, 45, 75, 45, 75,
+    75, 45, 15, 45, 86, 86, 86, 45, 75, 45, 75, 45, 22, 22, 22, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 22, 75, 75, 75, 75, 75, 75, 75, 45, 75, 22, 22, 22, 22, 22,
+    75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 15, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 22, 22, 22, 45,
     75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 15, 45, 86, 86, 86, 45,
-    75, 45, 75, 45, 21, 21, 21, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 75, 45, 75, 45, 86, 86, 86, 45, 15, 45, 75,
-    45, 21, 21, 21, 45, 75, 45, 75, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 21, 0, 0, 0, 0, 0, 0, 75, 45,
+    75, 45, 75, 45, 22, 22, 22, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 22, 0, 0, 0, 0, 0, 0, 75, 45,
     0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45,
     75, 75, 75, 75, 75, 75, 45, 45, 75, 86, 76, 86, 86, 75, 45, 45, 75, 75, 75, 75, 75, 75, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
     0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45,
     0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 75,
-    45, 45, 45, 45, 45, 21, 45, 45, 45, 45, 45, 45, 45, 75, 45, 45, 45, 45, 45, 45, 45, 21, 45, 45, 45, 45, 45, 45, 45, 21, 45, 45,
+    45, 45, 45, 45, 45, 22, 45, 45, 45, 45, 45, 45, 45, 75, 45, 45, 45, 45, 45, 45, 45, 22, 45, 45, 45, 45, 45, 45, 45, 22, 45, 45,
     45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 21, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45,
-    21, 45, 45, 75, 75, 75, 75, 75, 21, 45, 45, 75, 86, 86, 76, 86, 21, 45, 45, 75, 75, 75, 75, 75, 21, 45, 45, 45, 45, 45, 45, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0, 21, 21, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 22, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45,
+    22, 45, 45, 75, 75, 75, 75, 75, 22, 45, 45, 75, 86, 86, 76, 86, 22, 45, 45, 75, 75, 75, 75, 75, 22, 45, 45, 45, 45, 45, 45, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0, 22, 22, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
     75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
-    21, 45, 21, 45, 45, 45, 45, 45, 21, 45, 75, 45, 45, 45, 45, 45, 21, 45, 21, 45, 45, 45, 45, 45, 21, 45, 21, 45, 45, 45, 45, 45,
-    21, 45, 45, 45, 45, 45, 45, 45, 21, 45, 45, 45, 45, 45, 45, 45, 21, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75,
+    22, 45, 22, 45, 45, 45, 45, 45, 22, 45, 75, 45, 45, 45, 45, 45, 22, 45, 22, 45, 45, 45, 45, 45, 22, 45, 22, 45, 45, 45, 45, 45,
+    22, 45, 45, 45, 45, 45, 45, 45, 22, 45, 45, 45, 45, 45, 45, 45, 22, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75,
     45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
     45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48, 48,
@@ -803,12 +499,8 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 66, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 80, 0, 0, 0, 80, 52, 52, 52, 52, 0, 0, 0, 80, 52, 77, 77, 77,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 80, 80, 0, 0, 0, 0, 52, 52, 52, 52, 80, 0, 0, 0, 77, 77, 77, 52, 80, 0, 0, 0,
     0, 0, 0, 80, 52, 77, 37, 37, 0, 0, 0, 80, 77, 52, 52, 52, 0, 0, 0, 80, 80, 77, 77, 77, 0, 0, 0, 80, 77, 80, 77, 77,
     0, 0, 0, 80, 77, 77, 80, 80, 0, 0, 0, 80, 77, 77, 77, 77, 0, 0, 0, 80, 77, 77, 77, 77, 0, 0, 0, 0, 80, 77, 77, 77,
-    37, 37, 77, 52, 80, 0, 0, 0, 52, 52, 52, 77, 80, 0, 0, 0, 77, 77, 77, 80, 80, 0, 0, 0, 77, 77, 80, 77, 80, 0, 0, 0,
-    80, 80, 77, 77, 80, 0, 0, 0, 77, 77, 77, 77, 80, 0, 0, 0, 77, 77, 77, 77, 80, 0, 0, 0, 77, 77, 77, 80, 0, 0, 0, 0,
     0, 54, 5, 5, 35, 35, 35, 35, 0, 54, 5, 5, 35, 35, 35, 35, 0, 54, 5, 5, 35, 35, 35, 35, 0, 54, 5, 5, 35, 72, 72, 72,
     0, 54, 5, 5, 35, 72, 69, 72, 0, 54, 5, 72, 72, 71, 69, 71, 0, 54, 5, 72, 69, 69, 17, 69, 0, 54, 60, 60, 60, 72, 69, 72,
     35, 35, 35, 35, 35, 35, 35, 35, 35, 72, 72, 72, 35, 35, 35, 35, 35, 72, 69, 72, 35, 35, 35, 35, 72, 71, 69, 71, 72, 72, 35, 35,
@@ -857,8 +549,6 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     0, 75, 75, 75, 75, 48, 42, 42, 0, 0, 0, 75, 48, 48, 48, 75, 0, 0, 0, 75, 42, 42, 75, 0, 0, 0, 0, 75, 75, 75, 0, 0,
     69, 69, 69, 71, 0, 0, 0, 0, 10, 69, 69, 71, 75, 75, 0, 0, 69, 69, 69, 71, 48, 75, 0, 0, 69, 69, 71, 42, 42, 75, 0, 0,
     42, 48, 75, 75, 75, 75, 0, 0, 48, 48, 48, 75, 0, 0, 0, 0, 75, 42, 42, 75, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 21, 0, 0, 0, 0, 0, 0, 75, 45,
-    0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 75, 85, 86, 86, 86, 86, 86, 86, 75, 86, 86, 86, 86, 86, 86, 86,
     75, 86, 86, 86, 86, 86, 86, 86, 75, 86, 86, 86, 86, 86, 86, 86, 75, 86, 86, 86, 86, 86, 86, 86, 75, 86, 86, 86, 86, 86, 86, 86,
     0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 75, 75, 45, 0, 0, 0, 0, 0, 75, 75, 45, 0, 0, 0, 0, 0, 0, 75, 45,
@@ -867,7 +557,7 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     75, 86, 86, 86, 86, 86, 86, 86, 75, 86, 86, 86, 86, 86, 86, 86, 75, 86, 86, 86, 86, 86, 86, 86, 75, 85, 85, 85, 85, 85, 85, 85,
     0, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 0, 86, 86, 86, 86, 86, 86, 86, 85, 86, 86, 86, 86, 86, 86, 86, 86,
     86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0, 75, 21, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0, 75, 22, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
     75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
     86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
     86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 85, 85, 85, 85, 85, 85, 85, 85,
@@ -889,14 +579,10 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     48, 48, 48, 66, 48, 48, 48, 48, 42, 48, 48, 48, 48, 48, 48, 48, 75, 42, 48, 48, 48, 48, 48, 66, 0, 75, 42, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75,
-    0, 0, 0, 0, 0, 75, 42, 42, 0, 0, 0, 0, 75, 42, 48, 48, 0, 0, 0, 75, 42, 48, 48, 48, 0, 0, 0, 75, 42, 48, 48, 48,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48,
     0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 66, 66,
     0, 75, 42, 48, 48, 48, 66, 66, 0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 75, 75, 75, 42, 75, 75, 75, 75, 42, 42, 42, 48, 42, 42, 42, 42, 48, 48, 48,
@@ -907,12 +593,8 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 0, 0, 0, 42, 42, 42, 42, 42, 75, 75, 75, 48, 48, 48, 48, 48, 42, 42, 42,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 66, 48, 66, 48, 48, 48, 48, 66, 66,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0,
-    42, 42, 75, 0, 0, 0, 0, 0, 48, 48, 42, 75, 0, 0, 0, 0, 48, 48, 48, 42, 75, 0, 0, 0, 48, 48, 48, 42, 75, 0, 0, 0,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0,
-    48, 48, 48, 48, 48, 42, 75, 0, 48, 48, 48, 48, 48, 42, 75, 0, 48, 48, 48, 48, 48, 42, 75, 0, 48, 48, 48, 48, 48, 42, 75, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 0, 0, 58, 58, 33, 33, 33, 33, 0, 58, 33, 33, 33, 33, 33, 33,
     0, 58, 33, 33, 35, 57, 57, 35, 58, 33, 35, 57, 35, 57, 57, 35, 58, 33, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 57, 35, 35, 35,
     0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 0, 0, 0, 0, 33, 33, 33, 33, 58, 58, 0, 0, 33, 33, 33, 33, 33, 33, 58, 0,
@@ -923,67 +605,45 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     58, 58, 58, 58, 58, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 0, 0, 58, 58, 33, 33, 33, 33, 0, 58, 33, 33, 33, 33, 33, 33,
     0, 58, 33, 33, 35, 62, 62, 35, 58, 33, 35, 69, 35, 69, 69, 35, 58, 33, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 69, 35, 35, 35,
-    0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 0, 0, 0, 0, 33, 33, 33, 33, 58, 58, 0, 0, 33, 33, 33, 33, 33, 33, 58, 0,
-    35, 35, 35, 35, 33, 33, 58, 0, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 35, 58,
-    58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 0, 58, 58, 35, 35, 35, 35, 35,
-    0, 0, 0, 58, 58, 58, 58, 58, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
     35, 35, 35, 35, 35, 69, 35, 58, 35, 35, 35, 69, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 58, 58, 0,
     58, 58, 58, 58, 58, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 0, 0, 0, 0, 58, 33, 33, 33,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 0, 0, 0, 0, 0, 33, 33, 33, 58, 0, 0, 0, 0,
     0, 0, 0, 58, 33, 35, 35, 35, 0, 0, 58, 33, 35, 35, 35, 35, 0, 0, 58, 35, 35, 57, 35, 35, 0, 0, 58, 35, 35, 35, 35, 35,
     0, 0, 58, 35, 35, 35, 35, 57, 0, 0, 58, 35, 35, 35, 35, 35, 0, 0, 0, 58, 35, 57, 35, 35, 0, 0, 0, 0, 58, 35, 35, 35,
     35, 35, 35, 33, 58, 0, 0, 0, 35, 57, 35, 35, 33, 58, 0, 0, 35, 35, 35, 35, 35, 58, 0, 0, 35, 35, 35, 35, 35, 58, 0, 0,
     35, 35, 35, 57, 35, 58, 0, 0, 35, 35, 35, 35, 35, 58, 0, 0, 35, 35, 35, 35, 58, 0, 0, 0, 35, 35, 35, 58, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 0, 0, 0, 0, 0, 0, 67, 21, 67, 0, 0, 0, 0, 0, 0, 67, 48, 67, 67,
-    67, 67, 0, 0, 0, 67, 21, 21, 67, 48, 67, 0, 0, 67, 48, 48, 0, 67, 21, 67, 0, 67, 48, 48, 0, 67, 48, 67, 67, 67, 48, 48,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 0, 0, 0, 0, 67, 48, 21, 67, 0, 0, 0, 67, 48, 67, 67, 0, 0, 0, 0,
-    21, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 67, 67, 0,
-    0, 67, 48, 21, 21, 21, 48, 48, 0, 0, 67, 48, 48, 48, 48, 48, 0, 0, 0, 67, 67, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 0, 0, 0, 0, 0, 0, 67, 22, 67, 0, 0, 0, 0, 0, 0, 67, 48, 67, 67,
+    67, 67, 0, 0, 0, 67, 22, 22, 67, 48, 67, 0, 0, 67, 48, 48, 0, 67, 22, 67, 0, 67, 48, 48, 0, 67, 48, 67, 67, 67, 48, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 0, 0, 0, 0, 67, 48, 22, 67, 0, 0, 0, 67, 48, 67, 67, 0, 0, 0, 0,
+    22, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 67, 67, 0,
+    0, 67, 48, 22, 22, 22, 48, 48, 0, 0, 67, 48, 48, 48, 48, 48, 0, 0, 0, 67, 67, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
     0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
-    48, 67, 0, 0, 67, 21, 67, 0, 48, 67, 0, 67, 21, 67, 0, 0, 48, 67, 0, 67, 48, 67, 0, 0, 48, 67, 67, 67, 48, 67, 0, 0,
-    48, 21, 21, 21, 48, 67, 0, 0, 48, 48, 48, 48, 67, 0, 0, 0, 48, 67, 67, 67, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 67, 0, 0, 67, 22, 67, 0, 48, 67, 0, 67, 22, 67, 0, 0, 48, 67, 0, 67, 48, 67, 0, 0, 48, 67, 67, 67, 48, 67, 0, 0,
+    48, 22, 22, 22, 48, 67, 0, 0, 48, 48, 48, 48, 67, 0, 0, 0, 48, 67, 67, 67, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 83, 83, 82, 0, 0, 0, 0, 0, 83, 38, 38,
     0, 0, 0, 0, 60, 60, 60, 83, 0, 0, 0, 0, 60, 35, 35, 83, 0, 0, 0, 0, 0, 60, 35, 35, 0, 0, 0, 0, 0, 0, 60, 60,
     83, 83, 0, 0, 0, 0, 0, 0, 38, 83, 0, 0, 0, 0, 0, 0, 38, 82, 83, 83, 0, 0, 0, 0, 17, 38, 38, 83, 0, 0, 0, 0,
     38, 83, 60, 60, 60, 0, 0, 0, 38, 83, 35, 35, 60, 0, 0, 0, 35, 35, 35, 60, 0, 0, 0, 0, 35, 60, 60, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 72, 72, 71, 0, 0, 0, 0, 0, 72, 69, 69,
     0, 0, 0, 0, 60, 60, 60, 72, 0, 0, 0, 0, 60, 35, 35, 72, 0, 0, 0, 0, 0, 60, 35, 35, 0, 0, 0, 0, 0, 0, 60, 60,
     72, 72, 0, 0, 0, 0, 0, 0, 69, 72, 0, 0, 0, 0, 0, 0, 69, 71, 72, 72, 0, 0, 0, 0, 17, 69, 69, 72, 0, 0, 0, 0,
     69, 72, 60, 60, 60, 0, 0, 0, 69, 72, 35, 35, 60, 0, 0, 0, 35, 35, 35, 60, 0, 0, 0, 0, 35, 60, 60, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 4, 4, 4, 4,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 0, 5, 5, 5, 5, 54, 0, 0, 0, 4, 4, 4, 4, 54, 0, 0, 0,
-    0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 26, 0, 0, 0, 54, 7, 7, 26, 26, 0, 0, 0, 54, 7, 7, 7, 26,
-    0, 0, 0, 54, 7, 7, 7, 26, 0, 0, 0, 54, 7, 7, 7, 26, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7,
-    7, 7, 7, 7, 54, 0, 0, 0, 26, 7, 7, 7, 54, 0, 0, 0, 26, 26, 7, 7, 54, 0, 0, 0, 26, 7, 7, 7, 54, 0, 0, 0,
-    26, 7, 7, 7, 54, 0, 0, 0, 26, 7, 7, 7, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0,
+    0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 27, 0, 0, 0, 54, 7, 7, 27, 27, 0, 0, 0, 54, 7, 7, 7, 27,
+    0, 0, 0, 54, 7, 7, 7, 27, 0, 0, 0, 54, 7, 7, 7, 27, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54,
     0, 0, 0, 0, 54, 5, 5, 5, 0, 0, 0, 54, 5, 4, 4, 4, 0, 0, 0, 54, 4, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 0, 0, 0, 0, 0,
-    5, 5, 5, 54, 0, 0, 0, 0, 4, 4, 4, 5, 54, 0, 0, 0, 7, 7, 7, 4, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0,
-    0, 0, 0, 54, 7, 7, 7, 26, 0, 0, 0, 54, 7, 7, 26, 26, 0, 0, 0, 54, 7, 7, 7, 26, 0, 0, 0, 54, 7, 7, 7, 26,
-    0, 0, 0, 54, 7, 7, 7, 26, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7,
-    26, 7, 7, 7, 54, 0, 0, 0, 26, 26, 7, 7, 54, 0, 0, 0, 26, 7, 7, 7, 54, 0, 0, 0, 26, 7, 7, 7, 54, 0, 0, 0,
-    26, 7, 7, 7, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0,
+    0, 0, 0, 54, 7, 7, 7, 27, 0, 0, 0, 54, 7, 7, 27, 27, 0, 0, 0, 54, 7, 7, 7, 27, 0, 0, 0, 54, 7, 7, 7, 27,
+    0, 0, 0, 54, 7, 7, 7, 27, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 21, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 75, 21, 21, 21, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 75,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 22, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 75, 22, 22, 22, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 75,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75,
-    45, 75, 75, 75, 0, 0, 0, 0, 45, 21, 21, 21, 75, 0, 0, 0, 45, 75, 75, 75, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0,
+    45, 75, 75, 75, 0, 0, 0, 0, 45, 22, 22, 22, 75, 0, 0, 0, 45, 75, 75, 75, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0,
     45, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0, 45, 75, 0, 0, 0, 0, 0, 0,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
@@ -995,14 +655,8 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     0, 75, 42, 48, 48, 48, 48, 48, 75, 42, 48, 48, 48, 48, 48, 48, 42, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 66, 66, 48, 48, 48, 48, 48, 48, 66, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48,
-    0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     0, 75, 42, 48, 48, 48, 48, 48, 0, 0, 75, 42, 48, 66, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48,
@@ -1011,8 +665,6 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
-    48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
@@ -1035,54 +687,42 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 58, 33, 0, 0, 0, 0, 0, 0, 58, 33,
     0, 0, 0, 0, 0, 58, 33, 35, 0, 0, 0, 0, 0, 58, 33, 35, 0, 0, 0, 0, 0, 58, 35, 35, 0, 0, 0, 0, 0, 58, 35, 35,
-    0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 33, 58, 0, 0, 0, 0, 0, 0, 33, 58, 0, 0, 0, 0, 0, 0,
-    35, 33, 58, 0, 0, 0, 0, 0, 35, 33, 58, 0, 0, 0, 0, 0, 35, 35, 58, 0, 0, 0, 0, 0, 35, 35, 58, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 58, 33, 57, 57, 0, 0, 0, 0, 58, 33, 35, 35, 0, 0, 0, 0, 58, 35, 35, 35, 0, 0, 0, 0, 58, 35, 35, 35,
     0, 0, 0, 58, 33, 35, 35, 35, 0, 0, 0, 58, 33, 35, 35, 35, 0, 0, 0, 58, 57, 35, 35, 35, 0, 0, 0, 58, 35, 57, 57, 57,
-    57, 57, 33, 58, 0, 0, 0, 0, 35, 35, 33, 58, 0, 0, 0, 0, 35, 35, 35, 58, 0, 0, 0, 0, 35, 35, 35, 58, 0, 0, 0, 0,
-    35, 35, 35, 33, 58, 0, 0, 0, 35, 35, 35, 33, 58, 0, 0, 0, 35, 35, 35, 57, 58, 0, 0, 0, 57, 57, 57, 35, 58, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 0, 0, 0, 0, 0, 58, 33, 33, 58, 0, 0, 0, 0, 0, 58, 33, 33,
     0, 0, 0, 0, 0, 58, 35, 33, 0, 0, 0, 0, 0, 58, 35, 35, 0, 0, 0, 0, 0, 58, 35, 35, 0, 0, 0, 0, 0, 0, 58, 35,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 0, 0, 0, 58, 58, 33, 33, 58, 0, 0, 0,
     58, 33, 33, 58, 0, 0, 0, 0, 58, 33, 35, 58, 0, 0, 0, 0, 35, 35, 35, 58, 0, 0, 0, 0, 35, 35, 58, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 0, 0, 0, 0, 0, 58, 33, 33, 0, 0, 0, 0, 58, 33, 33, 33,
     0, 0, 0, 0, 58, 33, 35, 35, 0, 0, 0, 58, 33, 35, 35, 35, 0, 0, 58, 33, 33, 35, 35, 35, 0, 0, 58, 33, 35, 35, 69, 35,
-    0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 0, 0, 0, 0, 0, 0, 33, 33, 58, 0, 0, 0, 0, 0, 33, 33, 33, 58, 0, 0, 0, 0,
-    35, 35, 33, 58, 0, 0, 0, 0, 35, 35, 35, 33, 58, 0, 0, 0, 35, 35, 35, 33, 33, 58, 0, 0, 35, 35, 35, 35, 33, 58, 0, 0,
     0, 58, 33, 35, 35, 35, 35, 35, 0, 58, 33, 35, 69, 62, 35, 35, 0, 58, 35, 35, 69, 69, 35, 69, 0, 58, 35, 35, 35, 35, 35, 35,
     58, 33, 35, 35, 35, 35, 35, 35, 58, 33, 35, 35, 35, 69, 62, 35, 58, 35, 35, 35, 35, 69, 69, 35, 58, 35, 69, 35, 35, 35, 35, 35,
     35, 35, 69, 35, 35, 33, 58, 0, 35, 35, 35, 35, 35, 33, 58, 0, 35, 35, 35, 35, 35, 35, 58, 0, 35, 35, 35, 35, 35, 35, 58, 0,
     35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 69, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58,
     0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 67, 67, 0, 0, 0, 67, 48, 48,
-    67, 21, 67, 67, 67, 67, 48, 48, 67, 48, 21, 21, 21, 21, 48, 48, 0, 67, 48, 48, 48, 48, 48, 48, 0, 0, 67, 67, 67, 67, 48, 48,
+    67, 22, 67, 67, 67, 67, 48, 48, 67, 48, 22, 22, 22, 22, 48, 48, 0, 67, 48, 48, 48, 48, 48, 48, 0, 0, 67, 67, 67, 67, 48, 48,
     48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0,
     48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 67, 67, 0, 0,
     0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
-    0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 67, 21, 48, 48, 0, 0, 0, 0, 67, 48, 48, 48,
-    48, 67, 67, 67, 21, 67, 0, 0, 48, 21, 21, 21, 48, 67, 0, 0, 48, 48, 48, 48, 67, 0, 0, 0, 48, 67, 67, 67, 0, 0, 0, 0,
-    48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 21, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 67, 22, 48, 48, 0, 0, 0, 0, 67, 48, 48, 48,
+    48, 67, 67, 67, 22, 67, 0, 0, 48, 22, 22, 22, 48, 67, 0, 0, 48, 48, 48, 48, 67, 0, 0, 0, 48, 67, 67, 67, 0, 0, 0, 0,
+    48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 22, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60,
-    0, 0, 0, 60, 31, 31, 31, 31, 0, 0, 60, 31, 31, 31, 31, 31, 0, 0, 60, 28, 31, 31, 60, 60, 0, 0, 0, 60, 28, 28, 28, 28,
+    0, 0, 0, 60, 31, 31, 31, 31, 0, 0, 60, 31, 31, 31, 31, 31, 0, 0, 60, 18, 31, 31, 60, 60, 0, 0, 0, 60, 18, 18, 18, 18,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     60, 0, 0, 0, 0, 0, 0, 0, 31, 60, 0, 0, 0, 0, 0, 0, 31, 60, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 60, 60, 60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60,
     0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 0, 0, 0, 60, 31, 31, 31, 31, 60, 0, 0, 31, 31, 31, 31, 31, 31, 60, 0,
-    28, 31, 31, 60, 60, 31, 60, 0, 60, 28, 28, 28, 28, 60, 0, 0, 0, 60, 60, 60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 31, 31, 60, 60, 31, 60, 0, 60, 18, 18, 18, 18, 60, 0, 0, 0, 60, 60, 60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 75, 47, 47, 0, 0, 0, 0, 0, 75, 47, 47,
     0, 0, 0, 75, 75, 75, 47, 47, 0, 0, 75, 47, 47, 63, 47, 47, 0, 0, 75, 47, 47, 63, 47, 47, 0, 0, 75, 47, 47, 63, 47, 47,
     0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0, 47, 47, 47, 75, 0, 0, 0, 0, 47, 47, 47, 75, 0, 0, 0, 0,
     47, 47, 47, 75, 75, 75, 0, 0, 47, 47, 47, 63, 47, 47, 75, 0, 47, 47, 47, 63, 47, 47, 75, 0, 47, 47, 47, 63, 47, 47, 75, 0,
-    0, 0, 75, 47, 47, 63, 47, 18, 0, 0, 75, 47, 47, 63, 18, 41, 0, 0, 75, 47, 47, 63, 41, 41, 0, 0, 75, 47, 18, 63, 41, 41,
-    0, 0, 75, 18, 41, 47, 47, 47, 0, 0, 75, 41, 41, 41, 41, 41, 0, 0, 75, 41, 41, 41, 41, 41, 0, 0, 75, 75, 75, 75, 75, 75,
-    18, 18, 47, 63, 47, 47, 75, 0, 41, 41, 18, 63, 47, 47, 75, 0, 41, 41, 41, 63, 47, 47, 75, 0, 41, 41, 41, 63, 18, 47, 75, 0,
-    47, 47, 47, 47, 41, 18, 75, 0, 47, 41, 41, 41, 41, 41, 75, 0, 47, 41, 41, 41, 41, 41, 75, 0, 75, 75, 75, 75, 75, 75, 75, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 75, 47, 47, 63, 47, 19, 0, 0, 75, 47, 47, 63, 19, 41, 0, 0, 75, 47, 47, 63, 41, 41, 0, 0, 75, 47, 19, 63, 41, 41,
+    0, 0, 75, 19, 41, 47, 47, 47, 0, 0, 75, 41, 41, 41, 41, 41, 0, 0, 75, 41, 41, 41, 41, 41, 0, 0, 75, 75, 75, 75, 75, 75,
+    19, 19, 47, 63, 47, 47, 75, 0, 41, 41, 19, 63, 47, 47, 75, 0, 41, 41, 41, 63, 47, 47, 75, 0, 41, 41, 41, 63, 19, 47, 75, 0,
+    47, 47, 47, 47, 41, 19, 75, 0, 47, 41, 41, 41, 41, 41, 75, 0, 47, 41, 41, 41, 41, 41, 75, 0, 75, 75, 75, 75, 75, 75, 75, 0,
     0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 81, 36, 0, 0, 0, 0, 0, 81, 36, 36, 0, 0, 0, 0, 81, 36, 36, 36,
     0, 0, 0, 81, 36, 36, 36, 36, 0, 0, 81, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 39, 36, 36, 81, 36, 36, 36, 39, 39, 36, 36,
     0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 81, 36, 0, 0, 0, 0, 0, 81, 36, 36, 0, 0, 0, 0, 81, 36, 36, 36,
@@ -1097,32 +737,18 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     12, 39, 39, 39, 39, 39, 39, 40, 81, 39, 39, 39, 39, 39, 39, 40, 81, 39, 39, 39, 39, 39, 39, 40, 81, 30, 39, 39, 39, 39, 39, 39,
     39, 81, 0, 0, 0, 0, 0, 0, 39, 39, 81, 0, 0, 0, 0, 0, 39, 39, 39, 81, 0, 0, 0, 0, 40, 39, 39, 39, 81, 0, 0, 0,
     40, 40, 39, 39, 39, 81, 0, 0, 40, 40, 39, 39, 39, 39, 81, 59, 40, 40, 39, 39, 39, 39, 39, 81, 40, 40, 39, 39, 39, 39, 39, 81,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 54, 5, 54, 0, 0, 54, 0, 0, 54, 5, 54, 0, 54, 26, 0, 0, 54, 7, 26, 54, 54, 26,
-    0, 0, 54, 7, 26, 26, 26, 26, 0, 0, 54, 7, 26, 26, 7, 26, 0, 0, 54, 7, 26, 26, 7, 5, 0, 0, 54, 7, 26, 26, 5, 5,
-    54, 0, 0, 0, 0, 0, 0, 0, 26, 54, 0, 0, 0, 0, 0, 0, 26, 26, 54, 0, 0, 0, 0, 0, 26, 26, 54, 54, 54, 0, 0, 0,
-    26, 26, 26, 26, 26, 54, 0, 0, 7, 26, 7, 26, 54, 0, 0, 0, 5, 5, 7, 26, 54, 54, 54, 0, 5, 5, 5, 26, 26, 26, 26, 54,
+    0, 0, 54, 54, 0, 0, 0, 0, 0, 0, 54, 5, 54, 0, 0, 54, 0, 0, 54, 5, 54, 0, 54, 27, 0, 0, 54, 7, 27, 54, 54, 27,
+    0, 0, 54, 7, 27, 27, 27, 27, 0, 0, 54, 7, 27, 27, 7, 27, 0, 0, 54, 7, 27, 27, 7, 5, 0, 0, 54, 7, 27, 27, 5, 5,
+    54, 0, 0, 0, 0, 0, 0, 0, 27, 54, 0, 0, 0, 0, 0, 0, 27, 27, 54, 0, 0, 0, 0, 0, 27, 27, 54, 54, 54, 0, 0, 0,
+    27, 27, 27, 27, 27, 54, 0, 0, 7, 27, 7, 27, 54, 0, 0, 0, 5, 5, 7, 27, 54, 54, 54, 0, 5, 5, 5, 27, 27, 27, 27, 54,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 54, 4, 0, 0, 0, 0, 0, 0, 54, 4, 0, 0, 0, 0, 54, 54, 54, 7,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    54, 0, 0, 0, 0, 0, 0, 0, 4, 54, 0, 0, 0, 0, 0, 0, 4, 54, 0, 0, 0, 0, 0, 0, 7, 54, 54, 54, 0, 0, 0, 0,
     0, 0, 0, 54, 4, 4, 4, 7, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 0, 54, 54, 54, 7, 0, 0, 0, 0, 0, 0, 54, 7,
     0, 0, 0, 0, 0, 0, 54, 7, 0, 0, 0, 0, 0, 0, 54, 7, 0, 0, 0, 0, 0, 0, 54, 7, 0, 0, 0, 0, 0, 0, 54, 7,
-    7, 4, 4, 4, 54, 0, 0, 0, 7, 7, 7, 7, 54, 0, 0, 0, 7, 54, 54, 54, 0, 0, 0, 0, 7, 54, 0, 0, 0, 0, 0, 0,
-    7, 54, 0, 0, 0, 0, 0, 0, 7, 54, 0, 0, 0, 0, 0, 0, 7, 54, 0, 0, 0, 0, 0, 0, 7, 54, 0, 0, 0, 0, 0, 0,
-    0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 48, 48, 48, 0, 75, 42, 48, 48, 66, 48, 48,
-    0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48, 0, 0, 75, 42, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 66, 48, 48, 48, 48, 48, 48, 66, 66, 48, 48, 48, 48, 48,
-    0, 0, 0, 75, 42, 48, 48, 48, 0, 0, 0, 75, 42, 48, 48, 48, 0, 0, 0, 0, 75, 42, 48, 48, 0, 0, 0, 0, 0, 75, 42, 42,
-    0, 0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     42, 42, 42, 48, 48, 48, 48, 48, 75, 75, 75, 42, 42, 42, 42, 42, 0, 0, 0, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 66, 48, 48, 48, 48, 48, 48, 66, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48,
     48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
@@ -1135,26 +761,16 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0, 48, 48, 48, 48, 42, 75, 0, 0,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     48, 48, 48, 48, 48, 42, 42, 42, 42, 42, 42, 42, 42, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 48, 48, 42, 75, 0, 0, 0, 48, 48, 48, 42, 75, 0, 0, 0, 48, 48, 42, 75, 0, 0, 0, 0, 42, 42, 75, 0, 0, 0, 0, 0,
-    75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35,
     58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 0, 58, 35, 35, 35, 35, 35, 57, 0, 58, 35, 35, 35, 35, 35, 35,
     35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58,
     35, 35, 35, 35, 57, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 57, 57, 35, 35, 58, 0, 35, 35, 57, 57, 35, 35, 58, 0,
     0, 0, 58, 35, 35, 35, 35, 35, 0, 0, 0, 58, 58, 35, 35, 35, 0, 0, 0, 0, 0, 58, 35, 35, 0, 0, 0, 0, 0, 0, 67, 48,
     0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
-    35, 35, 35, 35, 35, 58, 0, 0, 35, 35, 35, 58, 58, 0, 0, 0, 35, 35, 58, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0,
-    48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
     0, 0, 58, 33, 35, 35, 35, 35, 0, 0, 58, 33, 35, 35, 35, 35, 0, 0, 58, 35, 35, 35, 35, 35, 0, 0, 58, 35, 35, 35, 35, 35,
     0, 58, 33, 35, 35, 35, 35, 35, 0, 58, 57, 35, 35, 35, 35, 35, 0, 58, 35, 57, 57, 57, 57, 57, 0, 58, 35, 35, 35, 35, 35, 35,
-    35, 35, 35, 35, 33, 58, 0, 0, 35, 35, 35, 35, 33, 58, 0, 0, 35, 35, 35, 35, 35, 58, 0, 0, 35, 35, 35, 35, 35, 58, 0, 0,
-    35, 35, 35, 35, 35, 33, 58, 0, 35, 35, 35, 35, 35, 57, 58, 0, 57, 57, 57, 57, 57, 35, 58, 0, 35, 35, 35, 35, 35, 35, 58, 0,
     58, 33, 35, 35, 35, 35, 35, 35, 58, 33, 35, 35, 35, 35, 35, 35, 58, 58, 58, 35, 35, 35, 35, 35, 0, 0, 0, 58, 58, 58, 58, 58,
     0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
-    35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 0,
-    48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 0, 0, 0, 0, 58, 33, 33, 58, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 58, 58, 58, 58, 0, 0, 0, 0, 58, 33, 33, 58, 0, 0, 0, 0, 0, 58, 33, 35,
@@ -1165,46 +781,42 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     58, 35, 69, 62, 35, 35, 35, 35, 58, 35, 69, 69, 35, 35, 35, 35, 0, 58, 35, 35, 35, 35, 35, 69, 0, 58, 35, 35, 35, 35, 35, 35,
     35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 69, 62, 35, 35, 58, 35, 35, 35, 69, 69, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58,
     35, 35, 35, 35, 69, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 69, 62, 35, 35, 58, 0, 35, 35, 69, 69, 35, 35, 58, 0,
-    0, 0, 58, 35, 35, 35, 35, 35, 0, 0, 0, 58, 58, 35, 35, 35, 0, 0, 0, 0, 0, 58, 35, 35, 0, 0, 0, 0, 0, 0, 67, 48,
-    0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 67, 48, 48, 0, 0, 0, 0, 0, 67, 48, 48,
-    35, 35, 35, 35, 35, 58, 0, 0, 35, 35, 35, 58, 58, 0, 0, 0, 35, 35, 58, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0,
-    48, 67, 0, 0, 0, 0, 0, 0, 48, 67, 0, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 50, 0, 1, 50, 0, 0, 0, 0, 1, 60, 1, 1,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 1, 0, 50, 0, 0, 0, 0, 0, 1, 60, 1, 0, 0, 0, 0, 0,
-    0, 0, 0, 60, 31, 4, 17, 1, 0, 0, 60, 31, 1, 4, 4, 17, 0, 0, 60, 28, 31, 31, 1, 4, 0, 0, 0, 60, 28, 28, 31, 31,
-    0, 0, 0, 0, 60, 60, 28, 28, 0, 0, 0, 0, 0, 0, 60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    17, 4, 31, 60, 0, 0, 0, 0, 4, 4, 1, 31, 60, 0, 0, 0, 1, 31, 31, 28, 60, 0, 0, 0, 31, 28, 28, 60, 0, 0, 0, 0,
-    28, 60, 60, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 0, 0, 0, 0, 0, 0, 67, 21, 67, 0, 0, 0, 0, 0, 0, 67, 48, 67,
-    0, 0, 0, 0, 0, 0, 67, 21, 0, 67, 67, 0, 0, 0, 67, 48, 0, 67, 21, 67, 67, 67, 67, 48, 0, 67, 48, 21, 21, 21, 21, 48,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 0, 0, 0, 0, 67, 48, 21, 67, 0, 0, 67, 67, 48, 67, 67, 0, 0, 0,
-    21, 21, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 67, 67, 0,
+    0, 0, 0, 60, 31, 4, 17, 1, 0, 0, 60, 31, 1, 4, 4, 17, 0, 0, 60, 18, 31, 31, 1, 4, 0, 0, 0, 60, 18, 18, 31, 31,
+    0, 0, 0, 0, 60, 60, 18, 18, 0, 0, 0, 0, 0, 0, 60, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 4, 31, 60, 0, 0, 0, 0, 4, 4, 1, 31, 60, 0, 0, 0, 1, 31, 31, 18, 60, 0, 0, 0, 31, 18, 18, 60, 0, 0, 0, 0,
+    18, 60, 60, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 0, 0, 0, 0, 0, 0, 67, 22, 67, 0, 0, 0, 0, 0, 0, 67, 48, 67,
+    0, 0, 0, 0, 0, 0, 67, 22, 0, 67, 67, 0, 0, 0, 67, 48, 0, 67, 22, 67, 67, 67, 67, 48, 0, 67, 48, 22, 22, 22, 22, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 67, 67, 0, 0, 0, 0, 67, 48, 22, 67, 0, 0, 67, 67, 48, 67, 67, 0, 0, 0,
+    22, 22, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 67, 67, 0,
     0, 0, 67, 48, 48, 48, 48, 48, 0, 0, 0, 67, 67, 67, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48,
-    0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 67, 21, 48, 0, 0, 0, 0, 0, 67, 48, 48,
-    48, 48, 67, 67, 67, 21, 67, 0, 48, 48, 21, 21, 21, 48, 67, 0, 48, 48, 48, 48, 48, 67, 0, 0, 48, 48, 67, 67, 67, 0, 0, 0,
-    48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 21, 67, 0, 0, 0, 0, 48, 48, 48, 67, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 0, 67, 48, 0, 0, 0, 0, 0, 67, 22, 48, 0, 0, 0, 0, 0, 67, 48, 48,
+    48, 48, 67, 67, 67, 22, 67, 0, 48, 48, 22, 22, 22, 48, 67, 0, 48, 48, 48, 48, 48, 67, 0, 0, 48, 48, 67, 67, 67, 0, 0, 0,
+    48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 67, 0, 0, 0, 0, 0, 48, 48, 22, 67, 0, 0, 0, 0, 48, 48, 48, 67, 0, 0, 0, 0,
     0, 81, 36, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 36, 36, 36,
     0, 81, 36, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 36, 36, 36, 0, 81, 36, 36, 36, 36, 36, 30,
     36, 36, 36, 36, 36, 36, 30, 40, 36, 36, 36, 36, 36, 30, 40, 40, 36, 36, 36, 36, 30, 40, 40, 40, 36, 36, 36, 30, 40, 40, 40, 40,
     36, 36, 30, 40, 40, 40, 40, 40, 36, 30, 40, 40, 40, 40, 40, 40, 30, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 81,
     0, 81, 36, 36, 36, 36, 30, 40, 0, 81, 36, 36, 36, 30, 40, 40, 0, 81, 36, 36, 30, 40, 40, 40, 0, 81, 36, 30, 40, 40, 40, 40,
     0, 81, 30, 40, 40, 40, 40, 40, 0, 81, 40, 40, 40, 40, 40, 40, 0, 81, 40, 40, 40, 40, 40, 40, 0, 59, 81, 81, 81, 81, 81, 81,
-    40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 81, 21,
-    40, 40, 40, 40, 40, 40, 81, 21, 40, 40, 40, 40, 40, 81, 75, 75, 40, 40, 40, 40, 81, 0, 0, 0, 81, 81, 81, 81, 81, 0, 0, 0,
+    40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 81, 22,
+    40, 40, 40, 40, 40, 40, 81, 22, 40, 40, 40, 40, 40, 81, 75, 75, 40, 40, 40, 40, 81, 0, 0, 0, 81, 81, 81, 81, 81, 0, 0, 0,
     81, 40, 30, 39, 39, 39, 39, 39, 81, 40, 40, 30, 39, 39, 39, 39, 81, 40, 40, 40, 30, 39, 39, 39, 81, 40, 40, 40, 40, 30, 39, 39,
-    81, 40, 40, 40, 40, 40, 30, 39, 81, 40, 40, 40, 40, 40, 40, 30, 81, 40, 40, 40, 40, 40, 40, 40, 21, 81, 40, 40, 40, 40, 40, 40,
+    81, 40, 40, 40, 40, 40, 30, 39, 81, 40, 40, 40, 40, 40, 40, 30, 81, 40, 40, 40, 40, 40, 40, 40, 22, 81, 40, 40, 40, 40, 40, 40,
     40, 40, 39, 39, 39, 39, 36, 81, 39, 40, 39, 39, 39, 39, 36, 81, 39, 39, 39, 39, 39, 39, 36, 81, 39, 39, 39, 39, 39, 39, 36, 81,
     39, 39, 39, 39, 39, 39, 36, 81, 39, 39, 39, 39, 39, 39, 36, 81, 30, 39, 39, 39, 39, 39, 36, 81, 40, 30, 39, 39, 39, 39, 36, 81,
-    21, 81, 40, 40, 40, 40, 40, 40, 21, 81, 40, 40, 40, 40, 40, 40, 21, 81, 40, 40, 40, 40, 40, 40, 21, 21, 81, 40, 40, 40, 40, 40,
-    21, 21, 81, 40, 40, 40, 40, 40, 75, 75, 75, 81, 40, 40, 40, 40, 0, 0, 0, 0, 81, 40, 40, 40, 0, 0, 0, 0, 81, 81, 81, 81,
+    22, 81, 40, 40, 40, 40, 40, 40, 22, 81, 40, 40, 40, 40, 40, 40, 22, 81, 40, 40, 40, 40, 40, 40, 22, 22, 81, 40, 40, 40, 40, 40,
+    22, 22, 81, 40, 40, 40, 40, 40, 75, 75, 75, 81, 40, 40, 40, 40, 0, 0, 0, 0, 81, 40, 40, 40, 0, 0, 0, 0, 81, 81, 81, 81,
     40, 40, 30, 39, 39, 39, 36, 81, 40, 40, 40, 30, 39, 39, 36, 81, 40, 40, 40, 40, 30, 39, 36, 81, 40, 40, 40, 40, 40, 30, 36, 81,
     40, 40, 40, 40, 40, 40, 30, 81, 40, 40, 40, 40, 40, 40, 40, 81, 40, 40, 40, 40, 40, 40, 40, 81, 81, 81, 81, 81, 81, 81, 81, 59,
-    0, 0, 54, 7, 26, 26, 5, 5, 0, 0, 54, 7, 26, 26, 26, 5, 0, 0, 54, 5, 7, 26, 26, 5, 0, 54, 54, 5, 7, 23, 23, 23,
-    0, 54, 5, 7, 26, 26, 26, 26, 0, 54, 5, 7, 26, 26, 26, 26, 0, 54, 5, 26, 26, 23, 23, 26, 0, 54, 5, 5, 5, 5, 5, 5,
-    5, 5, 5, 26, 26, 26, 26, 54, 5, 5, 26, 26, 23, 26, 26, 54, 5, 5, 26, 26, 23, 26, 26, 54, 23, 23, 23, 23, 23, 7, 7, 54,
-    26, 26, 26, 26, 26, 7, 7, 54, 26, 26, 26, 26, 26, 26, 5, 54, 26, 26, 23, 23, 26, 26, 5, 54, 5, 5, 5, 5, 5, 5, 5, 54,
+    0, 0, 54, 7, 27, 27, 5, 5, 0, 0, 54, 7, 27, 27, 27, 5, 0, 0, 54, 5, 7, 27, 27, 5, 0, 54, 54, 5, 7, 24, 24, 24,
+    0, 54, 5, 7, 27, 27, 27, 27, 0, 54, 5, 7, 27, 27, 27, 27, 0, 54, 5, 27, 27, 24, 24, 27, 0, 54, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 27, 27, 27, 27, 54, 5, 5, 27, 27, 24, 27, 27, 54, 5, 5, 27, 27, 24, 27, 27, 54, 24, 24, 24, 24, 24, 7, 7, 54,
+    27, 27, 27, 27, 27, 7, 7, 54, 27, 27, 27, 27, 27, 27, 5, 54, 27, 27, 24, 24, 27, 27, 5, 54, 5, 5, 5, 5, 5, 5, 5, 54,
     0, 54, 4, 4, 4, 4, 4, 4, 0, 54, 7, 7, 7, 7, 7, 7, 0, 54, 7, 7, 7, 7, 15, 15, 0, 54, 7, 7, 7, 7, 15, 15,
     0, 54, 7, 7, 7, 7, 15, 15, 0, 54, 7, 7, 7, 7, 15, 15, 0, 54, 7, 7, 7, 7, 7, 7, 0, 54, 54, 54, 54, 54, 54, 54,
     4, 4, 4, 4, 4, 4, 4, 54, 7, 7, 7, 7, 7, 7, 7, 54, 15, 15, 15, 7, 7, 7, 7, 54, 15, 15, 15, 7, 7, 7, 7, 54,
@@ -1223,234 +835,170 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     5, 5, 5, 5, 5, 54, 0, 0, 7, 7, 7, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0, 7, 5, 7, 5, 5, 54, 0, 0,
     0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 7, 5, 0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 5, 5,
     0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 4, 4, 4, 4, 0, 0, 0, 54, 7, 7, 7, 7, 0, 0, 0, 54, 7, 7, 7, 7,
-    5, 5, 5, 5, 5, 54, 0, 0, 7, 7, 7, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0,
-    5, 5, 5, 5, 5, 54, 0, 0, 4, 4, 4, 4, 4, 54, 0, 0, 7, 7, 7, 7, 7, 54, 0, 0, 7, 7, 7, 7, 7, 54, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 5, 5,
-    0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 7, 7, 0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 7, 7,
     0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 0, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0,
     5, 5, 5, 5, 5, 54, 0, 0, 7, 5, 7, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0, 7, 7, 7, 5, 5, 54, 0, 0,
     0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 7, 5, 0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 5, 5,
     0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 5, 5, 5, 5, 0, 0, 0, 54, 4, 4, 4, 4, 0, 0, 0, 54, 7, 7, 7, 7,
     5, 5, 5, 5, 5, 54, 0, 0, 7, 7, 7, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0,
     5, 5, 5, 5, 5, 54, 0, 0, 5, 5, 5, 5, 5, 54, 0, 0, 4, 4, 4, 4, 4, 54, 0, 0, 7, 7, 7, 7, 7, 54, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 48, 48, 48, 48,
-    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 42, 75, 75, 75, 75, 75, 0, 0, 48, 42, 42, 42, 42, 42, 75, 0,
     48, 48, 48, 48, 48, 48, 42, 75, 66, 48, 48, 48, 48, 48, 42, 75, 48, 48, 48, 48, 48, 48, 42, 75, 48, 48, 48, 48, 48, 48, 42, 75,
     48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
     42, 42, 42, 42, 48, 48, 48, 48, 75, 75, 75, 75, 42, 42, 42, 42, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
     48, 48, 48, 66, 66, 48, 42, 75, 66, 48, 48, 66, 66, 48, 42, 75, 48, 48, 48, 48, 48, 48, 42, 75, 48, 48, 48, 48, 48, 48, 42, 75,
     48, 42, 42, 42, 42, 42, 75, 0, 42, 75, 75, 75, 75, 75, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 24, 0, 0, 0, 0, 24, 9, 24, 6, 24, 24, 24, 24, 24, 6, 24, 24, 6, 6, 6, 6,
-    24, 9, 24, 0, 24, 24, 24, 24, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24,
-    6, 6, 6, 6, 6, 6, 6, 6, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 25, 0, 0, 0, 0, 25, 9, 25, 6, 25, 25, 25, 25, 25, 6, 25, 25, 6, 6, 6, 6,
+    25, 9, 25, 0, 25, 25, 25, 25, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+    6, 6, 6, 6, 6, 6, 6, 6, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
     75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24,
-    6, 6, 6, 6, 6, 6, 6, 6, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 75, 75, 75, 24, 24, 24, 24, 6, 24, 9, 24, 6, 6, 6, 6, 24, 24, 6, 24,
-    24, 24, 24, 24, 0, 24, 9, 24, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75,
-    0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 25, 16, 25, 25, 25, 16, 16, 16, 25, 25, 25,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 16, 16, 16, 25,
-    25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 16, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 16, 16, 25, 25, 25, 25, 56, 56, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 16, 16, 16, 25, 25, 25, 56, 56, 56, 56, 56, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 24, 24, 24, 24, 24, 24, 9, 24, 6, 6, 6, 6, 6, 24, 6, 24, 24, 24, 24, 24, 24,
-    24, 9, 24, 0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 24, 24, 24, 75, 45, 75, 0, 0, 24, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24, 0, 0, 24, 0, 24, 0, 0, 24, 0, 0, 24, 0, 24, 24, 24, 24, 24, 24, 24, 24,
-    75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 24, 24, 24, 75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 24, 0, 0,
-    75, 45, 75, 0, 0, 24, 24, 24, 75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    24, 0, 0, 24, 0, 0, 24, 0, 24, 0, 0, 24, 0, 0, 24, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 24, 0, 0, 24, 0,
-    24, 0, 0, 24, 0, 0, 24, 0, 24, 24, 24, 24, 24, 24, 24, 24, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 0, 24, 0, 0, 24, 0, 0, 24, 0, 24, 0, 0, 24, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24,
-    0, 0, 0, 0, 0, 0, 0, 0, 24, 24, 24, 24, 24, 75, 75, 75, 6, 6, 6, 6, 6, 24, 9, 24, 24, 24, 24, 24, 24, 24, 6, 24,
-    0, 0, 24, 0, 0, 24, 9, 24, 0, 0, 24, 0, 0, 75, 45, 75, 24, 24, 24, 0, 0, 75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75,
-    0, 24, 0, 0, 24, 0, 0, 24, 0, 24, 0, 0, 24, 0, 0, 24, 24, 24, 24, 24, 24, 24, 24, 24, 0, 24, 0, 0, 24, 0, 0, 24,
-    0, 24, 0, 0, 24, 0, 0, 24, 24, 24, 24, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 24, 0, 0, 75, 45, 75, 24, 24, 24, 0, 0, 75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 24, 0, 0, 75, 45, 75,
-    0, 0, 24, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 16, 26, 16, 26, 26, 26, 16, 16, 16, 26, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 16, 16, 16, 26,
+    26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 16, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 16, 16, 26, 26, 26, 26, 56, 56, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 16, 16, 16, 26, 26, 26, 56, 56, 56, 56, 56, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 25, 25, 25, 25, 25, 25, 9, 25, 6, 6, 6, 6, 6, 25, 6, 25, 25, 25, 25, 25, 25,
+    25, 9, 25, 0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 25, 25, 25, 75, 45, 75, 0, 0, 25, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 6, 6, 6, 6, 6, 6, 6, 6,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 25, 0, 0, 25, 0, 25, 0, 0, 25, 0, 0, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25,
+    75, 45, 75, 0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 25, 25, 25, 75, 45, 75, 0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 25, 0, 0,
+    75, 45, 75, 0, 0, 25, 25, 25, 75, 45, 75, 0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    25, 0, 0, 25, 0, 0, 25, 0, 25, 0, 0, 25, 0, 0, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 25, 0, 0, 25, 0,
+    25, 0, 0, 25, 0, 0, 25, 0, 25, 25, 25, 25, 25, 25, 25, 25, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 25, 0, 0, 25, 0, 0, 25, 0, 25, 0, 0, 25, 0, 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 0, 25, 0, 0, 25, 0, 0, 25,
+    0, 25, 0, 0, 25, 0, 0, 25, 25, 25, 25, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 25, 0, 0, 75, 45, 75, 25, 25, 25, 0, 0, 75, 45, 75, 0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 25, 0, 0, 75, 45, 75,
+    0, 0, 25, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 75, 45, 45, 75, 75, 75, 75, 75, 75, 45, 45, 75,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 75, 45, 45, 75, 75, 75, 75, 75, 75, 45, 45, 75,
-    21, 21, 21, 21, 21, 21, 21, 75, 21, 21, 21, 21, 21, 21, 21, 75, 21, 21, 21, 21, 21, 21, 21, 75, 21, 21, 21, 21, 21, 21, 21, 75,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 21, 21, 21, 21, 21, 21, 45, 45, 21,
-    45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 45, 45, 75, 0, 0, 0, 0, 27, 45, 45, 27, 0, 0, 0, 0, 0, 27, 27, 0,
-    21, 21, 21, 21, 21, 21, 21, 75, 21, 21, 21, 21, 21, 21, 21, 75, 21, 21, 21, 21, 21, 45, 45, 75, 21, 21, 21, 21, 21, 45, 45, 75,
-    45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 45, 45, 75, 0, 0, 0, 0, 27, 45, 45, 27, 0, 0, 0, 0, 0, 27, 27, 0,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25,
-    25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 56, 16, 25, 25, 25, 25, 16, 25, 0, 56, 16, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25,
-    25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25,
-    0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56, 56, 56, 16, 56, 56, 56, 56, 16, 16, 16, 25, 16, 16, 16, 16, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25,
-    25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 16, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 16, 16, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    22, 22, 22, 22, 22, 22, 22, 75, 22, 22, 22, 22, 22, 22, 22, 75, 22, 22, 22, 22, 22, 22, 22, 75, 22, 22, 22, 22, 22, 22, 22, 75,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 22, 22, 22, 22, 22, 22, 45, 45, 22,
+    45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 45, 45, 75, 0, 0, 0, 0, 28, 45, 45, 28, 0, 0, 0, 0, 0, 28, 28, 0,
+    22, 22, 22, 22, 22, 22, 22, 75, 22, 22, 22, 22, 22, 22, 22, 75, 22, 22, 22, 22, 22, 45, 45, 75, 22, 22, 22, 22, 22, 45, 45, 75,
+    45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 45, 45, 75, 0, 0, 0, 0, 28, 45, 45, 28, 0, 0, 0, 0, 0, 28, 28, 0,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26,
+    26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 56, 16, 26, 26, 26, 26, 16, 26, 0, 56, 16, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26,
+    26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56, 56, 56, 16, 56, 56, 56, 56, 16, 16, 16, 26, 16, 16, 16, 16, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26,
+    26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 16, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 16, 16, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 6, 6, 6, 6, 6,
-    55, 24, 24, 24, 24, 24, 24, 24, 55, 24, 24, 24, 24, 24, 24, 24, 55, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 6, 6, 6, 6, 6, 22, 22, 55,
-    24, 24, 24, 24, 24, 24, 24, 55, 24, 24, 24, 24, 24, 24, 24, 55, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55,
-    11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55, 11, 11, 11, 11, 11, 22, 22, 55,
-    0, 56, 16, 25, 25, 25, 25, 25, 56, 16, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 16, 25, 16, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 16, 25, 0, 0, 56, 16, 25, 25, 25, 25,
-    0, 56, 16, 25, 25, 25, 25, 25, 0, 56, 16, 25, 25, 25, 25, 25, 0, 56, 16, 25, 25, 25, 25, 25, 0, 56, 16, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 25, 25, 16, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    0, 56, 16, 25, 25, 25, 25, 16, 0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 25, 16,
-    0, 0, 56, 16, 25, 25, 25, 16, 0, 56, 16, 25, 25, 25, 25, 16, 0, 56, 16, 25, 25, 25, 25, 25, 0, 56, 16, 25, 25, 25, 25, 25,
-    25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25,
-    16, 16, 25, 25, 16, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 16, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11,
+    55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11,
+    55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 6, 6, 6, 6, 6,
+    55, 25, 25, 25, 25, 25, 25, 25, 55, 25, 25, 25, 25, 25, 25, 25, 55, 25, 25, 25, 25, 25, 25, 25, 55, 55, 55, 55, 55, 55, 55, 55,
+    0, 56, 16, 26, 26, 26, 26, 26, 56, 16, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 16, 26, 16, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 16, 26, 0, 0, 56, 16, 26, 26, 26, 26,
+    0, 56, 16, 26, 26, 26, 26, 26, 0, 56, 16, 26, 26, 26, 26, 26, 0, 56, 16, 26, 26, 26, 26, 26, 0, 56, 16, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 26, 26, 16, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    0, 56, 16, 26, 26, 26, 26, 16, 0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 26, 16,
+    0, 0, 56, 16, 26, 26, 26, 16, 0, 56, 16, 26, 26, 26, 26, 16, 0, 56, 16, 26, 26, 26, 26, 26, 0, 56, 16, 26, 26, 26, 26, 26,
+    26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26,
+    16, 16, 26, 26, 16, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 16, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 54, 54,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 0,
-    21, 21, 75, 0, 0, 0, 0, 0, 21, 21, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 7, 7, 54, 0, 0, 0, 0, 0,
+    22, 22, 75, 0, 0, 0, 0, 0, 22, 22, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 7, 7, 54, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 54, 54, 0, 75, 0, 0, 54, 54, 0, 0, 0, 75, 54, 54, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 75,
-    0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 27, 75, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 28, 75, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0,
     45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0,
-    45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 27, 0, 0, 0, 0, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 56, 16, 25, 25, 25, 25, 25, 0, 56, 16, 25, 25, 25, 16, 25, 0, 56, 16, 25, 25, 25, 25, 25, 0, 56, 16, 25, 25, 25, 25, 16,
-    0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 25, 25, 0, 0, 56, 16, 25, 25, 16, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    25, 25, 25, 25, 16, 16, 25, 25, 16, 16, 16, 25, 16, 16, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25,
-    0, 0, 0, 56, 16, 25, 25, 25, 0, 0, 0, 56, 16, 25, 25, 25, 0, 0, 0, 0, 56, 16, 25, 25, 0, 0, 0, 0, 0, 56, 16, 16,
+    45, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 28, 0, 0, 0, 0, 28, 28, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 56, 16, 26, 26, 26, 26, 26, 0, 56, 16, 26, 26, 26, 16, 26, 0, 56, 16, 26, 26, 26, 26, 26, 0, 56, 16, 26, 26, 26, 26, 16,
+    0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 26, 26, 0, 0, 56, 16, 26, 26, 16, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 16, 16, 26, 26, 16, 16, 16, 26, 16, 16, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26,
+    0, 0, 0, 56, 16, 26, 26, 26, 0, 0, 0, 56, 16, 26, 26, 26, 0, 0, 0, 0, 56, 16, 26, 26, 0, 0, 0, 0, 0, 56, 16, 16,
     0, 0, 0, 0, 0, 0, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 16, 25, 25, 25, 25, 25, 56, 56, 56, 16, 16, 16, 16, 16, 0, 0, 0, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 16, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25,
-    25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 16, 16, 16, 25,
-    25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 16, 16, 25, 25, 25, 25, 56, 56, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    25, 16, 25, 25, 16, 16, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 16, 16, 25, 25, 25, 25, 56, 56, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 56, 56, 16, 16, 16, 16, 0, 56, 16, 16, 25, 25, 25, 25,
-    56, 16, 25, 25, 25, 25, 25, 25, 56, 16, 25, 25, 25, 25, 25, 25, 56, 16, 25, 25, 16, 25, 25, 25, 56, 16, 25, 25, 25, 25, 25, 25,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 25, 25, 25,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 16, 16, 25, 25, 25, 25, 25, 25, 16, 16, 25, 25, 25, 25,
-    56, 16, 25, 25, 25, 25, 16, 16, 56, 16, 25, 25, 25, 25, 16, 16, 56, 16, 25, 25, 25, 25, 25, 25, 56, 16, 25, 25, 25, 25, 25, 25,
-    0, 56, 16, 16, 25, 25, 25, 25, 0, 0, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 16, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
-    16, 16, 16, 16, 16, 25, 25, 25, 56, 56, 56, 56, 56, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 75, 75, 75, 75, 75, 75, 0, 75, 21, 21, 21, 21, 21, 21, 75, 21, 45, 45, 45, 45, 45, 45, 75, 21, 45, 45, 45, 45, 45, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    75, 75, 75, 75, 75, 75, 75, 0, 21, 21, 21, 21, 21, 21, 21, 75, 45, 45, 45, 45, 45, 45, 21, 75, 21, 21, 45, 45, 45, 45, 21, 75,
-    75, 21, 45, 45, 45, 45, 45, 45, 75, 21, 45, 45, 45, 45, 45, 45, 75, 45, 21, 21, 21, 21, 21, 21, 75, 45, 45, 45, 45, 45, 45, 45,
-    27, 75, 45, 45, 45, 45, 45, 45, 0, 27, 75, 75, 45, 45, 45, 45, 0, 0, 27, 27, 75, 75, 75, 75, 0, 0, 0, 0, 27, 27, 27, 27,
-    21, 21, 45, 45, 45, 45, 21, 75, 21, 21, 45, 45, 45, 45, 21, 75, 21, 21, 21, 21, 21, 21, 21, 75, 45, 45, 45, 45, 45, 45, 45, 75,
-    45, 45, 45, 45, 45, 45, 45, 75, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75, 27, 27, 27, 27, 27, 27, 27, 27, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 75, 48, 21, 21, 0, 0, 0, 0, 75, 21, 6, 6, 0, 0, 0, 0, 75, 48, 21, 21,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    75, 75, 75, 75, 0, 0, 0, 0, 21, 21, 21, 48, 75, 0, 0, 0, 6, 6, 6, 21, 75, 0, 0, 0, 21, 21, 21, 48, 75, 0, 0, 0,
+    26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 16, 26, 26, 26, 26, 26, 56, 56, 56, 16, 16, 16, 16, 16, 0, 0, 0, 56, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 16, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26,
+    26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 16, 16, 16, 26,
+    26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 16, 16, 26, 26, 26, 26, 56, 56, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 16, 26, 26, 16, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 16, 16, 26, 26, 26, 26, 56, 56, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 56, 56, 16, 16, 16, 16, 0, 56, 16, 16, 26, 26, 26, 26,
+    56, 16, 26, 26, 26, 26, 26, 26, 56, 16, 26, 26, 26, 26, 26, 26, 56, 16, 26, 26, 16, 26, 26, 26, 56, 16, 26, 26, 26, 26, 26, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 16, 16, 16, 16, 16, 16, 16, 16, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26,
+    56, 16, 26, 26, 26, 26, 16, 16, 56, 16, 26, 26, 26, 26, 16, 16, 56, 16, 26, 26, 26, 26, 26, 26, 56, 16, 26, 26, 26, 26, 26, 26,
+    0, 56, 16, 16, 26, 26, 26, 26, 0, 0, 56, 56, 16, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    16, 16, 16, 16, 16, 26, 26, 26, 56, 56, 56, 56, 56, 16, 16, 16, 0, 0, 0, 0, 56, 56, 56, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 75, 75, 75, 75, 75, 75, 0, 75, 22, 22, 22, 22, 22, 22, 75, 22, 45, 45, 45, 45, 45, 45, 75, 22, 45, 45, 45, 45, 45, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    75, 75, 75, 75, 75, 75, 75, 0, 22, 22, 22, 22, 22, 22, 22, 75, 45, 45, 45, 45, 45, 45, 22, 75, 22, 22, 45, 45, 45, 45, 22, 75,
+    75, 22, 45, 45, 45, 45, 45, 45, 75, 22, 45, 45, 45, 45, 45, 45, 75, 45, 22, 22, 22, 22, 22, 22, 75, 45, 45, 45, 45, 45, 45, 45,
+    28, 75, 45, 45, 45, 45, 45, 45, 0, 28, 75, 75, 45, 45, 45, 45, 0, 0, 28, 28, 75, 75, 75, 75, 0, 0, 0, 0, 28, 28, 28, 28,
+    22, 22, 45, 45, 45, 45, 22, 75, 22, 22, 45, 45, 45, 45, 22, 75, 22, 22, 22, 22, 22, 22, 22, 75, 45, 45, 45, 45, 45, 45, 45, 75,
+    45, 45, 45, 45, 45, 45, 45, 75, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75, 28, 28, 28, 28, 28, 28, 28, 28, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 75, 75, 75, 0, 0, 0, 0, 75, 48, 22, 22, 0, 0, 0, 0, 75, 22, 6, 6, 0, 0, 0, 0, 75, 48, 22, 22,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    75, 75, 75, 75, 0, 0, 0, 0, 22, 22, 22, 48, 75, 0, 0, 0, 6, 6, 6, 22, 75, 0, 0, 0, 22, 22, 22, 48, 75, 0, 0, 0,
     0, 0, 0, 0, 75, 48, 48, 48, 0, 0, 0, 0, 75, 48, 48, 48, 0, 0, 0, 0, 75, 48, 66, 66, 0, 0, 0, 75, 48, 48, 66, 66,
     0, 0, 75, 75, 48, 48, 48, 48, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     48, 48, 48, 48, 75, 0, 0, 0, 48, 48, 48, 48, 75, 0, 0, 0, 48, 48, 66, 48, 75, 0, 0, 0, 48, 48, 48, 48, 48, 75, 0, 0,
     48, 48, 48, 48, 48, 75, 75, 0, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    55, 22, 22, 11, 11, 11, 11, 11, 55, 22, 22, 11, 11, 24, 11, 11, 55, 22, 22, 11, 11, 24, 11, 11, 55, 22, 22, 11, 11, 6, 24, 11,
-    55, 22, 22, 11, 11, 11, 24, 11, 55, 22, 22, 11, 11, 11, 6, 24, 55, 22, 22, 11, 11, 11, 24, 6, 55, 22, 22, 11, 11, 11, 24, 11,
+    55, 23, 23, 11, 11, 11, 11, 11, 55, 23, 23, 11, 11, 25, 11, 11, 55, 23, 23, 11, 11, 25, 11, 11, 55, 23, 23, 11, 11, 6, 25, 11,
+    55, 23, 23, 11, 11, 11, 25, 11, 55, 23, 23, 11, 11, 11, 6, 25, 55, 23, 23, 11, 11, 11, 25, 6, 55, 23, 23, 11, 11, 11, 25, 11,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 24, 11, 11, 11, 11, 11, 24, 24, 6, 11, 11, 11, 11, 11, 6, 24, 11, 11, 11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11,
-    55, 22, 22, 11, 11, 24, 6, 11, 55, 22, 22, 11, 11, 24, 11, 11, 55, 22, 22, 11, 11, 24, 11, 11, 55, 22, 22, 6, 6, 24, 6, 6,
-    55, 24, 24, 24, 24, 24, 24, 24, 55, 24, 24, 24, 24, 24, 24, 24, 55, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
-    11, 6, 24, 24, 11, 11, 11, 11, 11, 11, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
+    11, 11, 25, 11, 11, 11, 11, 11, 25, 25, 6, 11, 11, 11, 11, 11, 6, 25, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11,
+    55, 23, 23, 11, 11, 25, 6, 11, 55, 23, 23, 11, 11, 25, 11, 11, 55, 23, 23, 11, 11, 25, 11, 11, 55, 23, 23, 6, 6, 25, 6, 6,
+    55, 25, 25, 25, 25, 25, 25, 25, 55, 25, 25, 25, 25, 25, 25, 25, 55, 25, 25, 25, 25, 25, 25, 25, 55, 55, 55, 55, 55, 55, 55, 55,
+    11, 6, 25, 25, 11, 11, 11, 11, 11, 11, 6, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 55, 55, 55, 55, 55, 55, 55, 55,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11, 11, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11, 11, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11, 11, 24, 11, 24, 11, 11, 11, 11, 11, 6, 24, 6, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
-    11, 24, 11, 11, 11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11, 24, 6, 6, 6, 6, 6, 6, 6,
-    24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 55, 55, 55, 55, 55, 55, 55, 55,
+    11, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11, 11, 25, 11, 25, 11, 11, 11, 11, 11, 6, 25, 6, 11, 11, 11, 11, 11,
+    11, 25, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11, 25, 6, 6, 6, 6, 6, 6, 6,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 55, 55, 55, 55, 55, 55, 55, 55,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11, 11, 6, 24, 11, 11, 11, 11, 11, 11, 11, 24, 11, 11, 11, 11, 11, 11, 11, 24, 24,
+    11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11, 11, 6, 25, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 11, 11, 11, 11, 25, 25,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 24, 24, 11, 11, 11, 11, 24, 24, 6, 6, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 24, 6, 6, 11, 11, 11, 24, 24, 6, 11, 11, 11, 11, 24, 6, 6, 11, 11, 24, 11, 11, 6, 11, 11, 11, 11, 6,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 25, 11, 11, 11, 11, 25, 25, 6, 6, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 25, 6, 6, 11, 11, 11, 25, 25, 6, 11, 11, 11, 11, 25, 6, 6, 11, 11, 25, 11, 11, 6, 11, 11, 11, 11, 6,
     11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    6, 24, 11, 11, 11, 11, 11, 11, 24, 6, 24, 24, 11, 11, 11, 11, 6, 11, 6, 6, 24, 11, 11, 11, 24, 11, 11, 11, 6, 11, 11, 11,
+    6, 25, 11, 11, 11, 11, 11, 11, 25, 6, 25, 25, 11, 11, 11, 11, 6, 11, 6, 6, 25, 11, 11, 11, 25, 11, 11, 11, 6, 11, 11, 11,
     6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 47, 0, 0, 0, 0, 0, 75, 47, 47, 0, 0, 0, 0, 75, 47, 47, 47,
     0, 0, 0, 75, 47, 47, 47, 47, 0, 0, 75, 47, 47, 47, 47, 47, 0, 75, 47, 47, 47, 47, 47, 47, 75, 47, 47, 47, 47, 47, 47, 47,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 47, 0, 0, 0, 0, 0, 75, 47, 47, 0, 0, 0, 0, 75, 47, 47, 47,
@@ -1459,8 +1007,6 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
     75, 0, 0, 0, 0, 0, 0, 0, 42, 75, 0, 0, 0, 0, 0, 0, 42, 42, 75, 0, 0, 0, 0, 0, 42, 42, 42, 75, 0, 0, 0, 0,
     42, 42, 42, 42, 75, 0, 0, 0, 42, 42, 42, 42, 42, 75, 0, 0, 42, 42, 42, 42, 42, 42, 75, 0, 42, 42, 42, 42, 42, 42, 42, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
     42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
     75, 0, 0, 0, 0, 0, 0, 0, 42, 75, 0, 0, 0, 0, 0, 0, 42, 42, 75, 0, 0, 0, 0, 0, 42, 42, 42, 75, 0, 0, 0, 0,
@@ -1471,208 +1017,597 @@ extern const unsigned char g_BgTiles[] __attribute__((aligned(4))) = {
     42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
     75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42,
     75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    75, 75, 75, 75, 75, 75, 75, 0, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 75, 45, 45, 0, 0, 0, 0, 75, 45, 45, 45,
     0, 0, 0, 75, 45, 45, 45, 45, 0, 0, 75, 45, 45, 45, 45, 45, 0, 75, 45, 45, 45, 45, 45, 45, 75, 45, 45, 45, 45, 45, 45, 45,
     0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 45, 0, 0, 0, 0, 0, 75, 45, 45, 0, 0, 0, 0, 75, 45, 45, 45,
     0, 0, 0, 75, 45, 45, 45, 45, 0, 0, 75, 45, 45, 45, 45, 45, 0, 75, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
     45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
     45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-    75, 0, 0, 0, 0, 0, 0, 0, 21, 75, 0, 0, 0, 0, 0, 0, 21, 21, 75, 0, 0, 0, 0, 0, 21, 21, 21, 75, 0, 0, 0, 0,
-    21, 21, 21, 21, 75, 0, 0, 0, 21, 21, 21, 21, 21, 75, 0, 0, 21, 21, 21, 21, 21, 21, 75, 0, 21, 21, 21, 21, 21, 21, 21, 75,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    75, 0, 0, 0, 0, 0, 0, 0, 21, 75, 0, 0, 0, 0, 0, 0, 21, 21, 75, 0, 0, 0, 0, 0, 21, 21, 21, 75, 0, 0, 0, 0,
-    21, 21, 21, 21, 75, 0, 0, 0, 21, 21, 21, 21, 21, 75, 0, 0, 21, 21, 21, 21, 21, 43, 75, 0, 21, 21, 21, 21, 21, 43, 43, 75,
+    75, 0, 0, 0, 0, 0, 0, 0, 22, 75, 0, 0, 0, 0, 0, 0, 22, 22, 75, 0, 0, 0, 0, 0, 22, 22, 22, 75, 0, 0, 0, 0,
+    22, 22, 22, 22, 75, 0, 0, 0, 22, 22, 22, 22, 22, 75, 0, 0, 22, 22, 22, 22, 22, 22, 75, 0, 22, 22, 22, 22, 22, 22, 22, 75,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    75, 0, 0, 0, 0, 0, 0, 0, 22, 75, 0, 0, 0, 0, 0, 0, 22, 22, 75, 0, 0, 0, 0, 0, 22, 22, 22, 75, 0, 0, 0, 0,
+    22, 22, 22, 22, 75, 0, 0, 0, 22, 22, 22, 22, 22, 75, 0, 0, 22, 22, 22, 22, 22, 43, 75, 0, 22, 22, 22, 22, 22, 43, 43, 75,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
-    0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 75, 48, 21, 21, 0, 0, 0, 0, 75, 21, 6, 6, 0, 0, 0, 0, 75, 48, 21, 21,
+    0, 0, 0, 0, 0, 75, 75, 0, 0, 0, 0, 0, 75, 48, 22, 22, 0, 0, 0, 0, 75, 22, 6, 6, 0, 0, 0, 0, 75, 48, 22, 22,
     67, 67, 0, 0, 0, 0, 0, 0, 67, 48, 67, 0, 0, 0, 0, 0, 50, 2, 48, 67, 0, 0, 0, 0, 2, 2, 2, 48, 67, 0, 0, 0,
-    2, 2, 2, 2, 48, 67, 0, 0, 0, 2, 2, 48, 75, 48, 67, 0, 6, 6, 6, 21, 75, 75, 48, 67, 21, 21, 21, 48, 75, 0, 67, 67,
-    0, 0, 0, 0, 75, 48, 48, 48, 0, 0, 0, 0, 75, 48, 48, 48, 0, 0, 0, 0, 75, 48, 66, 66, 0, 0, 0, 75, 48, 48, 66, 66,
-    0, 0, 75, 75, 48, 48, 48, 48, 0, 0, 0, 0, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 48, 48, 48, 75, 0, 0, 0, 48, 48, 48, 48, 75, 0, 0, 0, 48, 48, 66, 48, 75, 0, 0, 0, 48, 48, 48, 48, 48, 75, 0, 0,
-    48, 48, 48, 48, 48, 75, 75, 0, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
+    2, 2, 2, 2, 48, 67, 0, 0, 0, 2, 2, 48, 75, 48, 67, 0, 6, 6, 6, 22, 75, 75, 48, 67, 22, 22, 22, 48, 75, 0, 67, 67,
     75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
     75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
     42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75,
     42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75,
-    42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75,
-    18, 18, 18, 18, 18, 18, 18, 18, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    18, 18, 18, 18, 18, 18, 18, 18, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 19, 19, 19, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
-    75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
-    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
     75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
     75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
-    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 18, 47, 47, 47, 47, 47, 47, 18, 41, 47, 47, 47, 47, 47, 18, 41, 41, 47, 47, 47, 47, 18, 41, 41, 0,
-    47, 47, 47, 18, 41, 41, 0, 0, 47, 47, 18, 41, 41, 0, 0, 0, 47, 18, 41, 41, 0, 0, 0, 0, 18, 41, 41, 0, 0, 0, 0, 0,
-    75, 63, 63, 47, 47, 47, 47, 18, 75, 63, 63, 47, 47, 47, 18, 41, 75, 63, 63, 47, 47, 18, 41, 41, 75, 63, 63, 47, 18, 41, 41, 0,
-    75, 63, 63, 18, 41, 41, 0, 0, 75, 63, 18, 41, 41, 0, 0, 0, 75, 18, 41, 41, 0, 0, 0, 0, 75, 41, 41, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75,
+    22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75,
+    47, 47, 47, 47, 47, 47, 47, 19, 47, 47, 47, 47, 47, 47, 19, 41, 47, 47, 47, 47, 47, 19, 41, 41, 47, 47, 47, 47, 19, 41, 41, 0,
+    47, 47, 47, 19, 41, 41, 0, 0, 47, 47, 19, 41, 41, 0, 0, 0, 47, 19, 41, 41, 0, 0, 0, 0, 19, 41, 41, 0, 0, 0, 0, 0,
+    75, 63, 63, 47, 47, 47, 47, 19, 75, 63, 63, 47, 47, 47, 19, 41, 75, 63, 63, 47, 47, 19, 41, 41, 75, 63, 63, 47, 19, 41, 41, 0,
+    75, 63, 63, 19, 41, 41, 0, 0, 75, 63, 19, 41, 41, 0, 0, 0, 75, 19, 41, 41, 0, 0, 0, 0, 75, 41, 41, 0, 0, 0, 0, 0,
     41, 41, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    18, 42, 42, 42, 42, 42, 42, 42, 41, 18, 42, 42, 42, 42, 42, 42, 41, 41, 18, 42, 42, 42, 42, 42, 0, 41, 41, 18, 42, 42, 42, 42,
-    0, 0, 41, 41, 18, 42, 42, 42, 0, 0, 0, 41, 41, 18, 42, 42, 0, 0, 0, 0, 41, 41, 18, 42, 0, 0, 0, 0, 0, 41, 41, 18,
-    42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75,
-    42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75, 42, 42, 42, 42, 42, 63, 63, 75,
-    0, 0, 0, 0, 0, 0, 41, 41, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    18, 42, 42, 42, 42, 63, 63, 75, 41, 18, 42, 42, 42, 63, 63, 75, 41, 41, 18, 42, 42, 63, 63, 75, 0, 41, 41, 18, 42, 63, 63, 75,
-    0, 0, 41, 41, 18, 63, 63, 75, 0, 0, 0, 41, 41, 18, 63, 75, 0, 0, 0, 0, 41, 41, 18, 75, 0, 0, 0, 0, 0, 41, 41, 75,
-    75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42,
-    75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    19, 42, 42, 42, 42, 42, 42, 42, 41, 19, 42, 42, 42, 42, 42, 42, 41, 41, 19, 42, 42, 42, 42, 42, 0, 41, 41, 19, 42, 42, 42, 42,
+    0, 0, 41, 41, 19, 42, 42, 42, 0, 0, 0, 41, 41, 19, 42, 42, 0, 0, 0, 0, 41, 41, 19, 42, 0, 0, 0, 0, 0, 41, 41, 19,
+    19, 42, 42, 42, 42, 63, 63, 75, 41, 19, 42, 42, 42, 63, 63, 75, 41, 41, 19, 42, 42, 63, 63, 75, 0, 41, 41, 19, 42, 63, 63, 75,
+    0, 0, 41, 41, 19, 63, 63, 75, 0, 0, 0, 41, 41, 19, 63, 75, 0, 0, 0, 0, 41, 41, 19, 75, 0, 0, 0, 0, 0, 41, 41, 75,
     75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42, 75, 46, 46, 42, 42, 42, 42, 42,
-    75, 46, 46, 42, 42, 42, 42, 42, 75, 18, 18, 18, 18, 18, 18, 18, 75, 41, 41, 41, 41, 41, 41, 41, 75, 41, 41, 41, 41, 41, 41, 41,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 18, 18, 18, 18, 18, 18, 18, 18, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    75, 46, 46, 42, 42, 42, 42, 42, 75, 19, 19, 19, 19, 19, 19, 19, 75, 41, 41, 41, 41, 41, 41, 41, 75, 41, 41, 41, 41, 41, 41, 41,
     42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 18, 18, 18, 18, 18, 18, 18, 18, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 18, 18, 18, 18, 18, 18, 18, 18, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
-    42, 42, 42, 42, 42, 42, 42, 42, 18, 18, 18, 18, 18, 18, 18, 18, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
-    42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75, 42, 42, 42, 42, 42, 46, 46, 75,
-    42, 42, 42, 42, 42, 46, 46, 75, 18, 18, 18, 18, 18, 18, 18, 75, 41, 41, 41, 41, 41, 41, 41, 75, 41, 41, 41, 41, 41, 41, 41, 75,
-    75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
-    75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45, 75, 63, 63, 45, 45, 45, 45, 45,
-    45, 45, 45, 45, 45, 45, 45, 19, 45, 45, 45, 45, 45, 45, 19, 45, 45, 45, 45, 45, 45, 19, 45, 45, 45, 45, 45, 45, 19, 45, 45, 0,
-    45, 45, 45, 19, 45, 45, 0, 0, 45, 45, 19, 45, 45, 0, 0, 0, 45, 19, 45, 45, 0, 0, 0, 0, 19, 45, 45, 0, 0, 0, 0, 0,
-    75, 63, 63, 45, 45, 45, 45, 19, 75, 63, 63, 45, 45, 45, 19, 45, 75, 63, 63, 45, 45, 19, 45, 45, 75, 63, 63, 45, 19, 45, 45, 0,
-    75, 63, 63, 19, 45, 45, 0, 0, 75, 63, 19, 45, 45, 0, 0, 0, 75, 19, 45, 45, 0, 0, 0, 0, 75, 45, 45, 0, 0, 0, 0, 0,
+    42, 42, 42, 42, 42, 42, 42, 42, 19, 19, 19, 19, 19, 19, 19, 19, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    45, 45, 45, 45, 45, 45, 45, 20, 45, 45, 45, 45, 45, 45, 20, 45, 45, 45, 45, 45, 45, 20, 45, 45, 45, 45, 45, 45, 20, 45, 45, 0,
+    45, 45, 45, 20, 45, 45, 0, 0, 45, 45, 20, 45, 45, 0, 0, 0, 45, 20, 45, 45, 0, 0, 0, 0, 20, 45, 45, 0, 0, 0, 0, 0,
+    75, 63, 63, 45, 45, 45, 45, 20, 75, 63, 63, 45, 45, 45, 20, 45, 75, 63, 63, 45, 45, 20, 45, 45, 75, 63, 63, 45, 20, 45, 45, 0,
+    75, 63, 63, 20, 45, 45, 0, 0, 75, 63, 20, 45, 45, 0, 0, 0, 75, 20, 45, 45, 0, 0, 0, 0, 75, 45, 45, 0, 0, 0, 0, 0,
     45, 45, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    19, 21, 21, 21, 21, 21, 21, 21, 45, 19, 21, 21, 21, 21, 21, 21, 45, 45, 19, 21, 21, 21, 21, 21, 0, 45, 45, 19, 21, 21, 21, 21,
-    0, 0, 45, 45, 19, 21, 21, 21, 0, 0, 0, 45, 45, 19, 21, 21, 0, 0, 0, 0, 45, 45, 19, 21, 0, 0, 0, 0, 0, 45, 45, 19,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    0, 0, 0, 0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 22, 22, 22, 22, 22, 22, 22, 45, 20, 22, 22, 22, 22, 22, 22, 45, 45, 20, 22, 22, 22, 22, 22, 0, 45, 45, 20, 22, 22, 22, 22,
+    0, 0, 45, 45, 20, 22, 22, 22, 0, 0, 0, 45, 45, 20, 22, 22, 0, 0, 0, 0, 45, 45, 20, 22, 0, 0, 0, 0, 0, 45, 45, 20,
+    20, 22, 22, 22, 22, 43, 43, 75, 45, 20, 22, 22, 22, 43, 43, 75, 45, 45, 20, 22, 22, 43, 43, 75, 0, 45, 45, 20, 22, 43, 43, 75,
+    0, 0, 45, 45, 20, 43, 43, 75, 0, 0, 0, 45, 45, 20, 43, 75, 0, 0, 0, 0, 45, 45, 20, 75, 0, 0, 0, 0, 0, 45, 45, 75,
+    0, 75, 0, 0, 0, 0, 0, 0, 75, 22, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 45, 22, 22, 22, 22, 22, 75, 45, 64, 45, 45, 45, 45, 45,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    19, 21, 21, 21, 21, 43, 43, 75, 45, 19, 21, 21, 21, 43, 43, 75, 45, 45, 19, 21, 21, 43, 43, 75, 0, 45, 45, 19, 21, 43, 43, 75,
-    0, 0, 45, 45, 19, 43, 43, 75, 0, 0, 0, 45, 45, 19, 43, 75, 0, 0, 0, 0, 45, 45, 19, 75, 0, 0, 0, 0, 0, 45, 45, 75,
-    0, 75, 0, 0, 0, 0, 0, 0, 75, 21, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 45, 21, 21, 21, 21, 21, 75, 45, 64, 45, 45, 45, 45, 45,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45,
     75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 75, 75, 75, 75, 75,
-    75, 45, 45, 21, 21, 21, 21, 21, 75, 45, 64, 45, 45, 45, 45, 45, 75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 75, 0, 0, 0, 0, 0,
+    75, 45, 45, 22, 22, 22, 22, 22, 75, 45, 64, 45, 45, 45, 45, 45, 75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 75, 0, 0, 0, 0, 0,
     75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75,
-    21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
     75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 42,
     75, 63, 63, 47, 47, 47, 47, 42, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
     47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 42, 47, 47, 47, 47, 47, 47, 47, 42, 47, 47, 47, 47, 47, 47, 47,
     47, 47, 47, 42, 47, 47, 47, 47, 47, 47, 42, 42, 47, 47, 47, 47, 47, 47, 42, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47, 75, 63, 63, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 43, 21, 21, 21, 21, 21, 21, 21, 43, 43, 21, 21, 43, 21, 21, 21, 43, 43, 43, 21, 43,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 43, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 43, 43, 21, 21, 21, 21, 21, 21, 21, 43, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 43, 21,
-    21, 21, 21, 21, 21, 21, 43, 43, 21, 21, 21, 21, 21, 21, 21, 43, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-    43, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
-    21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75, 21, 21, 21, 21, 21, 43, 43, 75,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 43, 22, 22, 43, 22, 22, 22, 43, 43, 43, 22, 43,
+    22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75,
+    22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 22, 22, 22, 22, 22, 43, 43, 75, 43, 22, 22, 22, 22, 43, 43, 75,
+    22, 22, 22, 22, 43, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22,
+    22, 22, 22, 22, 22, 22, 43, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 22, 75, 0, 0, 0, 0, 0,
+    75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 45, 22, 22, 22, 22, 22, 75, 45, 64, 45, 45, 45, 45, 45, 75, 45, 75, 75, 75, 75, 75, 75,
+    75, 45, 45, 22, 22, 22, 22, 22, 75, 45, 64, 45, 45, 45, 45, 45, 75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 75, 0, 0, 0, 0, 0,
+    75, 75, 75, 75, 75, 75, 75, 75, 22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75,
+    22, 22, 22, 22, 22, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
+    75, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 64, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    45, 45, 75, 0, 0, 0, 0, 0, 64, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 28, 29, 78, 29, 29, 29, 29, 29, 29, 78, 14, 29, 29, 29, 29, 29, 78, 14, 14, 29, 29, 29, 29, 29, 78, 14, 26,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    78, 29, 29, 29, 29, 29, 29, 29, 14, 78, 78, 29, 29, 29, 29, 29, 14, 14, 14, 78, 29, 29, 29, 29, 26, 14, 14, 78, 29, 29, 29, 29,
+    29, 29, 29, 78, 78, 78, 26, 26, 29, 29, 78, 14, 14, 14, 26, 26, 29, 29, 78, 14, 14, 26, 26, 26, 29, 28, 78, 26, 26, 26, 26, 26,
+    29, 29, 28, 28, 26, 26, 26, 26, 29, 29, 29, 29, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 26, 26, 78, 28, 29, 29, 29, 26, 26, 26, 14, 78, 29, 29, 29, 26, 26, 26, 14, 78, 78, 29, 29, 26, 26, 26, 14, 14, 14, 78, 28,
+    26, 26, 26, 26, 26, 28, 28, 29, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 78, 78, 29, 29, 29, 29, 29, 78, 14, 14, 29, 29, 29, 29, 29, 78, 14, 14,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 78, 29, 29, 29, 29, 29, 29, 29, 14, 78, 29, 29, 29, 29, 29, 29, 14, 14, 78, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 78, 26, 26, 29, 29, 29, 29, 78, 14, 26, 26, 29, 29, 29, 29, 78, 14, 26, 26, 29, 29, 29, 28, 78, 26, 26, 26,
+    29, 29, 29, 29, 28, 28, 26, 26, 29, 29, 29, 29, 29, 29, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 14, 78, 29, 28, 29, 29, 29, 26, 26, 78, 78, 29, 29, 29, 29, 26, 26, 14, 14, 78, 29, 29, 29, 26, 26, 14, 14, 14, 78, 28, 29,
+    26, 26, 26, 26, 28, 28, 29, 29, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+};
+
+extern const unsigned int g_OverviewTileCount = 160;
+
+extern const int g_OverviewMapSize = 64;
+
+extern const unsigned char g_OverviewTiles[] __attribute__((aligned(4))) = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 33, 32, 32, 32, 32, 32, 32, 33, 35, 58, 32, 32, 32, 32, 32, 35, 35, 58, 32, 32,
+    32, 32, 58, 57, 57, 33, 32, 32, 32, 32, 58, 35, 35, 35, 32, 32, 32, 32, 33, 35, 35, 35, 58, 32, 32, 32, 57, 35, 35, 35, 58, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 58, 58, 32, 32,
+    32, 32, 32, 58, 33, 58, 32, 32, 32, 32, 58, 33, 35, 58, 32, 32, 32, 32, 32, 35, 35, 33, 32, 32, 32, 32, 32, 35, 35, 58, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 42, 42, 42, 32, 32, 75, 42, 48, 48, 48, 48, 32, 32, 42, 48, 48, 48, 48, 48,
+    32, 75, 48, 48, 48, 48, 48, 48, 32, 75, 48, 48, 48, 48, 48, 48, 32, 42, 48, 66, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 42, 75, 42, 42, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    32, 32, 32, 32, 32, 32, 32, 32, 42, 42, 42, 75, 32, 32, 32, 32, 48, 48, 48, 48, 42, 75, 32, 32, 48, 48, 48, 66, 48, 48, 75, 32,
+    48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 33, 33, 58, 32, 32, 32, 32, 33, 35, 35, 33, 32, 32, 32, 58, 35, 35, 35, 35, 33, 32,
+    32, 33, 35, 35, 35, 35, 35, 58, 32, 35, 69, 35, 35, 35, 35, 58, 58, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 35,
+    32, 42, 48, 48, 48, 48, 48, 75, 32, 42, 48, 48, 48, 48, 42, 75, 32, 75, 48, 48, 48, 48, 42, 32, 32, 75, 48, 48, 48, 48, 42, 32,
+    32, 42, 48, 48, 66, 48, 48, 75, 32, 42, 48, 48, 48, 48, 48, 75, 32, 75, 48, 48, 48, 48, 42, 32, 32, 75, 48, 48, 48, 48, 42, 32,
+    32, 58, 35, 35, 35, 35, 33, 32, 32, 58, 35, 35, 35, 35, 35, 32, 32, 35, 35, 35, 35, 35, 35, 58, 32, 35, 57, 57, 57, 57, 35, 58,
+    58, 35, 35, 35, 35, 35, 35, 33, 58, 58, 35, 35, 35, 35, 58, 58, 32, 32, 32, 67, 48, 32, 32, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    32, 75, 48, 48, 48, 48, 48, 81, 32, 75, 48, 48, 48, 48, 81, 36, 32, 42, 48, 48, 48, 81, 36, 36, 32, 42, 48, 48, 81, 36, 39, 36,
+    32, 42, 48, 81, 36, 36, 39, 36, 32, 75, 81, 36, 36, 36, 36, 36, 32, 81, 36, 36, 36, 36, 36, 36, 32, 36, 36, 36, 36, 36, 36, 36,
+    36, 48, 48, 48, 48, 48, 48, 48, 36, 39, 48, 48, 48, 48, 48, 48, 36, 39, 39, 48, 48, 48, 48, 48, 36, 39, 39, 39, 48, 48, 48, 48,
+    36, 39, 39, 39, 39, 48, 48, 48, 12, 39, 39, 39, 39, 39, 48, 48, 39, 39, 39, 39, 40, 39, 39, 48, 81, 39, 39, 39, 40, 39, 39, 39,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 66, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48, 75,
+    48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 48, 75,
+    58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 69, 35, 35, 35, 35, 35, 35, 32, 35, 35, 35, 35, 69, 35, 58,
+    32, 58, 35, 35, 35, 35, 58, 32, 32, 32, 34, 35, 35, 32, 32, 32, 32, 32, 32, 67, 48, 32, 32, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 33, 33, 58, 32, 32, 32, 32, 33, 35, 35, 33, 32, 32, 32, 58, 35, 35, 35, 35, 33, 32,
+    32, 33, 35, 35, 35, 35, 35, 58, 32, 35, 57, 35, 35, 35, 35, 58, 58, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 35,
+    32, 56, 26, 26, 26, 26, 26, 26, 32, 56, 26, 26, 26, 26, 26, 26, 32, 16, 26, 26, 16, 26, 26, 26, 32, 16, 26, 26, 26, 26, 26, 26,
+    32, 16, 26, 26, 26, 16, 26, 26, 32, 56, 26, 26, 26, 26, 26, 26, 32, 16, 26, 26, 16, 26, 26, 26, 32, 16, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 16, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 33, 33, 33, 33, 58, 32, 58, 33, 35, 35, 35, 35, 33, 58, 58, 35, 35, 35, 35, 35, 35, 58,
+    58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 58, 32, 32, 58, 58, 58, 58, 32, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    48, 36, 36, 36, 36, 36, 36, 40, 48, 36, 36, 36, 36, 36, 40, 40, 48, 36, 36, 36, 36, 40, 40, 40, 48, 36, 36, 36, 40, 40, 40, 40,
+    48, 36, 36, 40, 40, 40, 40, 40, 48, 36, 40, 40, 40, 40, 40, 81, 48, 40, 40, 40, 40, 40, 40, 75, 48, 40, 40, 40, 40, 40, 81, 48,
+    81, 30, 39, 39, 40, 39, 39, 36, 81, 40, 30, 39, 39, 39, 39, 36, 81, 40, 40, 30, 39, 39, 39, 36, 81, 40, 40, 40, 30, 39, 39, 36,
+    22, 40, 40, 40, 40, 30, 39, 36, 22, 40, 40, 40, 40, 40, 30, 36, 22, 81, 40, 40, 40, 40, 40, 81, 48, 48, 81, 40, 40, 40, 40, 81,
+    48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 35, 32, 35, 35, 35, 35, 57, 35, 58,
+    32, 58, 35, 35, 35, 35, 58, 32, 32, 32, 34, 35, 35, 32, 32, 32, 32, 32, 32, 67, 48, 32, 32, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 25, 25, 25, 25, 32, 32, 32, 32, 25, 32, 25, 25, 6, 6, 6, 6, 75, 75, 32, 32, 32, 32, 32, 32,
+    75, 75, 32, 32, 32, 32, 32, 32, 75, 75, 34, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 25, 25, 25, 25, 6, 6, 6, 6, 25, 25, 32, 9, 32, 32, 32, 32, 32, 32, 32, 45,
+    32, 32, 32, 32, 32, 32, 32, 45, 32, 32, 34, 32, 32, 32, 32, 45, 32, 32, 32, 32, 32, 32, 75, 45, 32, 32, 32, 32, 32, 32, 32, 45,
+    32, 32, 32, 32, 32, 32, 32, 81, 75, 75, 42, 42, 42, 75, 81, 36, 48, 48, 48, 48, 48, 81, 36, 36, 48, 48, 48, 48, 81, 36, 39, 36,
+    48, 48, 48, 81, 36, 36, 39, 36, 48, 48, 81, 36, 36, 36, 36, 36, 48, 81, 36, 36, 36, 36, 36, 36, 48, 36, 36, 36, 36, 36, 36, 36,
+    36, 48, 48, 48, 48, 48, 48, 48, 36, 39, 48, 48, 48, 48, 48, 48, 36, 39, 39, 66, 48, 48, 48, 48, 36, 39, 39, 39, 48, 48, 48, 48,
+    36, 39, 39, 39, 39, 48, 48, 48, 12, 39, 39, 39, 39, 39, 48, 48, 39, 39, 39, 39, 40, 39, 39, 48, 81, 39, 39, 39, 40, 39, 39, 39,
+    48, 48, 48, 48, 48, 48, 48, 81, 48, 48, 48, 48, 48, 48, 81, 36, 48, 48, 48, 48, 48, 81, 36, 36, 48, 48, 48, 48, 81, 36, 39, 36,
+    48, 48, 48, 81, 36, 36, 39, 36, 48, 48, 81, 36, 36, 36, 36, 36, 48, 81, 36, 36, 36, 36, 36, 36, 48, 36, 36, 36, 36, 36, 36, 36,
+    32, 75, 48, 48, 48, 48, 48, 48, 32, 75, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48,
+    32, 42, 48, 48, 48, 66, 48, 48, 32, 75, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 71, 71, 48, 48, 48, 48, 48, 48, 71, 69, 71, 48, 48, 48, 48, 71, 69, 69, 75, 48, 48,
+    48, 75, 71, 69, 69, 69, 48, 48, 48, 48, 71, 69, 69, 71, 75, 48, 48, 75, 48, 42, 48, 75, 75, 48, 48, 48, 42, 48, 75, 75, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 42, 42, 48, 48, 42, 42, 48, 48, 32, 32, 75, 75, 32, 32, 75, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 75, 75, 42, 42, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 42, 42, 48, 48, 42, 42, 42, 48, 32, 32, 75, 75, 32, 32, 75, 75,
+    32, 75, 48, 48, 48, 48, 42, 32, 75, 42, 48, 48, 48, 48, 42, 32, 48, 48, 48, 66, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48, 75,
+    48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32, 42, 48, 48, 48, 48, 48, 42, 32, 32, 42, 48, 48, 48, 48, 48, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 33, 32, 58, 58, 32, 32, 32, 32, 35, 58, 58, 32, 32, 32, 32, 32, 35, 35, 58, 32, 32,
+    32, 42, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48, 32, 75, 48, 48, 48, 48, 48, 48, 32, 75, 48, 48, 48, 66, 48, 48,
+    32, 32, 42, 48, 48, 48, 48, 48, 32, 32, 75, 48, 48, 48, 48, 48, 32, 32, 32, 75, 42, 42, 48, 48, 32, 32, 32, 32, 32, 32, 75, 75,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 66, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 58, 33, 48, 58, 58, 48, 48, 48, 48, 35, 58, 58, 48, 48, 48, 48, 48, 35, 35, 58, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 81, 40, 40, 40, 40, 40, 81, 25, 81, 40, 40, 40, 40, 40, 40, 6,
+    81, 40, 40, 40, 40, 40, 40, 6, 81, 40, 40, 40, 40, 40, 40, 25, 81, 61, 61, 61, 61, 61, 81, 25, 48, 48, 48, 48, 48, 48, 42, 32,
+    48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32,
+    48, 48, 48, 48, 48, 48, 75, 32, 48, 48, 48, 48, 48, 75, 32, 32, 48, 48, 42, 42, 75, 34, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 33, 33, 33, 33, 58, 32, 58, 33, 35, 57, 35, 35, 33, 58, 58, 35, 35, 35, 35, 35, 35, 58,
+    58, 35, 35, 35, 35, 35, 35, 35, 58, 35, 35, 35, 35, 35, 35, 58, 32, 32, 58, 58, 58, 58, 32, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    71, 71, 71, 25, 25, 71, 71, 25, 71, 69, 69, 6, 6, 69, 69, 6, 71, 69, 69, 6, 6, 69, 69, 6, 71, 69, 69, 6, 6, 69, 69, 6,
+    71, 70, 70, 9, 9, 70, 70, 9, 75, 75, 26, 26, 26, 26, 26, 26, 75, 75, 26, 16, 26, 26, 26, 26, 75, 75, 26, 26, 26, 26, 26, 26,
+    71, 71, 25, 25, 71, 71, 25, 25, 69, 69, 6, 6, 69, 69, 6, 6, 69, 69, 6, 6, 69, 69, 6, 6, 69, 69, 6, 6, 69, 69, 6, 6,
+    70, 70, 9, 9, 70, 70, 9, 9, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    75, 75, 26, 26, 26, 26, 26, 26, 75, 75, 26, 26, 26, 26, 26, 26, 75, 75, 26, 60, 60, 26, 26, 26, 75, 75, 22, 31, 31, 65, 84, 22,
+    75, 75, 22, 51, 51, 51, 79, 22, 75, 45, 22, 22, 22, 22, 22, 22, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 84, 60, 60, 26, 26, 26, 75, 26, 44, 44, 31, 26, 26, 22, 22, 22, 17, 17, 6, 22, 22,
+    22, 22, 22, 17, 44, 60, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 75, 75, 75, 75, 75, 75, 75, 75, 26, 26, 26, 26, 26, 26, 26, 26,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 42, 42, 42, 32, 32, 75, 42, 48, 28, 28, 28, 32, 32, 42, 28, 28, 29, 29, 29,
+    32, 75, 28, 28, 29, 29, 29, 29, 32, 75, 28, 28, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 75, 75, 42, 42, 48, 48, 28, 28, 48, 48, 28, 28, 28, 28, 29, 29, 28, 28, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    32, 32, 32, 32, 32, 32, 32, 32, 42, 42, 42, 75, 32, 32, 32, 32, 28, 28, 28, 48, 42, 75, 32, 32, 29, 29, 29, 28, 28, 42, 75, 32,
+    29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 28, 75, 29, 29, 29, 29, 29, 28, 28, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 32, 67, 67, 32, 32, 67, 32, 32, 22, 67, 34, 32, 32, 32, 67, 67, 48, 48, 32, 32, 32,
+    32, 48, 22, 48, 48, 32, 67, 32, 32, 32, 67, 48, 48, 67, 48, 32, 32, 32, 32, 48, 48, 22, 67, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    32, 75, 28, 28, 29, 29, 29, 29, 32, 75, 28, 28, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29,
+    32, 75, 28, 28, 29, 29, 29, 29, 32, 75, 28, 28, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 28, 75, 29, 29, 29, 29, 29, 28, 28, 75,
+    29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 28, 75, 29, 29, 29, 29, 29, 28, 28, 75,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 5, 5, 5, 5, 5, 5, 5, 26, 5, 7, 7, 7, 7, 7, 7, 26, 5, 28, 28, 28, 28, 28, 28,
+    26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29,
+    26, 26, 26, 26, 26, 26, 26, 26, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 28, 28, 28, 28, 28, 28, 28, 28,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 26, 26, 26, 26, 26, 26, 26, 5, 5, 5, 5, 5, 5, 5, 54, 7, 7, 7, 7, 7, 7, 5, 54, 28, 28, 28, 28, 28, 28, 5, 54,
+    29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 58, 58, 58, 58, 32, 32,
+    32, 58, 35, 35, 35, 35, 58, 32, 32, 58, 35, 35, 35, 35, 35, 32, 32, 58, 35, 35, 35, 35, 35, 32, 32, 32, 35, 35, 35, 35, 32, 32,
+    32, 32, 32, 48, 48, 32, 32, 32, 32, 32, 32, 48, 48, 32, 32, 32, 67, 67, 67, 48, 48, 34, 32, 32, 32, 48, 48, 48, 48, 32, 32, 32,
+    32, 32, 32, 48, 48, 67, 67, 32, 32, 32, 34, 48, 48, 48, 32, 32, 32, 32, 32, 48, 48, 32, 32, 32, 32, 32, 67, 48, 48, 67, 32, 32,
+    75, 28, 28, 29, 29, 29, 29, 29, 28, 28, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 50, 1, 1, 50, 29, 29,
+    29, 60, 4, 17, 4, 31, 29, 29, 29, 60, 31, 31, 31, 18, 29, 29, 29, 29, 60, 18, 60, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29,
+    26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54,
+    29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 72, 32, 32, 32, 32, 32, 34, 69, 69, 72, 32, 32, 32, 32, 60, 72, 69, 60, 60, 32, 32, 32, 32, 35, 35, 60, 32, 32,
+    26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 29, 29, 29, 29, 29,
+    26, 5, 28, 29, 29, 29, 29, 29, 26, 5, 28, 28, 28, 28, 28, 28, 26, 4, 4, 4, 4, 4, 4, 4, 26, 7, 7, 7, 7, 7, 7, 7,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 28, 28, 28, 28, 4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7,
+    29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54, 29, 29, 29, 29, 29, 28, 5, 54,
+    29, 29, 29, 29, 29, 28, 5, 54, 28, 28, 28, 28, 28, 28, 5, 54, 4, 4, 4, 4, 4, 4, 4, 54, 7, 7, 7, 7, 7, 7, 7, 54,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 83, 32, 32, 32, 32, 32, 34, 38, 38, 83, 32, 32, 32, 32, 60, 83, 38, 60, 60, 32, 32, 32, 32, 35, 35, 60, 32, 32,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 14, 14, 29, 29, 29,
+    29, 29, 78, 26, 26, 78, 29, 29, 29, 29, 78, 26, 26, 14, 78, 29, 29, 29, 28, 26, 26, 26, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 75, 75, 32, 32, 32, 32, 75, 6, 6, 22, 75, 32,
+    32, 32, 75, 48, 48, 48, 75, 32, 32, 32, 48, 66, 48, 48, 75, 32, 32, 75, 48, 48, 48, 48, 75, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 42, 32, 29, 75, 75, 75, 75, 75, 75, 75, 75, 45, 45, 45, 45, 45, 45, 22,
+    75, 45, 45, 45, 22, 45, 45, 22, 75, 22, 22, 22, 22, 22, 22, 75, 28, 45, 45, 45, 45, 45, 45, 45, 29, 28, 75, 75, 75, 75, 75, 28,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 22, 75, 32, 32, 32, 32, 32, 54, 45, 32, 32, 32,
+    32, 32, 54, 32, 45, 75, 32, 32, 54, 32, 34, 32, 45, 75, 32, 32, 32, 32, 32, 75, 45, 75, 32, 32, 32, 32, 32, 32, 28, 32, 32, 32,
+    26, 26, 26, 26, 26, 26, 26, 75, 26, 26, 26, 26, 26, 26, 75, 45, 26, 26, 26, 26, 26, 75, 45, 45, 26, 26, 26, 26, 75, 45, 45, 45,
+    26, 16, 26, 75, 45, 45, 45, 45, 26, 16, 75, 45, 45, 45, 45, 45, 26, 75, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45,
+    75, 26, 26, 26, 26, 26, 26, 26, 22, 75, 26, 26, 26, 26, 26, 26, 22, 22, 75, 26, 26, 26, 26, 26, 22, 22, 22, 75, 26, 26, 26, 26,
+    22, 22, 22, 22, 75, 26, 26, 26, 22, 22, 22, 22, 22, 75, 26, 26, 22, 22, 22, 22, 22, 22, 75, 26, 22, 22, 22, 22, 22, 22, 22, 75,
+    32, 32, 32, 32, 32, 32, 32, 75, 32, 32, 32, 32, 32, 32, 75, 47, 32, 32, 32, 32, 32, 75, 47, 47, 32, 32, 32, 32, 75, 47, 47, 47,
+    32, 32, 32, 75, 47, 47, 47, 47, 32, 32, 75, 47, 47, 47, 47, 47, 32, 75, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47,
+    75, 32, 32, 32, 32, 32, 32, 32, 42, 75, 32, 32, 32, 32, 32, 32, 42, 42, 75, 32, 32, 34, 32, 32, 42, 42, 42, 75, 32, 32, 32, 32,
+    42, 42, 42, 42, 75, 32, 32, 32, 42, 42, 42, 42, 42, 75, 32, 32, 42, 42, 42, 42, 42, 42, 75, 32, 42, 42, 42, 42, 42, 42, 42, 75,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 75, 75, 75, 75, 75, 75, 75, 75, 45, 45, 45, 45, 45, 45, 22,
+    75, 45, 45, 45, 22, 45, 45, 22, 75, 22, 22, 22, 22, 22, 22, 75, 28, 45, 45, 45, 45, 45, 45, 45, 29, 28, 75, 75, 75, 75, 75, 28,
+    32, 32, 32, 32, 32, 32, 32, 75, 32, 32, 32, 32, 32, 32, 75, 45, 32, 32, 32, 32, 32, 75, 45, 45, 32, 32, 32, 32, 75, 45, 45, 45,
+    32, 32, 32, 75, 45, 45, 45, 45, 32, 32, 75, 45, 45, 45, 45, 45, 32, 75, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45,
+    75, 32, 32, 32, 32, 32, 32, 32, 22, 75, 32, 32, 32, 32, 32, 32, 22, 22, 75, 32, 32, 34, 32, 32, 22, 22, 22, 75, 32, 32, 32, 32,
+    22, 22, 22, 22, 75, 32, 32, 32, 22, 22, 22, 22, 22, 75, 32, 32, 22, 22, 22, 22, 22, 22, 75, 32, 22, 22, 22, 22, 22, 22, 22, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42,
+    75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42,
+    75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45,
+    75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45,
+    22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43,
+    22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43,
+    75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 42, 47, 47, 47, 75, 63, 47, 47, 47, 42, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47,
+    75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47,
+    42, 42, 42, 42, 42, 42, 42, 63, 42, 42, 42, 42, 42, 42, 42, 63, 42, 42, 42, 42, 42, 42, 42, 63, 42, 42, 42, 42, 42, 42, 42, 63,
+    42, 42, 42, 42, 42, 42, 42, 63, 42, 42, 42, 42, 42, 42, 42, 63, 42, 42, 42, 42, 42, 42, 42, 63, 42, 42, 42, 42, 42, 42, 42, 63,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 29, 29, 29, 29, 29, 28, 28, 42, 29, 29, 29, 29, 29, 28, 42, 32,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 58, 33, 33, 58, 29, 29, 29, 29, 33, 35, 35, 33, 29, 29, 29, 58, 35, 35, 35, 35, 33, 29,
+    58, 33, 35, 35, 35, 35, 35, 58, 28, 35, 57, 35, 35, 35, 35, 58, 58, 35, 35, 35, 35, 35, 35, 33, 58, 35, 35, 35, 35, 35, 35, 35,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 28, 28, 28, 28, 28, 42, 42, 28, 28, 42, 42, 28, 28, 32, 32, 75, 75, 32, 32, 75, 75,
+    29, 29, 29, 29, 29, 28, 28, 75, 29, 29, 29, 29, 29, 28, 28, 75, 29, 29, 29, 29, 29, 28, 42, 32, 29, 29, 29, 29, 29, 28, 42, 32,
+    29, 29, 29, 29, 28, 28, 75, 32, 28, 28, 28, 28, 28, 75, 32, 32, 28, 28, 42, 42, 75, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32,
+    22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 43, 22, 22, 22, 22, 43,
+    22, 22, 43, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 43, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 43,
+    32, 32, 32, 32, 32, 32, 32, 32, 56, 56, 16, 16, 16, 56, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26,
+    26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    56, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26,
+    26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42,
+    75, 46, 42, 42, 42, 42, 42, 42, 75, 46, 42, 42, 42, 42, 42, 42, 75, 19, 42, 42, 42, 42, 42, 42, 75, 41, 41, 41, 41, 41, 41, 41,
+    75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 45, 75, 63, 45, 45, 45, 45, 45, 11, 75, 63, 45, 45, 45, 45, 11, 11,
+    75, 63, 45, 45, 45, 11, 11, 11, 75, 63, 45, 45, 11, 11, 11, 11, 75, 20, 45, 11, 11, 11, 11, 11, 75, 45, 11, 11, 11, 11, 11, 11,
+    20, 22, 22, 22, 22, 22, 22, 43, 45, 20, 22, 22, 22, 22, 22, 43, 11, 45, 20, 22, 22, 22, 22, 43, 11, 11, 45, 20, 22, 22, 22, 43,
+    11, 11, 11, 45, 20, 22, 22, 43, 11, 11, 11, 11, 45, 20, 22, 43, 11, 11, 11, 11, 11, 45, 20, 43, 11, 11, 11, 11, 11, 11, 45, 75,
+    75, 63, 47, 47, 47, 47, 47, 19, 75, 63, 47, 47, 47, 47, 19, 41, 75, 63, 47, 47, 47, 19, 41, 11, 75, 63, 47, 47, 19, 41, 11, 11,
+    75, 63, 47, 19, 41, 11, 11, 11, 75, 63, 19, 41, 11, 11, 11, 11, 75, 19, 41, 11, 11, 11, 11, 11, 75, 41, 11, 11, 11, 11, 11, 11,
+    19, 42, 42, 42, 42, 42, 42, 63, 41, 19, 42, 42, 42, 42, 42, 63, 11, 41, 19, 42, 42, 42, 42, 63, 11, 11, 41, 19, 42, 42, 42, 63,
+    11, 11, 11, 41, 19, 42, 42, 63, 11, 11, 11, 11, 41, 19, 42, 63, 11, 11, 11, 11, 11, 41, 19, 63, 11, 11, 11, 11, 11, 11, 41, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 25, 25, 6, 6, 25, 25, 25, 25, 25, 32, 32, 32, 25, 25, 25, 25, 75, 75, 32, 25, 25, 25, 32, 25,
+    75, 75, 32, 32, 25, 25, 32, 25, 75, 75, 34, 32, 25, 25, 25, 25, 75, 75, 32, 25, 25, 25, 32, 25, 75, 75, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 25, 25, 25, 25, 6, 6, 25, 25, 25, 25, 25, 25, 32, 25, 32, 9, 25, 32, 25, 25, 25, 25, 32, 45,
+    32, 32, 25, 32, 32, 25, 32, 45, 25, 25, 25, 25, 32, 25, 32, 45, 25, 32, 32, 32, 32, 32, 75, 45, 32, 32, 32, 32, 32, 32, 32, 45,
+    32, 75, 28, 75, 29, 29, 29, 29, 32, 75, 75, 45, 29, 29, 75, 45, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 45, 22, 22, 22, 45, 45, 45, 45, 45, 45, 45, 45, 45, 32, 42, 28, 28, 29, 29, 28, 28,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 16, 26, 26, 16, 16,
+    26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 16, 16, 26, 26, 32, 32, 56, 56, 32, 32, 56, 56,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 26, 26, 26, 26, 16, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 26, 26, 56, 26, 26, 26, 26, 26, 26, 26,
+    75, 26, 26, 26, 26, 26, 26, 26, 75, 75, 26, 26, 26, 26, 26, 26, 75, 75, 26, 26, 26, 26, 26, 26, 75, 45, 22, 22, 22, 22, 22, 22,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 26, 26, 26, 26, 26, 26, 75, 45, 22, 22, 22, 22, 22, 22, 75, 75, 75, 75, 75, 75, 75, 75,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 75, 22, 22, 22, 22, 55, 23, 11, 75, 75, 75, 75, 45, 55, 23, 11, 75, 75, 75, 75, 45,
+    55, 23, 11, 75, 45, 45, 45, 45, 55, 23, 11, 75, 45, 45, 45, 45, 55, 25, 25, 75, 45, 45, 45, 45, 55, 25, 25, 75, 45, 45, 45, 45,
+    11, 11, 11, 11, 11, 11, 11, 23, 22, 22, 22, 22, 22, 75, 11, 23, 22, 45, 75, 75, 75, 75, 11, 23, 22, 45, 75, 75, 45, 75, 11, 23,
+    22, 45, 45, 45, 45, 75, 11, 23, 22, 22, 45, 45, 45, 75, 23, 23, 22, 45, 45, 45, 45, 75, 25, 25, 75, 45, 45, 45, 45, 75, 25, 55,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 80, 32, 34, 32, 32, 32, 32, 52, 52, 52, 52, 80, 32,
+    32, 32, 52, 37, 37, 77, 80, 32, 32, 32, 80, 77, 77, 77, 80, 32, 32, 32, 77, 80, 80, 77, 80, 32, 32, 32, 77, 77, 77, 77, 32, 32,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 75, 75, 86, 86, 86, 55, 23, 11, 75, 75, 86, 86, 86, 55, 23, 11, 75, 75, 86, 86, 86,
+    55, 23, 11, 75, 75, 86, 86, 86, 55, 23, 6, 75, 75, 86, 86, 86, 55, 25, 25, 75, 75, 86, 86, 86, 55, 25, 25, 75, 75, 86, 86, 86,
+    11, 11, 11, 11, 11, 11, 11, 23, 86, 86, 86, 86, 75, 75, 11, 23, 86, 86, 86, 86, 75, 75, 11, 23, 86, 86, 86, 86, 75, 75, 11, 23,
+    86, 86, 86, 86, 75, 75, 11, 23, 86, 86, 86, 86, 75, 75, 23, 23, 86, 86, 86, 86, 75, 75, 25, 25, 86, 86, 86, 86, 75, 75, 25, 55,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 60, 31, 31, 60, 29, 29, 29, 29, 60, 31, 60, 60, 29, 29, 29,
+    29, 29, 60, 60, 29, 29, 29, 29, 29, 29, 29, 29, 31, 31, 31, 29, 29, 29, 29, 29, 18, 18, 60, 29, 29, 29, 29, 29, 29, 60, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 78, 78, 29, 29, 29, 29, 29, 29, 14, 14, 14, 29, 29,
+    29, 78, 78, 26, 26, 26, 29, 29, 29, 78, 26, 26, 26, 26, 78, 29, 29, 28, 26, 26, 26, 26, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 47, 32, 32, 32, 75, 75, 47, 47, 47, 75, 32, 32, 75, 47, 47, 47, 47, 47, 75,
+    32, 75, 47, 19, 19, 63, 47, 75, 32, 75, 63, 41, 41, 41, 47, 75, 32, 75, 41, 47, 47, 47, 41, 75, 32, 75, 41, 41, 75, 41, 41, 75,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 25, 25, 25, 25, 25, 25, 25, 55, 25, 25, 25, 25, 25, 25, 25,
+    11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23,
+    11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 55,
+    32, 16, 26, 26, 26, 26, 26, 26, 32, 16, 26, 26, 26, 26, 26, 26, 32, 56, 26, 26, 26, 26, 16, 26, 32, 56, 26, 26, 16, 16, 26, 26,
+    32, 32, 16, 26, 26, 26, 26, 26, 32, 32, 56, 26, 26, 26, 26, 26, 32, 32, 32, 56, 16, 16, 26, 26, 32, 32, 32, 32, 32, 32, 56, 56,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 32, 32, 75, 42, 48, 48, 48, 48, 32, 32, 42, 48, 48, 48, 48, 48,
+    32, 75, 48, 48, 48, 66, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 48, 48, 32, 42, 48, 48, 48, 48, 42, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 42, 75, 75, 32, 48, 48, 48, 48, 48, 48, 48, 42, 48, 48, 48, 48, 48, 48, 48, 42,
+    48, 48, 48, 48, 48, 48, 66, 42, 48, 48, 48, 48, 48, 48, 48, 42, 42, 42, 48, 48, 42, 42, 42, 32, 32, 32, 75, 75, 32, 32, 32, 32,
+    32, 42, 28, 29, 29, 29, 29, 29, 32, 42, 28, 29, 29, 29, 29, 29, 32, 75, 28, 28, 29, 29, 29, 29, 32, 75, 28, 28, 29, 29, 29, 29,
+    32, 32, 42, 28, 29, 29, 29, 29, 32, 32, 75, 28, 28, 28, 28, 28, 32, 32, 32, 75, 42, 42, 28, 28, 32, 32, 32, 32, 32, 32, 75, 75,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 28, 28, 28, 29, 29, 29, 29, 29, 75, 28, 28, 29, 29, 29, 29, 29,
+    32, 32, 32, 32, 67, 32, 32, 32, 32, 32, 32, 32, 2, 48, 32, 32, 32, 32, 75, 22, 2, 2, 48, 32, 32, 32, 75, 6, 6, 22, 75, 67,
+    32, 32, 75, 48, 48, 48, 75, 32, 32, 32, 48, 66, 48, 48, 75, 32, 32, 75, 48, 48, 48, 48, 75, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    75, 75, 28, 28, 29, 29, 29, 29, 42, 75, 28, 28, 29, 29, 29, 29, 42, 42, 75, 29, 29, 29, 29, 29, 42, 42, 42, 75, 29, 29, 29, 29,
+    42, 42, 42, 42, 75, 29, 29, 29, 42, 42, 42, 42, 42, 75, 29, 29, 42, 42, 42, 42, 42, 42, 75, 29, 42, 42, 42, 42, 42, 42, 42, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 34, 32, 32, 32, 75, 22, 22, 22, 22, 75, 32,
+    32, 45, 45, 45, 45, 45, 45, 32, 32, 32, 45, 45, 45, 45, 75, 32, 32, 32, 32, 32, 45, 32, 32, 32, 32, 32, 32, 32, 45, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 75, 32, 32, 32, 32, 32, 32, 32,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 45, 45, 45, 45, 45, 45, 75, 45, 22, 22, 22, 22, 22, 22, 75, 75, 75, 75, 75, 75, 75, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 75, 32, 32, 32, 32, 32, 32, 32,
+    45, 75, 32, 32, 32, 32, 32, 32, 45, 75, 34, 32, 32, 32, 32, 32, 45, 75, 32, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32,
+    75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47,
+    75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47, 75, 63, 47, 47, 47, 47, 47, 47,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 75, 75, 42, 42, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 54, 48, 48, 54, 48, 66, 48, 48, 54, 54, 54, 27, 54, 48, 48, 42, 54, 27, 27, 27, 27, 54, 48, 32, 54, 27, 5, 5, 27, 54, 54,
+    32, 75, 48, 48, 48, 48, 42, 32, 42, 48, 48, 48, 48, 48, 42, 75, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 66, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 42, 42, 42, 48, 48, 42, 42, 75, 32, 32, 32, 75, 75, 32, 32,
+    19, 19, 19, 19, 19, 19, 19, 19, 41, 41, 41, 41, 41, 41, 41, 41, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    32, 54, 27, 5, 5, 27, 27, 27, 32, 54, 7, 24, 5, 27, 24, 54, 32, 5, 27, 27, 27, 27, 27, 54, 32, 5, 5, 5, 27, 24, 27, 5,
+    32, 4, 4, 4, 4, 4, 4, 54, 32, 7, 7, 15, 15, 15, 7, 7, 32, 7, 7, 15, 15, 15, 7, 7, 32, 7, 7, 7, 7, 7, 7, 54,
+    75, 75, 75, 75, 75, 75, 75, 75, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46,
+    42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 75, 75, 75, 75, 75, 75, 75, 75, 75, 45, 86, 86, 45, 86, 45, 45, 75, 75, 86, 45, 45, 86, 45, 45,
+    75, 75, 86, 86, 45, 86, 45, 45, 75, 45, 86, 86, 45, 86, 45, 45, 75, 75, 22, 75, 75, 22, 75, 75, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23,
+    11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23, 11, 11, 11, 11, 11, 11, 11, 23,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 54, 34, 32, 32, 32, 32, 32, 54, 54, 32, 32, 32,
+    32, 32, 4, 7, 7, 4, 54, 32, 32, 32, 54, 54, 7, 54, 32, 32, 32, 32, 32, 54, 7, 32, 32, 32, 32, 32, 32, 54, 7, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 5, 5, 5, 5, 32, 32, 32, 32, 7, 7, 7, 7, 54, 32,
+    32, 32, 7, 27, 27, 7, 54, 32, 32, 32, 7, 7, 27, 7, 54, 32, 32, 32, 7, 7, 7, 7, 54, 32, 32, 32, 7, 7, 7, 7, 54, 32,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 11, 25, 11, 11,
+    11, 11, 25, 6, 6, 11, 11, 11, 11, 6, 11, 11, 11, 6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 41, 41, 41, 41, 41, 41, 41, 41,
+    42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46,
+    42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 42, 46, 42, 42, 42, 42, 42, 42, 19, 75, 41, 41, 41, 41, 41, 41, 41, 41,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 75, 11, 45, 75, 75, 75, 75, 75, 75, 11, 45, 86, 75, 75, 86, 75, 75,
+    11, 45, 45, 45, 45, 45, 45, 75, 75, 45, 45, 45, 45, 45, 45, 75, 25, 45, 45, 45, 45, 45, 45, 75, 75, 45, 45, 45, 45, 45, 45, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 67, 32, 67, 67, 32, 32, 32, 32, 67, 22, 67, 32, 32, 32, 22, 67, 48, 48, 67, 32, 32,
+    32, 67, 48, 48, 48, 67, 22, 67, 32, 32, 34, 67, 48, 48, 67, 32, 32, 32, 32, 67, 48, 67, 32, 32, 32, 32, 32, 48, 48, 67, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 5, 5, 5, 5, 54, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32,
+    32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 54, 32, 32, 32, 7, 7, 7, 7, 7, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32,
+    32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 54, 32, 32, 32, 7, 7, 7, 7, 7, 32,
+    11, 11, 11, 11, 11, 11, 11, 11, 75, 75, 22, 22, 22, 22, 75, 75, 75, 75, 86, 86, 45, 86, 45, 45, 75, 45, 86, 45, 45, 86, 45, 45,
+    75, 75, 86, 86, 45, 86, 45, 45, 75, 75, 86, 86, 45, 86, 45, 45, 75, 45, 86, 45, 45, 86, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 32, 34, 32, 32, 32, 32, 22, 22, 22, 22, 32, 32,
+    32, 32, 45, 22, 22, 75, 32, 32, 32, 32, 45, 26, 26, 45, 32, 32, 32, 32, 45, 45, 45, 75, 32, 32, 32, 32, 45, 26, 26, 75, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 56, 16, 16, 56, 56, 16, 16, 56, 26, 26, 26, 26, 26, 26, 26, 56, 26, 26, 26, 26, 16, 26, 26,
+    56, 26, 26, 16, 26, 26, 26, 26, 56, 26, 26, 26, 26, 26, 26, 26, 32, 16, 26, 26, 16, 16, 16, 26, 32, 32, 56, 56, 32, 32, 56, 56,
+    32, 32, 32, 32, 32, 32, 32, 32, 56, 56, 16, 16, 56, 56, 16, 16, 26, 26, 26, 26, 26, 26, 26, 26, 26, 16, 16, 26, 26, 16, 26, 26,
+    26, 16, 26, 26, 26, 26, 16, 16, 26, 26, 26, 16, 26, 26, 26, 26, 16, 16, 26, 26, 16, 16, 16, 26, 32, 32, 56, 56, 32, 32, 56, 56,
+    32, 32, 32, 32, 32, 32, 32, 32, 56, 56, 16, 58, 33, 56, 16, 16, 26, 26, 26, 33, 35, 58, 26, 26, 26, 16, 16, 35, 35, 58, 26, 26,
+    26, 16, 58, 57, 57, 33, 16, 16, 26, 26, 58, 35, 35, 35, 26, 26, 16, 58, 33, 35, 35, 35, 58, 26, 32, 32, 57, 35, 35, 35, 58, 56,
+    55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 11, 11, 11, 11, 11, 55, 23, 11, 25, 11, 11, 11, 11, 55, 23, 11, 25, 25, 11, 11, 11,
+    55, 23, 11, 11, 11, 25, 11, 11, 55, 23, 25, 11, 11, 11, 11, 11, 55, 25, 25, 25, 25, 25, 25, 25, 55, 25, 25, 25, 25, 25, 25, 25,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 25, 11, 11, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 75, 22, 22, 22, 22, 75, 11, 11, 45, 75, 75, 75, 75, 45, 11, 11, 45, 75, 75, 75, 75, 45, 75,
+    11, 45, 45, 45, 45, 45, 45, 75, 75, 45, 45, 45, 45, 45, 45, 75, 25, 45, 45, 45, 45, 45, 45, 75, 75, 45, 45, 45, 45, 45, 45, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 32, 32, 32, 32, 32, 32, 75, 32, 32, 32,
+    32, 32, 75, 75, 45, 75, 32, 32, 32, 32, 34, 75, 45, 75, 32, 32, 32, 32, 32, 32, 45, 32, 32, 32, 32, 32, 32, 32, 45, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32,
+    32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 5, 5, 5, 5, 5, 32, 32, 32, 4, 4, 4, 4, 54, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 54, 32, 34, 32, 32, 32, 32, 5, 5, 5, 5, 54, 32,
+    32, 32, 7, 7, 7, 7, 54, 32, 32, 32, 7, 27, 27, 7, 54, 32, 32, 32, 7, 7, 27, 7, 54, 32, 32, 32, 7, 7, 7, 7, 54, 32,
+    32, 5, 35, 35, 35, 35, 35, 35, 32, 5, 35, 35, 72, 69, 35, 35, 32, 5, 72, 69, 69, 69, 60, 35, 32, 60, 69, 69, 60, 69, 35, 35,
+    32, 60, 35, 35, 35, 60, 35, 35, 32, 5, 60, 5, 5, 35, 35, 35, 32, 4, 4, 4, 4, 4, 4, 4, 32, 7, 7, 7, 7, 7, 7, 7,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 69, 72, 35, 35, 35, 35, 35, 60, 69, 69, 72, 69, 72, 35, 35, 35, 35, 35, 60, 69, 69, 60,
+    35, 35, 35, 60, 35, 35, 35, 35, 35, 35, 35, 35, 5, 5, 60, 35, 4, 4, 4, 4, 4, 4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7,
+    35, 35, 35, 35, 35, 35, 5, 54, 35, 35, 35, 35, 69, 72, 5, 54, 35, 35, 69, 72, 69, 69, 60, 54, 35, 60, 69, 69, 60, 35, 60, 54,
+    35, 35, 35, 35, 35, 60, 5, 54, 35, 5, 5, 60, 35, 35, 5, 54, 4, 4, 4, 4, 4, 4, 4, 54, 7, 7, 7, 7, 7, 7, 7, 54,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 42, 42, 75, 42, 42, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 42, 42, 48, 48, 66, 48, 48, 48, 32, 75, 48, 48, 48, 48, 42, 75,
+    32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 42, 58, 33, 75, 42, 42, 48, 48, 48, 33, 35, 58, 48, 48, 48, 48, 48, 35, 35, 58, 48, 48,
+    48, 48, 58, 57, 57, 33, 66, 48, 48, 48, 58, 35, 35, 35, 48, 48, 42, 58, 33, 35, 35, 35, 58, 48, 32, 32, 57, 35, 35, 35, 58, 75,
+    48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 48, 75, 48, 48, 48, 48, 48, 48, 42, 32, 48, 48, 48, 48, 48, 48, 42, 32,
+    48, 48, 48, 48, 48, 48, 75, 32, 48, 48, 48, 48, 48, 75, 32, 32, 48, 48, 42, 42, 75, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 75, 75, 34, 32, 32, 32, 75, 22, 22, 22, 22, 75, 32,
+    32, 75, 45, 45, 45, 45, 45, 32, 32, 75, 45, 45, 45, 45, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32, 32, 32, 32, 75, 75, 32, 32, 32,
+};
+
+extern const unsigned char g_OverviewMap[] __attribute__((aligned(4))) = {
+    1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 4, 5, 5, 6, 7, 1, 1, 8, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 9, 2, 9, 2, 1, 1, 9, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 10, 11, 12, 13, 14, 1, 1, 8, 1, 1, 15,
+    1, 16, 17, 17, 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 2, 9, 2, 9, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 18, 1, 4, 5, 19, 20, 12, 21, 6, 18, 1, 8, 1, 1, 22,
+    1, 16, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 9, 2, 9, 2, 1, 2, 1, 9, 1, 1, 1, 1, 23, 24, 4, 25, 26, 12, 12, 12, 27, 11, 13, 1, 1, 8, 1, 1, 1,
+    1, 16, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 2, 9, 2, 9, 2, 9, 1, 1, 1, 1, 1, 1, 1, 1, 28, 19, 20, 12, 29, 12, 19, 20, 30, 31, 31, 32, 1, 1, 1,
+    1, 16, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 9, 2, 9, 2, 9, 1, 1, 1, 1, 1, 33, 1, 1, 1, 34, 30, 35, 36, 12, 12, 37, 38, 39, 1, 1, 8, 1, 1, 1,
+    40, 16, 17, 41, 42, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 2, 9, 1, 9, 1, 33, 1, 1, 1, 1, 1, 1, 1, 15, 1, 1, 34, 30, 30, 30, 38, 1, 1, 15, 1, 8, 15, 1, 1,
+    1, 16, 17, 43, 44, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 9, 2, 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 22, 1, 1, 1, 45, 46, 46, 46, 46, 47, 22, 1, 8, 22, 1, 1,
+    1, 16, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 2, 9, 2, 9, 3, 1, 1, 1, 9, 1, 48, 1, 1, 1, 1, 1, 1, 49, 50, 50, 50, 50, 51, 1, 1, 8, 1, 1, 1,
+    1, 16, 17, 52, 53, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 9, 2, 9, 2, 1, 1, 1, 55, 1, 1, 56, 1, 1, 45, 46, 46, 46, 57, 50, 50, 58, 50, 51, 1, 1, 8, 1, 55, 15,
+    1, 16, 17, 59, 50, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 2, 9, 2, 9, 1, 1, 2, 1, 1, 1, 1, 61, 1, 49, 50, 50, 50, 50, 50, 50, 50, 50, 51, 1, 1, 8, 1, 1, 22,
+    1, 16, 17, 62, 63, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 9, 2, 9, 1, 1, 1, 9, 1, 1, 1, 65, 1, 61, 49, 50, 66, 50, 50, 50, 50, 50, 50, 51, 1, 1, 8, 40, 1, 1,
+    1, 16, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 1, 9, 2, 1, 67, 1, 1, 1, 1, 1, 1, 65, 1, 49, 50, 50, 50, 50, 50, 50, 50, 50, 68, 69, 1, 8, 1, 40, 1,
+    1, 16, 17, 70, 71, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 2, 1, 2, 9, 2, 1, 1, 72, 73, 1, 61, 1, 1, 45, 57, 74, 50, 50, 50, 50, 50, 50, 50, 51, 1, 1, 8, 1, 75, 76,
+    1, 16, 77, 78, 79, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 2, 9, 2, 9, 2, 9, 1, 1, 80, 81, 1, 1, 1, 1, 49, 50, 50, 58, 50, 50, 50, 82, 83, 84, 85, 61, 1, 8, 1, 78, 86,
+    87, 88, 89, 90, 91, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 9, 1, 9, 2, 9, 1, 1, 1, 92, 93, 1, 94, 95, 1, 96, 50, 58, 50, 50, 50, 50, 51, 22, 1, 1, 1, 1, 8, 1, 90, 91,
+    97, 98, 99, 100, 101, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 1, 1, 1, 9, 1, 1, 2, 102, 103, 104, 1, 1, 1, 1, 49, 50, 50, 50, 105, 50, 106, 51, 1, 1, 39, 39, 1, 8, 107, 108, 109,
+    1, 110, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 2, 1, 1, 111, 31, 31, 112, 1, 33, 1, 1, 113, 84, 84, 114, 50, 50, 82, 85, 1, 1, 33, 1, 1, 8, 1, 1, 1,
+    115, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 2, 9, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 72, 116, 117, 50, 50, 51, 65, 1, 1, 1, 118, 1, 8, 119, 119, 119,
+    119, 119, 120, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1, 1, 9, 1, 1, 1, 8, 1, 72, 116, 73, 1, 33, 1, 1, 121, 122, 81, 84, 83, 85, 1, 65, 1, 111, 123, 31, 124, 31, 31, 31,
+    31, 31, 31, 31, 31, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 1, 1, 1, 1, 15, 1, 8, 1, 121, 122, 81, 1, 1, 1, 1, 92, 125, 93, 1, 22, 1, 1, 1, 1, 8, 126, 1, 1, 1, 1, 1,
+    1, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 22, 1, 8, 1, 92, 125, 93, 116, 116, 127, 1, 128, 129, 130, 1, 1, 1, 1, 1, 1, 8, 1, 40, 1, 131, 132, 1,
+    1, 9, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 3, 1, 33, 1, 1, 8, 1, 128, 133, 130, 134, 134, 135, 1, 108, 136, 109, 1, 15, 1, 137, 1, 1, 8, 1, 1, 1, 138, 139, 1,
+    1, 139, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 33, 1, 8, 1, 128, 140, 141, 141, 141, 130, 1, 1, 8, 142, 1, 22, 7, 1, 1, 1, 8, 1, 1, 1, 143, 144, 144,
+    144, 144, 144, 144, 145, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 1, 1, 1, 1, 1, 8, 1, 146, 147, 147, 148, 149, 109, 1, 1, 8, 1, 33, 1, 14, 1, 1, 1, 8, 1, 1, 40, 150, 151, 1,
+    152, 132, 1, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 9, 1, 1, 1, 1, 1, 8, 1, 153, 154, 154, 155, 8, 1, 1, 1, 8, 119, 119, 119, 119, 119, 120, 1, 8, 1, 1, 1, 143, 144, 144,
+    144, 144, 144, 145, 144, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 111, 124, 31, 31, 31, 31, 31, 124, 31, 31, 31, 124, 31, 31, 31, 156, 31, 157, 31, 158, 1, 40, 1, 150, 1, 1,
+    1, 1, 1, 9, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 40, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 9, 1, 1, 1, 1, 1, 143, 144, 145,
+    144, 144, 144, 144, 145, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 40, 1, 8, 1, 1, 1, 1, 1, 1, 1, 2, 1, 9,
+    1, 2, 1, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 159, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 2, 1, 1, 2, 1, 9, 1, 1,
+    1, 9, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 9, 1, 1, 9, 1, 1, 1, 1,
+    1, 1, 1, 9, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 21, 75, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 45, 21, 21, 21, 21, 21, 75, 45, 64, 45, 45, 45, 45, 45, 75, 45, 75, 75, 75, 75, 75, 75,
-    75, 45, 45, 21, 21, 21, 21, 21, 75, 45, 64, 45, 45, 45, 45, 45, 75, 45, 75, 75, 75, 75, 75, 75, 75, 45, 75, 0, 0, 0, 0, 0,
-    75, 75, 75, 75, 75, 75, 75, 75, 21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75,
-    21, 21, 21, 21, 21, 21, 21, 21, 45, 45, 45, 45, 45, 45, 45, 45, 75, 75, 75, 75, 75, 75, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 0, 75, 21, 75, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    75, 45, 75, 0, 0, 0, 0, 0, 45, 45, 75, 0, 0, 0, 0, 0, 64, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
-    45, 45, 75, 0, 0, 0, 0, 0, 64, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0, 75, 45, 75, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+extern const unsigned int g_TileAnimCount = 1;
+
+extern const unsigned short g_TileAnimBaseTile8[] __attribute__((aligned(4))) = {
+    0x0022,
+};
+
+extern const unsigned short g_TileAnimFirstFrame[] __attribute__((aligned(4))) = {
+    0x0000,
+};
+
+extern const unsigned short g_TileAnimFrameCount[] __attribute__((aligned(4))) = {
+    0x0002,
+};
+
+extern const unsigned short g_TileAnimFrameImage[] __attribute__((aligned(4))) = {
+    0x0000, 0x0001,
+};
+
+extern const unsigned short g_TileAnimFrameTicks[] __attribute__((aligned(4))) = {
+    0x0024, 0x0024,
+};
+
+extern const unsigned char g_TileAnimFrameData[] __attribute__((aligned(4))) = {
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 27, 29, 78, 29, 29, 29, 29, 29, 29, 78, 14, 29, 29, 29, 29, 29, 78, 14, 14, 29, 29, 29, 29, 29, 78, 14, 25,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    78, 29, 29, 29, 29, 29, 29, 29, 14, 78, 78, 29, 29, 29, 29, 29, 14, 14, 14, 78, 29, 29, 29, 29, 25, 14, 14, 78, 29, 29, 29, 29,
-    29, 29, 29, 78, 78, 78, 25, 25, 29, 29, 78, 14, 14, 14, 25, 25, 29, 29, 78, 14, 14, 25, 25, 25, 29, 27, 78, 25, 25, 25, 25, 25,
-    29, 29, 27, 27, 25, 25, 25, 25, 29, 29, 29, 29, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    25, 25, 25, 78, 27, 29, 29, 29, 25, 25, 25, 14, 78, 29, 29, 29, 25, 25, 25, 14, 78, 78, 29, 29, 25, 25, 25, 14, 14, 14, 78, 27,
-    25, 25, 25, 25, 25, 27, 27, 29, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 27, 29, 29, 29, 29, 29, 29, 29, 29, 78, 78, 29, 29, 29, 29, 29, 78, 14, 14, 29, 29, 29, 29, 29, 78, 14, 14,
     29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 29, 29, 29, 78, 29, 29, 29, 29, 29, 29, 29, 14, 78, 29, 29, 29, 29, 29, 29, 14, 14, 78, 29, 29, 29, 29, 29,
-    29, 29, 29, 29, 29, 78, 25, 25, 29, 29, 29, 29, 78, 14, 25, 25, 29, 29, 29, 29, 78, 14, 25, 25, 29, 29, 29, 27, 78, 25, 25, 25,
-    29, 29, 29, 29, 27, 27, 25, 25, 29, 29, 29, 29, 29, 29, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
-    25, 14, 78, 29, 27, 29, 29, 29, 25, 25, 78, 78, 29, 29, 29, 29, 25, 25, 14, 14, 78, 29, 29, 29, 25, 25, 14, 14, 14, 78, 27, 29,
-    25, 25, 25, 25, 27, 27, 29, 29, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 29, 28, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
 };
 
 extern const int g_PlayerWidth = 24;
@@ -1709,7 +1644,7 @@ extern const unsigned char g_PlayerObjTiles[] __attribute__((aligned(4))) = {
     87, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 87, 87, 8, 87, 49, 49, 49, 0, 87, 87, 87, 20, 49, 49, 49, 0, 0, 87, 87, 87, 49, 49, 49, 0, 0, 0, 87, 87, 49, 49, 87,
+    0, 87, 87, 8, 87, 49, 49, 49, 0, 87, 87, 87, 21, 49, 49, 49, 0, 0, 87, 87, 87, 49, 49, 49, 0, 0, 0, 87, 87, 49, 49, 87,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     13, 13, 13, 49, 87, 87, 0, 0, 13, 13, 13, 49, 87, 87, 0, 0, 73, 73, 73, 87, 87, 87, 0, 0, 73, 73, 87, 87, 87, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -1741,7 +1676,7 @@ extern const unsigned char g_PlayerObjTiles[] __attribute__((aligned(4))) = {
     87, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 87, 87, 87, 20, 49, 49, 49, 0, 0, 87, 87, 87, 49, 49, 49, 0, 0, 87, 87, 49, 49, 49, 49, 0, 0, 87, 87, 49, 49, 87, 87,
+    0, 87, 87, 87, 21, 49, 49, 49, 0, 0, 87, 87, 87, 49, 49, 49, 0, 0, 87, 87, 49, 49, 49, 49, 0, 0, 87, 87, 49, 49, 87, 87,
     0, 0, 87, 87, 87, 87, 87, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     13, 13, 13, 49, 87, 87, 88, 0, 13, 13, 13, 49, 87, 87, 87, 0, 49, 49, 49, 49, 73, 87, 87, 0, 87, 87, 87, 73, 73, 87, 87, 0,
     87, 87, 87, 87, 87, 87, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
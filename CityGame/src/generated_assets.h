@@ -0,0 +1,67 @@
+/*------------------------------------------------------------------------
+名称：资源数据声明
+说明：声明 tools/build_assets.py 生成的资源数组，以及 objcopy 生成的 BGM PCM 符号
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：所有数组都位于 ROM（.rodata）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+extern const int g_MapWidth;
+extern const int g_MapHeight;
+extern const int g_TileWidth;
+extern const int g_TileHeight;
+extern const unsigned int g_UsedTileCount;
+
+extern const unsigned short g_Palette[256];
+// 世界区块：图层 l 的区块 (cx, cy) 为 g_WorldChunkIndex[(l * g_WorldChunksH + cy) * g_WorldChunksW + cx]，
+// 0xFFFF 表示全空；否则是唯一区块序号，其 LZ77 数据从 g_WorldChunkData + g_WorldChunkOffset[id] 开始，
+// 解压后为 16x16 个 u16 元 tile 序号（行优先）
+extern const int g_WorldChunksW;
+extern const int g_WorldChunksH;
+extern const unsigned int g_WorldChunkCount;
+extern const unsigned short g_WorldChunkIndex[];
+extern const unsigned int g_WorldChunkOffset[];
+extern const unsigned int g_WorldChunkDataBytes;
+extern const unsigned char g_WorldChunkData[];
+// 碰撞位图：格子 (x, y) 为 g_WorldSolidBits[y * g_WorldSolidStride + (x >> 3)] 的 bit (x & 7)
+extern const int g_WorldSolidStride;
+extern const unsigned char g_WorldSolidBits[];
+// 图层占用区间：图层 l 第 y 行的区间为 g_LayerRowRuns 中第 [idx[i], idx[i + 1]) 对（i = l * (g_MapHeight + 1) + y），
+// 每对为非空格子的 [start, end)；列同理（i = l * (g_MapWidth + 1) + x）
+extern const unsigned short g_LayerRowRunIndex[];
+extern const unsigned short g_LayerRowRuns[];
+extern const unsigned short g_LayerColRunIndex[];
+extern const unsigned short g_LayerColRuns[];
+// 元 tile：第 i 个的 4 个 BG 屏幕条目（左上、右上、左下、右下，含翻转位）为 g_Metatiles[i * 4 + q]，0 号为空
+extern const unsigned int g_MetatileCount;
+extern const unsigned short g_Metatiles[];
+extern const unsigned int g_BgTileCount;
+extern const unsigned char g_BgTiles[];
+// 总览图：8 位仿射 BG，g_OverviewMapSize x g_OverviewMapSize 个条目（行优先，每条目 1 字节），
+// 一个条目对应一个 16x16 世界格子（四层合成后缩小一半）；g_OverviewTiles 为 g_OverviewTileCount 个 8x8 256 色 tile，0 号为空白
+extern const unsigned int g_OverviewTileCount;
+extern const int g_OverviewMapSize;
+extern const unsigned char g_OverviewTiles[];
+extern const unsigned char g_OverviewMap[];
+
+// 动画 tile：第 i 个动画的帧为 [g_TileAnimFirstFrame[i], + g_TileAnimFrameCount[i])，
+// 每帧的点阵为 g_TileAnimFrameData 中第 g_TileAnimFrameImage[f] 个 256 字节块，持续 g_TileAnimFrameTicks[f] 帧
+extern const unsigned int g_TileAnimCount;
+extern const unsigned short g_TileAnimBaseTile8[];
+extern const unsigned short g_TileAnimFirstFrame[];
+extern const unsigned short g_TileAnimFrameCount[];
+extern const unsigned short g_TileAnimFrameImage[];
+extern const unsigned short g_TileAnimFrameTicks[];
+extern const unsigned char g_TileAnimFrameData[];
+
+extern const int g_PlayerWidth;
+extern const int g_PlayerHeight;
+extern const unsigned short g_PlayerObjFrame0TileId;
+extern const unsigned short g_PlayerObjFrame1TileId;
+extern const unsigned char g_PlayerObjTiles[];
+
+extern const unsigned char _binary_obj_morningmix_pcm_start[];
+extern const unsigned char _binary_obj_morningmix_pcm_end[];
@@ -0,0 +1,103 @@
+/*------------------------------------------------------------------------
+名称：总览地图（Mode 7）
+说明：进入 / 退出、逐行透视参数的生成与提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：本文件以 ARM 模式编译，每帧调用的 Mode7_Build / Mode7_Commit 放在 IWRAM（进入 / 退出只调用一次，留在 ROM）；第 N 行（地平线以下 dy 行）每屏幕像素对应 height / dy 个地图像素，
+      沿朝向前方 height * FOCAL / dy 处；倒数表在进入时用 160 次除法生成，每行只有乘法与移位
+------------------------------------------------------------------------*/
+
+#include "Mode7.h"
+
+#include "../generated_assets.h"
+#include "MemOps.h"
+#include "Raster.h"
+#include "Trig.h"
+
+// 天空行的参考点：远在总览图之外（BG2 不环绕，图外透明，显示背景色）
+#define MODE7_SKY (-1024 << 8)
+
+// g_Mode7Recip[n] = 65536 / n（n = 1..RASTER_LINES）
+static s32 g_Mode7Recip[RASTER_LINES + 1];
+static u16 g_Mode7SavedDispcnt = 0;
+static u16 g_Mode7SavedBg2cnt = 0;
+
+bool Mode7_Enter()
+{
+    if(g_BgTileCount * 64 > MODE7_SCREEN_BASE * 0x800 || g_OverviewTileCount > 256) {
+        return false;
+    }
+
+    g_Mode7Recip[0] = 0;
+    for(int n = 1; n <= RASTER_LINES; n++) {
+        g_Mode7Recip[n] = 65536 / n;
+    }
+
+    VramCopy((void*)(0x06000000 + MODE7_CHAR_BASE * 0x4000), g_OverviewTiles, g_OverviewTileCount * 64);
+    VramCopy((void*)(0x06000000 + MODE7_SCREEN_BASE * 0x800), g_OverviewMap, g_OverviewMapSize * g_OverviewMapSize);
+
+    // 停掉游戏的逐行滚动 DMA：否则它在 Mode 1 下继续按行改写 BG 滚动寄存器，直到第一次 Mode7_Commit
+    REG_DMA0CNT = 0;
+
+    g_Mode7SavedDispcnt = REG_DISPCNT;
+    g_Mode7SavedBg2cnt = REG_BG2CNT;
+
+    // 优先级 0，512x512（尺寸 2），不环绕
+    REG_BG2CNT = (u16)((MODE7_CHAR_BASE << 2) | (MODE7_SCREEN_BASE << 8) | (2 << 14));
+    REG_DISPCNT = (u16)((g_Mode7SavedDispcnt & ~(0x0007 | 0x0F00 | 0xE000 | OBJ_ON)) | MODE_1);
+    return true;
+}
+
+void Mode7_Leave()
+{
+    // 停掉仿射表的 HBlank DMA，并清掉两张表（后台表里还留着仿射参数与仿射标记，下次 Raster_Commit 会把它写进 BG2PA）
+    REG_DMA0CNT = 0;
+    Raster_Init();
+
+    REG_BG2CNT = g_Mode7SavedBg2cnt;
+    REG_DISPCNT = g_Mode7SavedDispcnt;
+}
+
+IWRAM_CODE void Mode7_Build(const Mode7Camera* camera)
+{
+    u16* table = Raster_BeginAffine();
+    const s32 c = Trig_Cos(camera->angle);
+    const s32 s = Trig_Sin(camera->angle);
+
+    for(int line = 0; line < RASTER_TABLE_LINES; line++) {
+        u16* row = table + line * RASTER_LINE_HALFWORDS;
+        const int dy = (line < RASTER_LINES ? line : RASTER_LINES - 1) - MODE7_HORIZON;
+
+        s32 pa = 0;
+        s32 pc = 0;
+        s32 x = MODE7_SKY;
+        s32 y = MODE7_SKY;
+        if(dy > 0) {
+            // 8.8：本行每屏幕像素对应的地图像素数与前方距离
+            const s32 lambda = (camera->height * g_Mode7Recip[dy]) >> 8;
+            const s32 distance = lambda * MODE7_FOCAL;
+            pa = (lambda * c) >> TRIG_SHIFT;
+            pc = (lambda * s) >> TRIG_SHIFT;
+            // 屏幕中心沿朝向前移 distance，再向左回退 120 个屏幕像素得到本行最左像素的地图坐标
+            x = camera->x + ((s * (distance >> 4)) >> 8) - 120 * pa;
+            y = camera->y - ((c * (distance >> 4)) >> 8) - 120 * pc;
+        }
+
+        // PB / PD 置 0：每行都重写参考点，不让硬件的逐行累加干扰
+        row[0] = (u16)pa;
+        row[1] = 0;
+        row[2] = (u16)pc;
+        row[3] = 0;
+        row[4] = (u16)x;
+        row[5] = (u16)(x >> 16);
+        row[6] = (u16)y;
+        row[7] = (u16)(y >> 16);
+    }
+}
+
+IWRAM_CODE void Mode7_Commit()
+{
+    Raster_Commit();
+    REG_DISPCNT = (u16)(REG_DISPCNT | BG2_ON);
+}
@@ -0,0 +1,59 @@
+/*------------------------------------------------------------------------
+名称：总览地图（Mode 7）
+说明：切换到模式 1，以 BG2 仿射图层显示构建期烘焙的总览图，逐行改写 BG2PA~BG2Y 得到透视地面
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：逐行参数每帧在 IWRAM 的 Raster 后台表中生成（Raster_BeginAffine），VBlank 开头由 Raster_Commit 交换并启动 HBlank DMA0；
+      总览图放在游戏 BG tile 与文本 BG map 之间的空闲 VRAM，进入 / 退出都不改动游戏画面的 VRAM
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+// 总览图 tile：char block 2（0x06008000，最多 256 个 8 位 tile）
+#define MODE7_CHAR_BASE 2
+// 总览图 map：screen block 13（0x06006800，64x64 个 8 位条目共 4KB）
+#define MODE7_SCREEN_BASE 13
+// 地平线所在行：此行及以上为天空（背景色）
+#define MODE7_HORIZON 40
+// 焦距（像素）：视野约 90 度
+#define MODE7_FOCAL 120
+// 镜头高度范围（总览图像素）
+#define MODE7_HEIGHT_MIN 16
+#define MODE7_HEIGHT_MAX 96
+
+/// <summary>
+/// 总览镜头：位置为总览图像素（1 像素 = 世界 2 像素），24.8 定点。
+/// </summary>
+struct Mode7Camera
+{
+    s32 x;
+    s32 y;
+    u8 angle;       // 朝向（256 为一周，0 朝地图上方，64 朝右）
+    int height;     // 离地高度（总览图像素）
+};
+
+/// <summary>
+/// 停止逐行 DMA0，写入总览图 tile 与 map，保存并改写 DISPCNT / BG2CNT（模式 1，只开 BG2）。在 VBlank 内调用；
+/// BG2 在第一次 Mode7_Commit 之后才打开，不会显示未初始化的仿射参数。
+/// </summary>
+/// <returns>为 false 表示游戏 BG tile 已占用总览图的 VRAM，未进入</returns>
+bool Mode7_Enter();
+
+/// <summary>
+/// 停止仿射表的 DMA0、清空 Raster 双缓冲表，恢复进入前的 DISPCNT / BG2CNT。
+/// 调用方需在下一次 Raster_Commit 之前用 Raster_Begin 重新生成游戏的滚动表。
+/// </summary>
+void Mode7_Leave();
+
+/// <summary>
+/// 按镜头生成下一帧 160 行的 BG2 仿射参数（IWRAM，ARM）。
+/// </summary>
+void Mode7_Build(const Mode7Camera* camera);
+
+/// <summary>
+/// 提交上一帧生成的逐行参数并打开 BG2（需在 VBlank 内调用）。
+/// </summary>
+void Mode7_Commit();
@@ -0,0 +1,178 @@
+/*------------------------------------------------------------------------
+名称：仿射 OBJ
+说明：矩阵池（哈希链查找相同参数、空闲链表分配）与查表计算矩阵
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：本文件以 ARM 模式编译，全部函数放在 IWRAM；缩放为 ±1.0 时不做除法
+------------------------------------------------------------------------*/
+
+#include "ObjAffine.h"
+
+#include "Trig.h"
+
+#define AFFINE_BUCKETS 32
+
+struct AffineEntry
+{
+    s16 scaleX;
+    s16 scaleY;
+    u8 angle;
+    u8 refs;
+    s8 next;        // 同一哈希桶（使用中）或空闲链表（空闲）中的下一项，-1 为末尾
+    u8 bucket;
+};
+
+static AffineEntry g_AffEntries[OBJAFFINE_COUNT];
+static s8 g_AffBuckets[AFFINE_BUCKETS];
+static s8 g_AffFree = -1;
+static int g_AffInUse = 0;
+
+static inline u32 Hash(u8 angle, s16 scaleX, s16 scaleY)
+{
+    // 角度乘奇数：连续 32 个角度（同一缩放）落在 32 个不同的桶
+    return ((u32)angle * 7u + (u32)(u16)scaleX * 3u + (u32)(u16)scaleY) & (AFFINE_BUCKETS - 1);
+}
+
+/// <summary>
+/// 显示缩放的倒数（8.8 定点）：硬件矩阵把屏幕坐标映射回纹理坐标。
+/// </summary>
+static inline s32 InverseScale(s16 scale)
+{
+    if(scale == OBJAFFINE_SCALE_ONE) return OBJAFFINE_SCALE_ONE;
+    if(scale == -OBJAFFINE_SCALE_ONE) return -OBJAFFINE_SCALE_ONE;
+    if(scale == 0) scale = 1;
+    return (OBJAFFINE_SCALE_ONE * OBJAFFINE_SCALE_ONE) / scale;
+}
+
+static IWRAM_CODE void WriteMatrix(int matrix, u8 angle, s16 scaleX, s16 scaleY)
+{
+    const s32 c = Trig_Cos(angle);
+    const s32 s = Trig_Sin(angle);
+    const s32 invX = InverseScale(scaleX);
+    const s32 invY = InverseScale(scaleY);
+    ObjAttr* obj = &g_ShadowOam[matrix * 4];
+    obj[0].pad = (u16)((c * invX) >> TRIG_SHIFT);
+    obj[1].pad = (u16)((-s * invX) >> TRIG_SHIFT);
+    obj[2].pad = (u16)((s * invY) >> TRIG_SHIFT);
+    obj[3].pad = (u16)((c * invY) >> TRIG_SHIFT);
+}
+
+static IWRAM_CODE int Find(u8 angle, s16 scaleX, s16 scaleY, u32 bucket)
+{
+    for(int i = g_AffBuckets[bucket]; i >= 0; i = g_AffEntries[i].next) {
+        const AffineEntry* entry = &g_AffEntries[i];
+        if(entry->angle == angle && entry->scaleX == scaleX && entry->scaleY == scaleY && entry->refs < 255) {
+            return i;
+        }
+    }
+    return OBJAFFINE_NONE;
+}
+
+static IWRAM_CODE void Link(int matrix, u8 angle, s16 scaleX, s16 scaleY, u32 bucket)
+{
+    AffineEntry* entry = &g_AffEntries[matrix];
+    entry->angle = angle;
+    entry->scaleX = scaleX;
+    entry->scaleY = scaleY;
+    entry->bucket = (u8)bucket;
+    entry->next = g_AffBuckets[bucket];
+    g_AffBuckets[bucket] = (s8)matrix;
+    WriteMatrix(matrix, angle, scaleX, scaleY);
+}
+
+static IWRAM_CODE void Unlink(int matrix)
+{
+    s8* link = &g_AffBuckets[g_AffEntries[matrix].bucket];
+    while(*link != matrix) {
+        link = &g_AffEntries[(int)*link].next;
+    }
+    *link = g_AffEntries[matrix].next;
+}
+
+IWRAM_CODE void ObjAffine_Init()
+{
+    for(int i = 0; i < AFFINE_BUCKETS; i++) {
+        g_AffBuckets[i] = -1;
+    }
+    for(int i = 0; i < OBJAFFINE_COUNT; i++) {
+        g_AffEntries[i].refs = 0;
+        g_AffEntries[i].next = (s8)(i + 1 < OBJAFFINE_COUNT ? i + 1 : -1);
+        WriteMatrix(i, 0, OBJAFFINE_SCALE_ONE, OBJAFFINE_SCALE_ONE);
+    }
+    g_AffFree = 0;
+    g_AffInUse = 0;
+}
+
+IWRAM_CODE int ObjAffine_Acquire(u8 angle, s16 scaleX, s16 scaleY)
+{
+    const u32 bucket = Hash(angle, scaleX, scaleY);
+    const int shared = Find(angle, scaleX, scaleY, bucket);
+    if(shared >= 0) {
+        g_AffEntries[shared].refs++;
+        return shared;
+    }
+
+    const int matrix = g_AffFree;
+    if(matrix < 0) {
+        return OBJAFFINE_NONE;
+    }
+    g_AffFree = g_AffEntries[matrix].next;
+    g_AffEntries[matrix].refs = 1;
+    g_AffInUse++;
+    Link(matrix, angle, scaleX, scaleY, bucket);
+    return matrix;
+}
+
+IWRAM_CODE void ObjAffine_Release(int matrix)
+{
+    if(matrix < 0 || matrix >= OBJAFFINE_COUNT || g_AffEntries[matrix].refs == 0) {
+        return;
+    }
+    if(--g_AffEntries[matrix].refs != 0) {
+        return;
+    }
+    Unlink(matrix);
+    g_AffEntries[matrix].next = g_AffFree;
+    g_AffFree = (s8)matrix;
+    g_AffInUse--;
+}
+
+IWRAM_CODE int ObjAffine_Change(int matrix, u8 angle, s16 scaleX, s16 scaleY)
+{
+    if(matrix < 0 || matrix >= OBJAFFINE_COUNT || g_AffEntries[matrix].refs == 0) {
+        return ObjAffine_Acquire(angle, scaleX, scaleY);
+    }
+
+    AffineEntry* entry = &g_AffEntries[matrix];
+    if(entry->angle == angle && entry->scaleX == scaleX && entry->scaleY == scaleY) {
+        return matrix;
+    }
+
+    const u32 bucket = Hash(angle, scaleX, scaleY);
+    const int shared = Find(angle, scaleX, scaleY, bucket);
+    if(shared >= 0) {
+        g_AffEntries[shared].refs++;
+        ObjAffine_Release(matrix);
+        return shared;
+    }
+
+    // 独占：原地改写，不经过空闲池
+    if(entry->refs == 1) {
+        Unlink(matrix);
+        Link(matrix, angle, scaleX, scaleY, bucket);
+        return matrix;
+    }
+
+    const int fresh = ObjAffine_Acquire(angle, scaleX, scaleY);
+    if(fresh < 0) {
+        return matrix;
+    }
+    ObjAffine_Release(matrix);
+    return fresh;
+}
+
+IWRAM_CODE int ObjAffine_InUse()
+{
+    return g_AffInUse;
+}
@@ -0,0 +1,72 @@
+/*------------------------------------------------------------------------
+名称：仿射 OBJ
+说明：32 组 OAM 仿射矩阵的池化管理：按（角度、X/Y 缩放）引用计数共享，查表填充，不使用浮点
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：矩阵写入影子 OAM 每项的第 4 个半字（矩阵 n 占 g_ShadowOam[4n..4n+3].pad），随 ObjShadow_Commit 一次提交；
+      仿射 OBJ 没有翻转位（attr1 bit12/13 为矩阵号的一部分），水平翻转用负的 X 缩放
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ObjShadow.h"
+
+// 硬件仿射矩阵数
+#define OBJAFFINE_COUNT 32
+// 无矩阵（池已满或未分配）
+#define OBJAFFINE_NONE (-1)
+// 缩放 1.0（8.8 定点）
+#define OBJAFFINE_SCALE_ONE 256
+
+/// <summary>
+/// 释放全部矩阵并把 32 组矩阵写为单位矩阵（只写影子 OAM 的 pad，不影响各 OBJ 的 attr0~2）。
+/// </summary>
+void ObjAffine_Init();
+
+/// <summary>
+/// 取得显示为“旋转 angle、缩放 scaleX / scaleY”的矩阵：已有相同参数的矩阵时共享（引用计数 +1），否则占用空闲矩阵并查表填充。
+/// </summary>
+/// <param name="angle">逆时针角度（256 为一周）</param>
+/// <param name="scaleX">显示的水平缩放，8.8 定点（256 为原大小，负数为水平翻转）</param>
+/// <param name="scaleY">显示的垂直缩放，8.8 定点</param>
+/// <returns>矩阵号 0~31；池已满时为 OBJAFFINE_NONE</returns>
+int ObjAffine_Acquire(u8 angle, s16 scaleX, s16 scaleY);
+
+/// <summary>
+/// 释放一次引用，引用归零的矩阵回到空闲池（OBJAFFINE_NONE 忽略）。
+/// </summary>
+void ObjAffine_Release(int matrix);
+
+/// <summary>
+/// 每帧改变参数用：等价于先 Acquire 新参数再 Release 旧矩阵，但独占的矩阵直接原地改写。
+/// </summary>
+/// <param name="matrix">当前持有的矩阵号（OBJAFFINE_NONE 时等同 Acquire）</param>
+/// <returns>新的矩阵号；需要新矩阵而池已满时保留原矩阵不变</returns>
+int ObjAffine_Change(int matrix, u8 angle, s16 scaleX, s16 scaleY);
+
+/// <summary>
+/// 当前被引用的矩阵数。
+/// </summary>
+int ObjAffine_InUse();
+
+/// <summary>
+/// 把 OBJ 设为仿射模式并指定矩阵（会覆盖 attr1 的翻转位）。
+/// </summary>
+/// <param name="doubleSize">为 true 时显示区域为原尺寸两倍，放大 / 旋转不被裁切，屏幕位置需左移、上移半个尺寸</param>
+static inline void ObjAffine_SetObj(ObjAttr* obj, int matrix, bool doubleSize)
+{
+    obj->attr0 = (u16)((obj->attr0 & ~0x0300) | 0x0100 | (doubleSize ? 0x0200 : 0));
+    obj->attr1 = (u16)((obj->attr1 & ~0x3E00) | ((matrix & 31) << 9));
+}
+
+/// <summary>
+/// 恢复为普通 OBJ（不翻转）。
+/// </summary>
+static inline void ObjAffine_ClearObj(ObjAttr* obj)
+{
+    obj->attr0 = (u16)(obj->attr0 & ~0x0300);
+    obj->attr1 = (u16)(obj->attr1 & ~0x3E00);
+}
@@ -0,0 +1,29 @@
+/*------------------------------------------------------------------------
+名称：影子 OAM
+说明：影子 OAM 存储与 DMA3 提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：1KB 以 32 位 DMA 传输约 256 次读写，远小于 VBlank 时长
+------------------------------------------------------------------------*/
+
+#include "ObjShadow.h"
+
+ObjAttr g_ShadowOam[128] __attribute__((aligned(4)));
+
+void ObjShadow_HideFrom(int first)
+{
+    for(int i = first; i < 128; i++) {
+        g_ShadowOam[i].attr0 = 160;
+        g_ShadowOam[i].attr1 = 0;
+        g_ShadowOam[i].attr2 = 0;
+    }
+}
+
+void ObjShadow_Commit()
+{
+    REG_DMA3CNT = 0;
+    REG_DMA3SAD = (u32)g_ShadowOam;
+    REG_DMA3DAD = (u32)0x07000000;
+    REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | (sizeof(g_ShadowOam) / 4));
+}
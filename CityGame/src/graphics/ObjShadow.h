@@ -0,0 +1,35 @@
+/*------------------------------------------------------------------------
+名称：影子 OAM
+说明：在 IWRAM 中维护 128 个 OBJ 属性的副本，帧内只改副本，VBlank 开头一次性 DMA 提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：副本包含每项的第 4 个半字（仿射参数），提交时整表 1KB 覆盖 OAM
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+typedef struct
+{
+    u16 attr0;
+    u16 attr1;
+    u16 attr2;
+    u16 pad;
+} ObjAttr;
+
+/// <summary>
+/// 影子 OAM（128 项）。
+/// </summary>
+extern ObjAttr g_ShadowOam[128];
+
+/// <summary>
+/// 隐藏从 first 开始的全部 OBJ（attr0 Y=160 且清空其余属性）。
+/// </summary>
+void ObjShadow_HideFrom(int first);
+
+/// <summary>
+/// 把影子 OAM 整表提交到硬件 OAM（需在 VBlank 内调用）。
+/// </summary>
+void ObjShadow_Commit();
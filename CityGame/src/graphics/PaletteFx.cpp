@@ -0,0 +1,250 @@
+/*------------------------------------------------------------------------
+名称：调色板效果
+说明：基色 / 影子调色板、渐变与色环推进、查表混合与定点插值、VBlank 提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：本文件以 ARM 模式编译，每帧调用的推进 / 重建 / 提交与混合函数都放在 IWRAM（只在事件时调用的设置函数留在 ROM）；基色与影子调色板是全局变量（默认段即 IWRAM）；
+      渐变进度用 8.8 定点，只有整数权重 / 亮度变化时才重建或写寄存器
+------------------------------------------------------------------------*/
+
+#include "PaletteFx.h"
+
+#include "MemOps.h"
+
+struct PaletteCycle
+{
+    u16 first;
+    u16 count;
+    u16 ticks;
+    u16 timer;
+};
+
+struct PaletteFade
+{
+    s32 current;    // 8.8 定点
+    s32 target;
+    s32 step;
+    u16 frames;     // 剩余帧数
+};
+
+static u16 g_PalBase[PALFX_COLORS] __attribute__((aligned(4)));
+static u16 g_PalShadow[PALFX_COLORS] __attribute__((aligned(4)));
+static bool g_PalDirty = false;
+
+static u16 g_PalFixedFirst = 0;
+static u16 g_PalFixedCount = 0;
+
+static u16 g_PalTintColor = 0;
+static int g_PalTintWeight = 0;
+static PaletteFade g_PalTintFade;
+
+static int g_PalBrightness = 0;
+static bool g_PalBrightnessDirty = false;
+static PaletteFade g_PalBrightnessFade;
+
+static PaletteCycle g_PalCycles[PALFX_MAX_CYCLES];
+static int g_PalCycleCount = 0;
+
+static void Fade_Start(PaletteFade* fade, int target, int frames)
+{
+    fade->target = target << 8;
+    if(frames <= 0) {
+        fade->current = fade->target;
+        fade->frames = 0;
+        return;
+    }
+    fade->step = (fade->target - fade->current) / frames;
+    fade->frames = (u16)frames;
+}
+
+/// <summary>
+/// 推进一帧，返回当前整数值。
+/// </summary>
+IWRAM_CODE static int Fade_Step(PaletteFade* fade)
+{
+    if(fade->frames > 0) {
+        fade->frames--;
+        fade->current = fade->frames == 0 ? fade->target : fade->current + fade->step;
+    }
+    return fade->current >> 8;
+}
+
+IWRAM_CODE void PaletteFx_Blend(u16* dst, const u16* src, u32 count, u16 target, int weight)
+{
+    // 每个通道 32 项，已移到各自的位位置：结果 = R[c & 31] | G[(c >> 5) & 31] | B[(c >> 10) & 31]
+    u16 tableR[32];
+    u16 tableG[32];
+    u16 tableB[32];
+    const int keep = PALFX_WEIGHT_MAX - weight;
+    const int targetR = (target & 31) * weight + 16;
+    const int targetG = ((target >> 5) & 31) * weight + 16;
+    const int targetB = ((target >> 10) & 31) * weight + 16;
+    for(int i = 0; i < 32; i++) {
+        tableR[i] = (u16)((i * keep + targetR) >> 5);
+        tableG[i] = (u16)(((i * keep + targetG) >> 5) << 5);
+        tableB[i] = (u16)(((i * keep + targetB) >> 5) << 10);
+    }
+
+    // 每次读写两个颜色
+    const u32* s = (const u32*)src;
+    u32* d = (u32*)dst;
+    const u32 pairs = count >> 1;
+    for(u32 i = 0; i < pairs; i++) {
+        const u32 c = s[i];
+        const u32 lo = tableR[c & 31] | tableG[(c >> 5) & 31] | tableB[(c >> 10) & 31];
+        const u32 hi = tableR[(c >> 16) & 31] | tableG[(c >> 21) & 31] | tableB[(c >> 26) & 31];
+        d[i] = lo | (hi << 16);
+    }
+}
+
+IWRAM_CODE void PaletteFx_Lerp(u16* dst, const u16* a, const u16* b, u32 count, int weight)
+{
+    // R 与 B 相隔 10 位，乘以不超过 32 的权重后互不溢出，一次乘加算两个通道
+    const u32 keep = (u32)(PALFX_WEIGHT_MAX - weight);
+    const u32 w = (u32)weight;
+    for(u32 i = 0; i < count; i++) {
+        const u32 ca = a[i];
+        const u32 cb = b[i];
+        const u32 rb = (((ca & 0x7C1F) * keep + (cb & 0x7C1F) * w) >> 5) & 0x7C1F;
+        const u32 g = (((ca & 0x03E0) * keep + (cb & 0x03E0) * w) >> 5) & 0x03E0;
+        dst[i] = (u16)(rb | g);
+    }
+}
+
+/// <summary>
+/// 按当前色调从基色重建影子调色板。
+/// </summary>
+IWRAM_CODE static void Rebuild()
+{
+    if(g_PalTintWeight == 0) {
+        MemCopy32(g_PalShadow, g_PalBase, sizeof(g_PalShadow));
+    } else {
+        PaletteFx_Blend(g_PalShadow, g_PalBase, PALFX_COLORS, g_PalTintColor, g_PalTintWeight);
+        for(int i = 0; i < g_PalFixedCount; i++) {
+            g_PalShadow[g_PalFixedFirst + i] = g_PalBase[g_PalFixedFirst + i];
+        }
+    }
+    g_PalDirty = true;
+}
+
+void PaletteFx_Init()
+{
+    MemCopy32(g_PalBase, (const void*)0x05000000, sizeof(g_PalBase));
+    g_PalFixedFirst = 0;
+    g_PalFixedCount = 0;
+    g_PalTintColor = 0;
+    g_PalTintWeight = 0;
+    g_PalTintFade.current = 0;
+    Fade_Start(&g_PalTintFade, 0, 0);
+    g_PalBrightness = 0;
+    g_PalBrightnessFade.current = 0;
+    Fade_Start(&g_PalBrightnessFade, 0, 0);
+    g_PalBrightnessDirty = true;
+    g_PalCycleCount = 0;
+    Rebuild();
+}
+
+void PaletteFx_SetFixed(int first, int count)
+{
+    if(first < 0 || count < 0 || first + count > PALFX_COLORS) {
+        return;
+    }
+    g_PalFixedFirst = (u16)first;
+    g_PalFixedCount = (u16)count;
+    Rebuild();
+}
+
+void PaletteFx_FadeTint(u16 target, int weight, int frames)
+{
+    if(weight < 0) weight = 0;
+    if(weight > PALFX_WEIGHT_MAX) weight = PALFX_WEIGHT_MAX;
+    Fade_Start(&g_PalTintFade, weight, frames);
+    if(target != g_PalTintColor || frames <= 0) {
+        g_PalTintColor = target;
+        g_PalTintWeight = g_PalTintFade.current >> 8;
+        Rebuild();
+    }
+}
+
+bool PaletteFx_AddCycle(int first, int count, int ticks)
+{
+    if(g_PalCycleCount >= PALFX_MAX_CYCLES || count < 2 || ticks < 1 || first < 0 || first + count > PALFX_COLORS) {
+        return false;
+    }
+    PaletteCycle* cycle = &g_PalCycles[g_PalCycleCount++];
+    cycle->first = (u16)first;
+    cycle->count = (u16)count;
+    cycle->ticks = (u16)ticks;
+    cycle->timer = (u16)ticks;
+    return true;
+}
+
+void PaletteFx_FadeBrightness(int level, int frames)
+{
+    if(level < -16) level = -16;
+    if(level > 16) level = 16;
+    Fade_Start(&g_PalBrightnessFade, level, frames);
+    if(frames <= 0) {
+        g_PalBrightness = level;
+        g_PalBrightnessDirty = true;
+    }
+}
+
+IWRAM_CODE void PaletteFx_Update()
+{
+    bool changed = false;
+
+    // 色环：基色中的一段整体后移一位
+    for(int i = 0; i < g_PalCycleCount; i++) {
+        PaletteCycle* cycle = &g_PalCycles[i];
+        if(--cycle->timer != 0) {
+            continue;
+        }
+        cycle->timer = cycle->ticks;
+        u16* colors = g_PalBase + cycle->first;
+        const u16 last = colors[cycle->count - 1];
+        for(int c = cycle->count - 1; c > 0; c--) {
+            colors[c] = colors[c - 1];
+        }
+        colors[0] = last;
+        changed = true;
+    }
+
+    const int weight = Fade_Step(&g_PalTintFade);
+    if(weight != g_PalTintWeight) {
+        g_PalTintWeight = weight;
+        changed = true;
+    }
+    if(changed) {
+        Rebuild();
+    }
+
+    const int brightness = Fade_Step(&g_PalBrightnessFade);
+    if(brightness != g_PalBrightness) {
+        g_PalBrightness = brightness;
+        g_PalBrightnessDirty = true;
+    }
+}
+
+IWRAM_CODE void PaletteFx_Commit()
+{
+    if(g_PalDirty) {
+        REG_DMA3CNT = 0;
+        REG_DMA3SAD = (u32)g_PalShadow;
+        REG_DMA3DAD = (u32)0x05000000;
+        REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | (sizeof(g_PalShadow) / 4));
+        g_PalDirty = false;
+    }
+
+    if(g_PalBrightnessDirty) {
+        // 第一目标为全部 BG、OBJ 与背景色；模式 2 变亮，3 变暗
+        if(g_PalBrightness == 0) {
+            REG_BLDCNT = 0;
+        } else {
+            REG_BLDCNT = (u16)(0x3F | ((g_PalBrightness > 0 ? 2 : 3) << 6));
+        }
+        REG_BLDY = (u16)(g_PalBrightness > 0 ? g_PalBrightness : -g_PalBrightness);
+        g_PalBrightnessDirty = false;
+    }
+}
@@ -0,0 +1,69 @@
+/*------------------------------------------------------------------------
+名称：调色板效果
+说明：IWRAM 中的基色与影子调色板（BG + OBJ 共 512 色），色调渐变（昼夜、区域淡入淡出）、色环循环，
+      VBlank 内 DMA3 提交；纯黑 / 纯白渐变改用硬件 REG_BLDY
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：混合函数放在 IWRAM 并以 ARM 模式编译；朝固定目标色混合时每帧只建 3 张 32 项的通道表，每色 3 次查表；
+      两套调色板之间插值用打包的定点乘法（R|B 与 G 各一次乘加）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+// BG 256 色 + OBJ 256 色
+#define PALFX_COLORS 512
+// 同时循环的色环数
+#define PALFX_MAX_CYCLES 4
+// 混合权重上限（32 为完全变为目标色）
+#define PALFX_WEIGHT_MAX 32
+
+/// <summary>
+/// 读取调色板 RAM 当前的 512 色作为基色（在各模块写完调色板之后调用），清除全部效果。
+/// </summary>
+void PaletteFx_Init();
+
+/// <summary>
+/// 指定一段不参与色调混合的颜色（如对话框专用调色板组），始终保持基色。
+/// </summary>
+void PaletteFx_SetFixed(int first, int count);
+
+/// <summary>
+/// 在 frames 帧内把色调权重线性变化到 weight（frames 为 0 时立即生效）；目标色立即切换。
+/// </summary>
+/// <param name="target">目标色（BGR555）</param>
+/// <param name="weight">0~32，0 为基色</param>
+void PaletteFx_FadeTint(u16 target, int weight, int frames);
+
+/// <summary>
+/// 登记色环：基色 [first, first + count) 每 ticks 帧循环移动一位（水面等）。
+/// </summary>
+/// <returns>为 false 表示色环已满或参数无效</returns>
+bool PaletteFx_AddCycle(int first, int count, int ticks);
+
+/// <summary>
+/// 在 frames 帧内把硬件亮度变化到 level（-16 全黑 ~ 0 原色 ~ 16 全白），作用于全部 BG、OBJ 与背景色。
+/// </summary>
+void PaletteFx_FadeBrightness(int level, int frames);
+
+/// <summary>
+/// 每帧调用一次：推进渐变与色环，有变化时重建影子调色板。
+/// </summary>
+void PaletteFx_Update();
+
+/// <summary>
+/// 影子调色板有变化时 DMA 到调色板 RAM，并写入亮度寄存器（需在 VBlank 内调用）。
+/// </summary>
+void PaletteFx_Commit();
+
+/// <summary>
+/// 查表混合：dst[i] = src[i] 朝 target 混合 weight / 32（count 为偶数，地址 4 字节对齐）。
+/// </summary>
+void PaletteFx_Blend(u16* dst, const u16* src, u32 count, u16 target, int weight);
+
+/// <summary>
+/// 定点插值：dst[i] = a[i] 到 b[i] 的 weight / 32 处（两套调色板之间，如昼夜各自的调色板）。
+/// </summary>
+void PaletteFx_Lerp(u16* dst, const u16* a, const u16* b, u32 count, int weight);
@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------
+名称：逐行滚动效果
+说明：双缓冲滚动表、效果预设与 DMA0 HBlank 提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：表放在 IWRAM（全局变量默认段），HBlank DMA 每行 4 次 32 位读，不经过 EWRAM 等待周期；
+      表多留一行：第 159 行的 HBlank 仍会触发一次传输
+------------------------------------------------------------------------*/
+
+#include "Raster.h"
+
+#include "MemOps.h"
+
+// 每行 8 个半字：BG0HOFS, BG0VOFS, BG1HOFS, ..., BG3VOFS（仿射表为 BG2PA ~ BG2Y）
+static u16 g_RasterTable[2][RASTER_TABLE_LINES][RASTER_LINE_HALFWORDS] __attribute__((aligned(4)));
+// 表中各行是否不同（否则提交时只写寄存器，不启动 DMA）
+static bool g_RasterEffects[2] = { false, false };
+static int g_RasterBack = 0;
+// 表的目标：false 为 BG0HOFS 起的滚动寄存器，true 为 BG2PA 起的仿射寄存器
+static bool g_RasterAffine[2] = { false, false };
+
+// 一个周期 64 项的正弦表（±127）
+static const s8 g_RasterSine[64] = {
+    0, 12, 25, 37, 49, 60, 71, 81, 90, 98, 106, 112, 117, 122, 125, 126,
+    127, 126, 125, 122, 117, 112, 106, 98, 90, 81, 71, 60, 49, 37, 25, 12,
+    0, -12, -25, -37, -49, -60, -71, -81, -90, -98, -106, -112, -117, -122, -125, -126,
+    -127, -126, -125, -122, -117, -112, -106, -98, -90, -81, -71, -60, -49, -37, -25, -12,
+};
+
+static inline int ClampLine(int line)
+{
+    if(line < 0) return 0;
+    if(line > RASTER_LINES) return RASTER_LINES;
+    return line;
+}
+
+/// <summary>
+/// 第 159 行之后的那一行与第 159 行相同（HBlank 读到它时本帧已显示完毕）。
+/// </summary>
+static void CopyLastLine(int table)
+{
+    MemCopy32(g_RasterTable[table][RASTER_LINES], g_RasterTable[table][RASTER_LINES - 1], RASTER_LINE_HALFWORDS * 2);
+}
+
+void Raster_Init()
+{
+    REG_DMA0CNT = 0;
+    MemFill32(g_RasterTable, 0, sizeof(g_RasterTable));
+    g_RasterEffects[0] = false;
+    g_RasterEffects[1] = false;
+    g_RasterAffine[0] = false;
+    g_RasterAffine[1] = false;
+    g_RasterBack = 0;
+}
+
+void Raster_Begin(int hofs, int vofs)
+{
+    const u32 pair = (u32)(hofs & 0x1FF) | ((u32)(vofs & 0x1FF) << 16);
+    MemFill32(g_RasterTable[g_RasterBack], pair, sizeof(g_RasterTable[0]));
+    g_RasterEffects[g_RasterBack] = false;
+    g_RasterAffine[g_RasterBack] = false;
+}
+
+u16* Raster_BeginAffine()
+{
+    g_RasterEffects[g_RasterBack] = true;
+    g_RasterAffine[g_RasterBack] = true;
+    return g_RasterTable[g_RasterBack][0];
+}
+
+void Raster_Parallax(int bg, const RasterBand* bands, int count, int camX)
+{
+    u16 (*table)[RASTER_LINE_HALFWORDS] = g_RasterTable[g_RasterBack];
+    for(int i = 0; i < count; i++) {
+        const int first = ClampLine(bands[i].firstLine);
+        const int last = (i + 1 < count) ? ClampLine(bands[i + 1].firstLine) : RASTER_LINES;
+        const u16 hofs = (u16)(((camX * bands[i].factor) >> 8) & 0x1FF);
+        for(int line = first; line < last; line++) {
+            table[line][bg * 2] = hofs;
+        }
+    }
+    CopyLastLine(g_RasterBack);
+    g_RasterEffects[g_RasterBack] = true;
+}
+
+void Raster_Wave(int bgMask, int firstLine, int lastLine, int amplitude, int step, int phase)
+{
+    u16 (*table)[RASTER_LINE_HALFWORDS] = g_RasterTable[g_RasterBack];
+    firstLine = ClampLine(firstLine);
+    lastLine = ClampLine(lastLine);
+    for(int line = firstLine; line < lastLine; line++) {
+        const int offset = (g_RasterSine[(line * step + phase) & 63] * amplitude) >> 7;
+        for(int bg = 0; bg < 4; bg++) {
+            if(bgMask & (1 << bg)) {
+                table[line][bg * 2] = (u16)((table[line][bg * 2] + offset) & 0x1FF);
+            }
+        }
+    }
+    CopyLastLine(g_RasterBack);
+    g_RasterEffects[g_RasterBack] = true;
+}
+
+void Raster_Split(int bgMask, int line, int hofs, int vofs)
+{
+    u16 (*table)[RASTER_LINE_HALFWORDS] = g_RasterTable[g_RasterBack];
+    for(int y = ClampLine(line); y < RASTER_LINES; y++) {
+        for(int bg = 0; bg < 4; bg++) {
+            if(bgMask & (1 << bg)) {
+                table[y][bg * 2 + 0] = (u16)(hofs & 0x1FF);
+                table[y][bg * 2 + 1] = (u16)(vofs & 0x1FF);
+            }
+        }
+    }
+    CopyLastLine(g_RasterBack);
+    g_RasterEffects[g_RasterBack] = true;
+}
+
+void Raster_Commit()
+{
+    REG_DMA0CNT = 0;
+
+    const int front = g_RasterBack;
+    g_RasterBack ^= 1;
+
+    // 第 0 行：VBlank 内直接写寄存器
+    const u32* line0 = (const u32*)g_RasterTable[front][0];
+    volatile u32* regs = g_RasterAffine[front] ? (volatile u32*)&REG_BG2PA : (volatile u32*)&REG_BG0HOFS;
+    for(int i = 0; i < RASTER_LINE_HALFWORDS / 2; i++) {
+        regs[i] = line0[i];
+    }
+
+    if(!g_RasterEffects[front]) {
+        return;
+    }
+
+    // 第 1 行起：每个 HBlank 传 4 个字，目标地址每次重置回 BG0HOFS（或 BG2PA）
+    REG_DMA0SAD = (u32)g_RasterTable[front][1];
+    REG_DMA0DAD = (u32)regs;
+    REG_DMA0CNT = (u32)(DMA_ENABLE | DMA_HBLANK | DMA_REPEAT | DMA32 | DMA_SRC_INC | DMA_DST_RELOAD | (RASTER_LINE_HALFWORDS / 2));
+}
@@ -0,0 +1,81 @@
+/*------------------------------------------------------------------------
+名称：逐行滚动效果
+说明：每帧在后台表中生成 160 行 x 4 个 BG 的 HOFS/VOFS，VBlank 开头交换并启动 DMA0（HBlank 重复模式）逐行写入滚动寄存器
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：每行一次 4 字的 DMA 写满 BG0HOFS~BG3VOFS（0x04000010~0x0400001F），每帧只设置一次 DMA，不使用 HBlank 中断；
+      第 N 行的 HBlank 写入第 N + 1 行的值，第 0 行在 VBlank 内由 CPU 写入；整帧滚动一致时不启动 DMA。
+      同一张表也可改为逐行的 BG2 仿射参数（BG2PA~BG2Y，0x04000020~0x0400002F，同为 16 字节）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#define RASTER_LINES 160
+// 每行的半字数
+#define RASTER_LINE_HALFWORDS 8
+// 表的行数：多留一行，第 159 行的 HBlank 仍会触发一次传输
+#define RASTER_TABLE_LINES (RASTER_LINES + 1)
+
+// BG 掩码
+#define RASTER_BG0 0x1
+#define RASTER_BG1 0x2
+#define RASTER_BG2 0x4
+#define RASTER_BG3 0x8
+#define RASTER_BG_ALL 0xF
+
+/// <summary>
+/// 视差分带：从 firstLine 行开始（到下一带或屏幕底部），HOFS = camX * factor / 256。
+/// </summary>
+struct RasterBand
+{
+    u8 firstLine;
+    s16 factor;     // 8.8 定点，256 为与镜头同速
+};
+
+/// <summary>
+/// 清空两张表、关闭 DMA0。
+/// </summary>
+void Raster_Init();
+
+/// <summary>
+/// 开始填写下一帧：全部行、全部 BG 设为同一滚动值（后续效果在此基础上修改）。
+/// </summary>
+void Raster_Begin(int hofs, int vofs);
+
+/// <summary>
+/// 视差分带（远景层）：bg 的各带按各自比例跟随镜头水平滚动，VOFS 不变。
+/// </summary>
+/// <param name="bg">BG 序号 0~3</param>
+/// <param name="bands">按 firstLine 升序</param>
+void Raster_Parallax(int bg, const RasterBand* bands, int count, int camX);
+
+/// <summary>
+/// 正弦波水平扭曲（热浪、水面）：HOFS 叠加 amplitude * sin(line * 2π / 64 * step + phase)。
+/// </summary>
+/// <param name="bgMask">RASTER_BG0 等的组合</param>
+/// <param name="firstLine">起始行（含）</param>
+/// <param name="lastLine">结束行（不含）</param>
+/// <param name="amplitude">振幅（像素）</param>
+/// <param name="step">每行相位步进（一周期 64）</param>
+/// <param name="phase">相位（一周期 64，逐帧递增即为波动）</param>
+void Raster_Wave(int bgMask, int firstLine, int lastLine, int amplitude, int step, int phase);
+
+/// <summary>
+/// 分屏：从 line 行到屏幕底部，bgMask 中的 BG 改用另一组滚动值。
+/// </summary>
+void Raster_Split(int bgMask, int line, int hofs, int vofs);
+
+/// <summary>
+/// 改为填写下一帧的 BG2 仿射参数（模式 1 / 2）：每行 8 个半字依次为 BG2PA、BG2PB、BG2PC、BG2PD、BG2X（低、高半字）、BG2Y（低、高半字），
+/// 提交时写入 REG_BG2PA 起的 16 字节。下一次 Raster_Begin 恢复为滚动表。
+/// </summary>
+/// <returns>后台表第 0 行，调用方需填满 RASTER_TABLE_LINES 行</returns>
+u16* Raster_BeginAffine();
+
+/// <summary>
+/// 交换前后台表，写入第 0 行并为其余行启动 HBlank DMA（需在 VBlank 内调用）。
+/// </summary>
+void Raster_Commit();
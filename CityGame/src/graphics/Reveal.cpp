@@ -0,0 +1,158 @@
+/*------------------------------------------------------------------------
+名称：屋顶遮罩
+说明：过渡进度、WIN0 矩形与 OBJ 窗口圆形的计算和提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：圆形 OBJ 为 64x64（半径 32），双倍显示区域 128x128，缩放到半径 REVEAL_RADIUS；
+      进度用 8.8 定点（256 为完全打开）
+------------------------------------------------------------------------*/
+
+#include "Reveal.h"
+
+#include "ObjAffine.h"
+#include "ObjShadow.h"
+
+// 窗口内 / 外的图层位：BG0~3 为 bit0~3，OBJ bit4，颜色特效 bit5
+#define REVEAL_LAYERS_ALL 0x3F
+#define REVEAL_LAYERS_NO_BG3 0x37
+
+#define REVEAL_PROGRESS_MAX 256
+// 圆形点阵半径（像素）
+#define REVEAL_SOURCE_RADIUS 32
+
+static RevealShape g_RevealShape = REVEAL_CIRCLE;
+static int g_RevealProgress = 0;
+static int g_RevealTarget = 0;
+static int g_RevealStep = 0;
+static int g_RevealMatrix = OBJAFFINE_NONE;
+
+// 本帧计算结果，Commit 时写入
+static u16 g_RevealWin0H = 0;
+static u16 g_RevealWin0V = 0;
+static u16 g_RevealDispcnt = 0;
+static int g_RevealObjX = 0;
+static int g_RevealObjY = 0;
+
+static inline int Clamp(int value, int lo, int hi)
+{
+    if(value < lo) return lo;
+    if(value > hi) return hi;
+    return value;
+}
+
+void Reveal_Init()
+{
+    // 64x64 16 色，一维映射：8x8 个图块按行排列，每个图块 32 字节；圆内像素为颜色 1
+    volatile u16* tiles = (volatile u16*)(0x06010000 + REVEAL_FIRST_TILE * 32);
+    for(int y = 0; y < 64; y++) {
+        const int dy = 2 * y - 63;
+        for(int x = 0; x < 64; x += 4) {
+            u16 quad = 0;
+            for(int i = 0; i < 4; i++) {
+                const int dx = 2 * (x + i) - 63;
+                if(dx * dx + dy * dy <= 64 * 64) {
+                    quad |= (u16)(1 << (i * 4));
+                }
+            }
+            const int tile = (y >> 3) * 8 + (x >> 3);
+            tiles[tile * 16 + (y & 7) * 2 + ((x & 7) >> 2)] = quad;
+        }
+    }
+
+    g_RevealShape = REVEAL_CIRCLE;
+    g_RevealProgress = 0;
+    g_RevealTarget = 0;
+    g_RevealStep = 0;
+    ObjAffine_Release(g_RevealMatrix);
+    g_RevealMatrix = OBJAFFINE_NONE;
+    g_RevealDispcnt = 0;
+
+    REG_WININ = REVEAL_LAYERS_NO_BG3;
+    REG_WINOUT = (u16)(REVEAL_LAYERS_ALL | (REVEAL_LAYERS_NO_BG3 << 8));
+}
+
+void Reveal_SetShape(RevealShape shape)
+{
+    g_RevealShape = shape;
+}
+
+RevealShape Reveal_GetShape()
+{
+    return g_RevealShape;
+}
+
+void Reveal_Open(bool open, int frames)
+{
+    g_RevealTarget = open ? REVEAL_PROGRESS_MAX : 0;
+    if(frames <= 0) {
+        g_RevealProgress = g_RevealTarget;
+        g_RevealStep = 0;
+        return;
+    }
+    g_RevealStep = (REVEAL_PROGRESS_MAX + frames - 1) / frames;
+}
+
+void Reveal_Update(int centerX, int centerY)
+{
+    if(g_RevealProgress < g_RevealTarget) {
+        g_RevealProgress = Clamp(g_RevealProgress + g_RevealStep, 0, g_RevealTarget);
+    } else if(g_RevealProgress > g_RevealTarget) {
+        g_RevealProgress = Clamp(g_RevealProgress - g_RevealStep, g_RevealTarget, REVEAL_PROGRESS_MAX);
+    }
+
+    // 圆形半径不足 1 像素时视为关闭（缩放过小，矩阵溢出）
+    const int radius = (REVEAL_RADIUS * g_RevealProgress) >> 8;
+    g_RevealDispcnt = 0;
+    if(g_RevealProgress == 0 || g_RevealShape != REVEAL_CIRCLE || radius == 0) {
+        ObjAffine_Release(g_RevealMatrix);
+        g_RevealMatrix = OBJAFFINE_NONE;
+    }
+    if(g_RevealProgress == 0 || (g_RevealShape == REVEAL_CIRCLE && radius == 0)) {
+        return;
+    }
+
+    if(g_RevealShape == REVEAL_RECT) {
+        // WIN0H：高字节左边界，低字节右边界（不含）；WIN0V 同理
+        const int halfW = (REVEAL_HALF_W * g_RevealProgress) >> 8;
+        const int halfH = (REVEAL_HALF_H * g_RevealProgress) >> 8;
+        const int left = Clamp(centerX - halfW, 0, 240);
+        const int right = Clamp(centerX + halfW, left, 240);
+        const int top = Clamp(centerY - halfH, 0, 160);
+        const int bottom = Clamp(centerY + halfH, top, 160);
+        g_RevealWin0H = (u16)((left << 8) | right);
+        g_RevealWin0V = (u16)((top << 8) | bottom);
+        g_RevealDispcnt = WIN0_ON;
+        return;
+    }
+
+    // 显示缩放 = 半径 / 点阵半径（8.8 定点）
+    const s16 scale = (s16)((radius << 8) / REVEAL_SOURCE_RADIUS);
+    g_RevealMatrix = ObjAffine_Change(g_RevealMatrix, 0, scale, scale);
+    if(g_RevealMatrix == OBJAFFINE_NONE) {
+        return;
+    }
+    g_RevealObjX = centerX - 64;
+    g_RevealObjY = centerY - 64;
+    g_RevealDispcnt = OBJ_WIN_ON;
+}
+
+int Reveal_WriteOam(int firstSlot)
+{
+    if(g_RevealDispcnt != OBJ_WIN_ON || firstSlot >= 128) {
+        return firstSlot;
+    }
+    // attr0：仿射 + 双倍区域 + OBJ 窗口模式 + 16 色 + 正方形；attr1：64x64
+    ObjAttr* obj = &g_ShadowOam[firstSlot];
+    obj->attr0 = (u16)((g_RevealObjY & 0xFF) | 0x0300 | 0x0800);
+    obj->attr1 = (u16)((g_RevealObjX & 0x1FF) | ((g_RevealMatrix & 31) << 9) | 0xC000);
+    obj->attr2 = (u16)REVEAL_FIRST_TILE;
+    return firstSlot + 1;
+}
+
+void Reveal_Commit()
+{
+    REG_WIN0H = g_RevealWin0H;
+    REG_WIN0V = g_RevealWin0V;
+    REG_DISPCNT = (u16)((REG_DISPCNT & ~(WIN0_ON | OBJ_WIN_ON)) | g_RevealDispcnt);
+}
@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------
+名称：屋顶遮罩
+说明：用窗口把角色周围的 BG3（屋顶 / 门窗图层）挖掉：矩形用 WIN0，圆形用 OBJ 窗口（仿射缩放的圆形 OBJ）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：显示 / 隐藏的过渡只改窗口寄存器与一个 OBJ 的属性、矩阵，不写 BG map；
+      窗口内保留 BG0~2、OBJ 与颜色特效（亮度渐变照常生效），窗口外全部显示；完全关闭时关掉 DISPCNT 的窗口位
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+// 圆形遮罩的 OBJ 图块起点（64x64 16 色共 64 个；玩家 0~63，对话框 64~191）
+#define REVEAL_FIRST_TILE 192
+// 完全打开时圆形半径、矩形半宽 / 半高（像素）
+#define REVEAL_RADIUS 48
+#define REVEAL_HALF_W 40
+#define REVEAL_HALF_H 32
+
+enum RevealShape
+{
+    REVEAL_RECT,    // WIN0 矩形
+    REVEAL_CIRCLE,  // OBJ 窗口圆形
+};
+
+/// <summary>
+/// 把圆形点阵写入 OBJ VRAM，设置窗口内外的图层，初始为关闭。
+/// </summary>
+void Reveal_Init();
+
+/// <summary>
+/// 切换遮罩形状（立即生效）。
+/// </summary>
+void Reveal_SetShape(RevealShape shape);
+
+RevealShape Reveal_GetShape();
+
+/// <summary>
+/// 在 frames 帧内打开（挖掉角色周围的 BG3）或关闭（frames 为 0 时立即生效）。
+/// </summary>
+void Reveal_Open(bool open, int frames);
+
+/// <summary>
+/// 每帧调用一次：推进过渡，按遮罩中心计算本帧的窗口 / OBJ 参数。
+/// </summary>
+/// <param name="centerX">遮罩中心屏幕 X（角色中心）</param>
+/// <param name="centerY">遮罩中心屏幕 Y</param>
+void Reveal_Update(int centerX, int centerY);
+
+/// <summary>
+/// 把圆形遮罩 OBJ 写入影子 OAM（OBJ 窗口不显示图像，槽位顺序无关）。
+/// </summary>
+/// <returns>下一个可用槽位（矩形或关闭时等于 firstSlot）</returns>
+int Reveal_WriteOam(int firstSlot);
+
+/// <summary>
+/// 写入窗口寄存器与 DISPCNT 的窗口位（需在 VBlank 内调用）。
+/// </summary>
+void Reveal_Commit();
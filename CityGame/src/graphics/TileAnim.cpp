@@ -0,0 +1,75 @@
+/*------------------------------------------------------------------------
+名称：动画 tile
+说明：动画计时与 VBlank 内的 DMA3 提交
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：待提交动画记在 32 位掩码中；动画 tile 的 4 个 8x8 在 char block 0 中连续（8bpp，每个 64 字节）
+------------------------------------------------------------------------*/
+
+#include "TileAnim.h"
+
+#include "DebugLog.h"
+#include "Profiler.h"
+#include "../generated_assets.h"
+
+static u8 g_TileAnimFrame[TILEANIM_MAX];
+static u16 g_TileAnimTimer[TILEANIM_MAX];
+static u32 g_TileAnimPending = 0;
+static int g_TileAnimActive = 0;
+
+void TileAnim_Init()
+{
+    g_TileAnimActive = (int)g_TileAnimCount;
+    if(g_TileAnimActive > TILEANIM_MAX) {
+        DebugLog_Printf(DEBUGLOG_WARN, "[anim] %d animations, only %d played", g_TileAnimActive, TILEANIM_MAX);
+        g_TileAnimActive = TILEANIM_MAX;
+    }
+
+    g_TileAnimPending = 0;
+    for(int i = 0; i < g_TileAnimActive; i++) {
+        g_TileAnimFrame[i] = 0;
+        g_TileAnimTimer[i] = g_TileAnimFrameTicks[g_TileAnimFirstFrame[i]];
+        g_TileAnimPending |= 1u << i;
+    }
+}
+
+void TileAnim_Update()
+{
+    for(int i = 0; i < g_TileAnimActive; i++) {
+        if(--g_TileAnimTimer[i] != 0) {
+            continue;
+        }
+        int frame = g_TileAnimFrame[i] + 1;
+        if(frame >= g_TileAnimFrameCount[i]) {
+            frame = 0;
+        }
+        g_TileAnimFrame[i] = (u8)frame;
+        g_TileAnimTimer[i] = g_TileAnimFrameTicks[g_TileAnimFirstFrame[i] + frame];
+        g_TileAnimPending |= 1u << i;
+    }
+}
+
+u32 TileAnim_Commit()
+{
+    u32 pending = g_TileAnimPending;
+    if(pending == 0) {
+        return 0;
+    }
+    g_TileAnimPending = 0;
+
+    u32 bytes = 0;
+    for(int i = 0; pending != 0; i++, pending >>= 1) {
+        if((pending & 1) == 0) {
+            continue;
+        }
+        const u32 image = g_TileAnimFrameImage[g_TileAnimFirstFrame[i] + g_TileAnimFrame[i]];
+        REG_DMA3CNT = 0;
+        REG_DMA3SAD = (u32)(g_TileAnimFrameData + image * 256);
+        REG_DMA3DAD = (u32)0x06000000 + (u32)g_TileAnimBaseTile8[i] * 64;
+        REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | (256 / 4));
+        bytes += 256;
+    }
+    PROFILE_COUNT("anim bytes", bytes);
+    return bytes;
+}
@@ -0,0 +1,31 @@
+/*------------------------------------------------------------------------
+名称：动画 tile
+说明：按 TMX 的 <animation> 定时改写 char block 0 中动画 tile 的 4 个 8x8 点阵（水面等），地图条目不动
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：每个动画换帧时传输 256 字节，与该 tile 在屏幕上出现多少次无关；构建时 build_assets.py 打印每个动画每次换帧的 VRAM 字节数
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+// 同时支持的动画数
+#define TILEANIM_MAX 32
+
+/// <summary>
+/// 重置全部动画到第 0 帧，并标记为待提交（在 LoadBgTiles 之后调用）。
+/// </summary>
+void TileAnim_Init();
+
+/// <summary>
+/// 推进一帧计时，到时的动画换帧并标记为待提交（每帧调用一次）。
+/// </summary>
+void TileAnim_Update();
+
+/// <summary>
+/// 把待提交的动画帧 DMA 到 char block 0（需在 VBlank 内调用）。
+/// </summary>
+/// <returns>本次传输的字节数</returns>
+u32 TileAnim_Commit();
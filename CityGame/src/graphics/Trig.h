@@ -0,0 +1,32 @@
+/*------------------------------------------------------------------------
+名称：三角函数表
+说明：定点正弦 / 余弦查表，供仿射 OBJ 与 BG 旋转缩放使用，不使用浮点
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：角度为 u8（256 为一周，0x40 为 90 度）；结果为 4.12 定点（4096 = 1.0）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+// 一周的角度数
+#define TRIG_ANGLES 256
+// 查表结果的小数位数
+#define TRIG_SHIFT 12
+
+/// <summary>
+/// 正弦表：g_SinLut[a] = sin(a * 2π / 256) * 4096。
+/// </summary>
+extern const s16 g_SinLut[TRIG_ANGLES];
+
+static inline int Trig_Sin(u8 angle)
+{
+    return g_SinLut[angle];
+}
+
+static inline int Trig_Cos(u8 angle)
+{
+    return g_SinLut[(u8)(angle + 0x40)];
+}
@@ -9,29 +9,38 @@
 
 #include <gba.h>
 
-extern const int g_MapWidth;
-extern const int g_MapHeight;
-extern const int g_TileWidth;
-extern const int g_TileHeight;
-extern const unsigned int g_UsedTileCount;
-
-extern const unsigned short g_Palette[256];
-extern const unsigned short g_Layer0[];
-extern const unsigned short g_Layer1[];
-extern const unsigned short g_Layer2[];
-extern const unsigned short g_Layer3[];
-extern const unsigned short g_GidToBaseTile8[];
-extern const unsigned int g_BgTileCount;
-extern const unsigned char g_BgTiles[];
-
-extern const int g_PlayerWidth;
-extern const int g_PlayerHeight;
-extern const unsigned short g_PlayerObjFrame0TileId;
-extern const unsigned short g_PlayerObjFrame1TileId;
-extern const unsigned char g_PlayerObjTiles[];
-
-extern const unsigned char _binary_obj_morningmix_pcm_start[];
-extern const unsigned char _binary_obj_morningmix_pcm_end[];
+#include "generated_assets.h"
+#include "DebugLog.h"
+#include "MemOps.h"
+#include "Profiler.h"
+#include "WaitState.h"
+#include "graphics/Mode7.h"
+#include "graphics/ObjAffine.h"
+#include "graphics/ObjShadow.h"
+#include "graphics/PaletteFx.h"
+#include "graphics/Raster.h"
+#include "graphics/Reveal.h"
+#include "graphics/TileAnim.h"
+#include "graphics/Trig.h"
+#include "ui/Dialog.h"
+#include "memory/GameMemory.h"
+#include "world/Camera.h"
+#include "world/Collision.h"
+#include "world/Entities.h"
+#include "world/LayerStream.h"
+#include "world/PathFind.h"
+#include "world/WorldChunks.h"
+
+#if defined(CITYGAME_BENCH)
+#include "bench/Bench.h"
+#endif
+
+// 角色弹跳时的显示缩放（8.8 定点，X / Y）：先压扁再拉伸，回到原大小
+static const s16 g_PlayerSquash[][2] = {
+    { 288, 224 }, { 320, 192 }, { 336, 176 }, { 320, 192 }, { 288, 224 }, { 256, 256 },
+    { 240, 280 }, { 232, 292 }, { 240, 280 }, { 256, 256 }, { 264, 248 }, { 268, 244 },
+    { 264, 248 }, { 260, 252 },
+};
 
 static volatile u32 g_BgmTimer1Overflow = 0;
 static u32 g_BgmSampleCount = 0;
@@ -429,204 +438,135 @@ int main()
 
 #endif
 
-typedef struct
-{
-    u16 attr0;
-    u16 attr1;
-    u16 attr2;
-    u16 pad;
-} ObjAttr;
-
-static volatile ObjAttr* const g_Oam = (volatile ObjAttr*)0x07000000;
 static volatile u16* const g_ObjPal = (volatile u16*)0x05000200;
 static volatile u16* const g_ObjVram16 = (volatile u16*)0x06010000;
 static volatile u16* const g_BgVram16 = (volatile u16*)0x06000000;
 
 static const u16 g_DispcntObj1DMap = 0x0040;
 
+// 城镇行人数量（实体系统设计容量 ENTITY_MAX）
+static const int g_TownWalkerCount = 100;
+
+// 开场对话文本（对话框自动折行分页）
+static const char* const g_WelcomeText =
+    "欢迎来到小镇！方向键四处走走看看吧。镇上的居民会在街道和广场之间来回走动，"
+    "路上碰到他们的时候记得让一让。\f文字逐字出现时按 A 键可以立即显示整页，整页显示后按 A 键翻到下一页；最后一页再按 A 键关闭对话，之后再按一次可以重新打开。";
+
+// 寻路每帧扩展节点预算（A* 与流场合计）
+static const int g_PathExpansionsPerFrame = 64;
+
 static inline u16 BgCnt(u16 prio, u16 charBase, u16 screenBase, bool is8bpp, u16 sizeCode)
 {
     return (u16)((prio & 3) | ((charBase & 3) << 2) | (is8bpp ? (1 << 7) : 0) | ((screenBase & 31) << 8) | ((sizeCode & 3) << 14));
 }
 
-static inline void WriteBgMapEntry(volatile u16* base, int vramX, int vramY, u16 tileId)
-{
-    // 64x32：由两个 32x32 screenblock 组成（左右各一个）
-    const int block = (vramX >= 32) ? 1 : 0;
-    const int x = vramX & 31;
-    base[block * 1024 + vramY * 32 + x] = tileId;
-}
-
-static const unsigned short* GetLayerData2(int layerIndex)
+static inline int Wrap64(int v)
 {
-    switch(layerIndex) {
-        case 0: return g_Layer0;
-        case 1: return g_Layer1;
-        case 2: return g_Layer2;
-        case 3: return g_Layer3;
-        default: return g_Layer0;
-    }
+    return v & 63;
 }
 
-static inline u16 GetBgTileIdForWorld(int layerIndex, int worldTileX8, int worldTileY8)
+static inline int Wrap32(int v)
 {
-    const int worldTilesW = g_MapWidth * 2;
-    const int worldTilesH = g_MapHeight * 2;
-
-    if(worldTileX8 < 0 || worldTileY8 < 0 || worldTileX8 >= worldTilesW || worldTileY8 >= worldTilesH) {
-        return 0;
-    }
-
-    const int cellX16 = worldTileX8 >> 1;
-    const int cellY16 = worldTileY8 >> 1;
-    const unsigned short* layer = GetLayerData2(layerIndex);
-    const unsigned short gid = layer[cellY16 * g_MapWidth + cellX16];
-    if(gid == 0) {
-        return 0;
-    }
-
-    const unsigned short base = g_GidToBaseTile8[gid];
-    if(base == 0) {
-        return 0;
-    }
-
-    const int q = (worldTileX8 & 1) | ((worldTileY8 & 1) << 1);
-    return (u16)(base + q);
+    return v & 31;
 }
 
 /// <summary>
-/// 判断 16x16 世界格子是否为障碍物。
+/// 16x16 格子 (cellX, cellY) 周围 3x3 内是否有图层 3（屋顶 / 门窗）的内容。
 /// </summary>
-/// <param name="cellX16">16x16 格子 X</param>
-/// <param name="cellY16">16x16 格子 Y</param>
-/// <returns>为 true 表示不可穿越</returns>
-static inline bool IsSolidCell16(int cellX16, int cellY16)
+static bool IsRoofNear(int cellX, int cellY)
 {
-    if(cellX16 < 0 || cellY16 < 0 || cellX16 >= g_MapWidth || cellY16 >= g_MapHeight) {
-        return true;
-    }
-
-    // 约定：Objects 与 Doors/windows/roof 图层都作为障碍物
-    const int idx = cellY16 * g_MapWidth + cellX16;
-    if(g_Layer2[idx] != 0) {
-        return true;
-    }
-    if(g_Layer3[idx] != 0) {
-        return true;
+    const int mask = WORLD_CHUNK_CELLS - 1;
+    for(int y = cellY - 1; y <= cellY + 1; y++) {
+        for(int x = cellX - 1; x <= cellX + 1; x++) {
+            if(x < 0 || y < 0 || x >= g_MapWidth || y >= g_MapHeight) {
+                continue;
+            }
+            const u16* cells = WorldChunks_Get(3, x >> WORLD_CHUNK_SHIFT, y >> WORLD_CHUNK_SHIFT);
+            if(cells[((y & mask) << WORLD_CHUNK_SHIFT) | (x & mask)] != 0) {
+                return true;
+            }
+        }
     }
     return false;
 }
 
 /// <summary>
-/// 判断角色在指定像素坐标是否会与障碍物碰撞。
+/// 总览地图（START 进入 / 退出）：从角色南方俯瞰，方向键左右转向、上下前进后退，L / R 降低 / 升高镜头。
+/// 从 VBlank 外调用，返回时已恢复游戏的显示模式。
 /// </summary>
-/// <param name="px">角色中心像素 X</param>
-/// <param name="py">角色中心像素 Y</param>
-/// <returns>为 true 表示会碰撞，不能移动到该位置</returns>
-static inline bool IsPlayerBlocked(int px, int py)
+static void RunOverview(int playerX, int playerY)
 {
-    // 采用脚下碰撞盒（更贴近实际行走）
-    const int centerX = px;
-    const int centerY = py + 8;
-    const int halfW = 6;
-    const int halfH = 6;
-
-    const int x0 = centerX - halfW;
-    const int x1 = centerX + halfW;
-    const int y0 = centerY - halfH;
-    const int y1 = centerY + halfH;
-
-    if(IsSolidCell16(x0 / 16, y0 / 16)) return true;
-    if(IsSolidCell16(x1 / 16, y0 / 16)) return true;
-    if(IsSolidCell16(x0 / 16, y1 / 16)) return true;
-    if(IsSolidCell16(x1 / 16, y1 / 16)) return true;
-    return false;
-}
+    VBlankIntrWait();
+    if(!Mode7_Enter()) {
+        DebugLog_Printf(DEBUGLOG_WARN, "[mode7] BG tiles overlap overview VRAM, overview disabled");
+        return;
+    }
 
-static inline int Wrap64(int v)
-{
-    return v & 63;
-}
+    // 总览图 1 像素 = 世界 2 像素
+    const int overviewW = g_MapWidth * 8;
+    const int overviewH = g_MapHeight * 8;
+    Mode7Camera camera;
+    camera.x = (playerX / 2) << 8;
+    camera.y = (playerY / 2 + 80) << 8;
+    camera.angle = 0;
+    camera.height = 48;
+    Mode7_Build(&camera);
 
-static inline int Wrap32(int v)
-{
-    return v & 31;
-}
+    while(1) {
+        VBlankIntrWait();
+        Mode7_Commit();
 
-static inline int WorldXFromVramX(int bufX, int vramX)
-{
-    return bufX + Wrap64(vramX - Wrap64(bufX));
-}
+        PROFILE_FRAME_END();
+        PROFILE_SCOPE("frame");
 
-static inline int WorldYFromVramY(int bufY, int vramY)
-{
-    return bufY + Wrap32(vramY - Wrap32(bufY));
-}
+        UpdateBgmLoop();
 
-static void FillAllLayerMaps(volatile u16* bgMap, int layerIndex, int bufX, int bufY)
-{
-    for(int vy = 0; vy < 32; vy++) {
-        const int worldY = WorldYFromVramY(bufY, vy);
-        for(int vx = 0; vx < 64; vx++) {
-            const int worldX = WorldXFromVramX(bufX, vx);
-            const u16 tileId = GetBgTileIdForWorld(layerIndex, worldX, worldY);
-            WriteBgMapEntry(bgMap, vx, vy, tileId);
+        scanKeys();
+        const u16 keys = keysHeld();
+        if(keysDown() & KEY_START) {
+            break;
         }
-    }
-}
 
-static void UpdateLayerColumn(volatile u16* bgMap, int layerIndex, int bufX, int bufY, int vramX, int worldX)
-{
-    for(int vy = 0; vy < 32; vy++) {
-        const int worldY = WorldYFromVramY(bufY, vy);
-        const u16 tileId = GetBgTileIdForWorld(layerIndex, worldX, worldY);
-        WriteBgMapEntry(bgMap, vramX, vy, tileId);
-    }
-}
+        if(keys & KEY_LEFT) camera.angle--;
+        if(keys & KEY_RIGHT) camera.angle++;
+        if(keys & (KEY_UP | KEY_DOWN)) {
+            // 4.12 的朝向向量右移 4 位即每帧 1 像素（24.8）
+            const s32 stepX = Trig_Sin(camera.angle) >> 4;
+            const s32 stepY = -Trig_Cos(camera.angle) >> 4;
+            const int sign = (keys & KEY_UP) ? 1 : -1;
+            camera.x += stepX * sign;
+            camera.y += stepY * sign;
+        }
+        if((keys & KEY_L) && camera.height > MODE7_HEIGHT_MIN) camera.height--;
+        if((keys & KEY_R) && camera.height < MODE7_HEIGHT_MAX) camera.height++;
 
-static void UpdateLayerRow(volatile u16* bgMap, int layerIndex, int bufX, int bufY, int vramY, int worldY)
-{
-    for(int vx = 0; vx < 64; vx++) {
-        const int worldX = WorldXFromVramX(bufX, vx);
-        const u16 tileId = GetBgTileIdForWorld(layerIndex, worldX, worldY);
-        WriteBgMapEntry(bgMap, vx, vramY, tileId);
+        if(camera.x < 0) camera.x = 0;
+        if(camera.y < 0) camera.y = 0;
+        if(camera.x > (overviewW << 8)) camera.x = overviewW << 8;
+        if(camera.y > ((overviewH + 160) << 8)) camera.y = (overviewH + 160) << 8;
+
+        PROFILE_SCOPE("mode7 build");
+        Mode7_Build(&camera);
     }
+
+    VBlankIntrWait();
+    Mode7_Leave();
 }
 
 static inline void LoadPalette2()
 {
-    for(int i = 0; i < 256; i++) {
-        BG_PALETTE[i] = g_Palette[i];
-        g_ObjPal[i] = g_Palette[i];
-    }
+    VramCopy((void*)BG_PALETTE, g_Palette, sizeof(g_Palette));
+    VramCopy((void*)g_ObjPal, g_Palette, sizeof(g_Palette));
 }
 
 static void LoadBgTiles()
 {
-    const int halfwords = (int)(g_BgTileCount * 64) / 2;
-    const u16* src = (const u16*)g_BgTiles;
-    for(int i = 0; i < halfwords; i++) {
-        g_BgVram16[i] = src[i];
-    }
+    VramCopy((void*)g_BgVram16, g_BgTiles, g_BgTileCount * 64);
 }
 
 static void LoadPlayerObjTiles()
 {
-    const int halfwords = (32 * 32 * 2) / 2;
-    const u16* src = (const u16*)g_PlayerObjTiles;
-    for(int i = 0; i < halfwords; i++) {
-        g_ObjVram16[i] = src[i];
-    }
-}
-
-static void HideAllObjects()
-{
-    for(int i = 0; i < 128; i++) {
-        g_Oam[i].attr0 = 160;
-        g_Oam[i].attr1 = 0;
-        g_Oam[i].attr2 = 0;
-        g_Oam[i].pad = 0;
-    }
+    VramCopy((void*)g_ObjVram16, g_PlayerObjTiles, 32 * 32 * 2);
 }
 
 static void InitPlayerObj(int screenX, int screenY, u16 tileId)
@@ -634,32 +574,44 @@ static void InitPlayerObj(int screenX, int screenY, u16 tileId)
     // attr0: Y(0-255) + 256色 + 正方形
     // attr1: X(0-511) + 32x32
     // attr2: tileId(0-1023) + priority
-    g_Oam[0].attr0 = (u16)((screenY & 0xFF) | 0x2000 | 0x0000);
-    g_Oam[0].attr1 = (u16)((screenX & 0x1FF) | 0x8000);
-    g_Oam[0].attr2 = (u16)((tileId & 0x03FF) | 0x0000);
-    g_Oam[0].pad = 0;
+    g_ShadowOam[0].attr0 = (u16)((screenY & 0xFF) | 0x2000 | 0x0000);
+    g_ShadowOam[0].attr1 = (u16)((screenX & 0x1FF) | 0x8000);
+    g_ShadowOam[0].attr2 = (u16)((tileId & 0x03FF) | 0x0000);
 }
 
 static void SetPlayerObjTile(u16 tileId)
 {
-    g_Oam[0].attr2 = (u16)((g_Oam[0].attr2 & 0xFC00) | (tileId & 0x03FF));
+    g_ShadowOam[0].attr2 = (u16)((g_ShadowOam[0].attr2 & 0xFC00) | (tileId & 0x03FF));
 }
 
 static void SetPlayerObjHFlip(bool hflip)
 {
     // 普通 OBJ：attr1 bit12 为水平翻转
     if(hflip) {
-        g_Oam[0].attr1 = (u16)(g_Oam[0].attr1 | 0x1000);
+        g_ShadowOam[0].attr1 = (u16)(g_ShadowOam[0].attr1 | 0x1000);
     } else {
-        g_Oam[0].attr1 = (u16)(g_Oam[0].attr1 & ~0x1000);
+        g_ShadowOam[0].attr1 = (u16)(g_ShadowOam[0].attr1 & ~0x1000);
     }
 }
 
 int main()
 {
+    // ROM 等待周期：WS0 3/1 + 预取，用一段 BG tiles 做读回校验，失败则回退到安全档位
+    WaitState_Init(WAITSTATE_FAST, g_BgTiles, 1024);
+
     irqInit();
     irqEnable(IRQ_VBLANK);
 
+#if defined(GBA_PROFILE)
+    Profiler_Init();
+#endif
+
+    GameMemory_Init();
+
+#if defined(CITYGAME_BENCH)
+    Bench_RunAll();
+#endif
+
     SetMode(MODE_0 | BG0_ON | BG1_ON | BG2_ON | BG3_ON | OBJ_ON);
     REG_DISPCNT |= g_DispcntObj1DMap;
 
@@ -676,11 +628,20 @@ int main()
     volatile u16* bg2Map = (volatile u16*)(0x06000000 + 28 * 0x800);
     volatile u16* bg3Map = (volatile u16*)(0x06000000 + 30 * 0x800);
 
+    // BG tiles 必须落在 screenbase 24 之前；环形缓冲要求世界至少 64x32 个 8x8 tile
+    GBA_ASSERT(g_BgTileCount * 64 <= 24 * 0x800);
+    GBA_ASSERT(g_MapWidth * 2 >= 64 && g_MapHeight * 2 >= 32);
+
     LoadPalette2();
     LoadBgTiles();
     LoadPlayerObjTiles();
+    TileAnim_Init();
+    TileAnim_Commit();
 
-    HideAllObjects();
+    ObjShadow_HideFrom(0);
+    ObjAffine_Init();
+    ObjShadow_Commit();
+    Raster_Init();
 
     const int mapPixelW = g_MapWidth * g_TileWidth;
     const int mapPixelH = g_MapHeight * g_TileHeight;
@@ -688,31 +649,76 @@ int main()
     int playerX = mapPixelW / 2;
     int playerY = mapPixelH / 2;
 
-    int camX = playerX - 120;
-    int camY = playerY - 80;
-
-    if(camX < 0) camX = 0;
-    if(camY < 0) camY = 0;
-    if(camX > mapPixelW - 240) camX = mapPixelW - 240;
-    if(camY > mapPixelH - 160) camY = mapPixelH - 160;
-
-    // world 8x8 tile 维度
-    const int worldTilesW = g_MapWidth * 2;
-    const int worldTilesH = g_MapHeight * 2;
+    // 镜头：死区 + 前瞻 + 平滑，角色在死区内走动时 BG 不滚动、不流式写入
+    Camera camera;
+    Camera_Init(&camera, &g_CameraDefault, mapPixelW, mapPixelH, playerX, playerY);
+    int camX = Camera_X(&camera);
+    int camY = Camera_Y(&camera);
 
     int bufX = 0;
     int bufY = 0;
 
+    // 进入地图：地图生命周期的内存从头分配
+    GameMemory_ResetMap();
+    if(!WorldChunks_Init(&g_MapArena)) {
+        // 区块缓存不可用时 WorldChunks_Get 只返回空区块，地图显示为空白
+        DebugLog_Printf(DEBUGLOG_ERROR, "[world] chunk cache init failed, map will be empty");
+    }
+    PathFind_Init(&g_MapArena);
+
     // 初次填充地图
-    FillAllLayerMaps(bg0Map, 0, bufX, bufY);
-    FillAllLayerMaps(bg1Map, 1, bufX, bufY);
-    FillAllLayerMaps(bg2Map, 2, bufX, bufY);
-    FillAllLayerMaps(bg3Map, 3, bufX, bufY);
+    LayerStream_Fill(bg0Map, 0, bufX, bufY);
+    LayerStream_Fill(bg1Map, 1, bufX, bufY);
+    LayerStream_Fill(bg2Map, 2, bufX, bufY);
+    LayerStream_Fill(bg3Map, 3, bufX, bufY);
 
     InitPlayerObj(120 - 16, 80 - 16, g_PlayerObjFrame0TileId);
 
+    // 开场对话（逐字显示；A 键跳过 / 翻页 / 关闭）
+    Dialog_Init();
+    Dialog_Show(g_WelcomeText);
+
+    // 屋顶遮罩：圆形点阵放在对话框之后的 OBJ 图块
+    Reveal_Init();
+
+    // 调色板全部写好之后接管：对话框的调色板组不参与昼夜色调；进入地图时从黑色淡入
+    PaletteFx_Init();
+    PaletteFx_SetFixed(256 + DIALOG_PALETTE_BANK * 16, 16);
+    PaletteFx_FadeBrightness(-16, 0);
+    PaletteFx_FadeBrightness(0, 32);
+
+    // 城镇行人（NPC）：游走间隙发起短途寻路，或沿流场走向地图中心附近的聚集点
+    if(Entities_Init(&g_MapArena)) {
+        GameMemory_RegisterPool(Entities_RoutePool());
+    } else {
+        DebugLog_Printf(DEBUGLOG_ERROR, "[entities] route pool alloc failed, walkers only wander");
+    }
+    Entities_SpawnWalkers(g_TownWalkerCount, 0xC17E);
+    Entities_SetGathering(g_MapWidth / 2, g_MapHeight / 2);
+
     bool faceLeft = false;
 
+    // R 触发弹跳（仿射 OBJ）；-1 为未弹跳
+    int squashFrame = -1;
+    int playerMatrix = OBJAFFINE_NONE;
+
+    // 角色靠近图层 3 时挖掉周围的 BG3；只在角色所在格子变化时检查，B 切换圆形 / 矩形
+    int roofCellX = -1;
+    int roofCellY = -1;
+    bool roofOpen = false;
+
+    // 最近一次写入滚动表的 BG 滚动值（从总览地图返回时重建滚动表）
+    int scrollHofs = (camX - bufX * 8 + Wrap64(bufX) * 8) & 511;
+    int scrollVofs = (camY - bufY * 8 + Wrap32(bufY) * 8) & 255;
+
+    bool heatShimmer = false;
+    bool night = false;
+    int rasterPhase = 0;
+
+    // 上一帧镜头位置（区块预取方向）
+    int prevCamX = camX;
+    int prevCamY = camY;
+
     int animTick = 0;
 
     StartBgm();
@@ -720,11 +726,41 @@ int main()
     while(1) {
         VBlankIntrWait();
 
-        UpdateBgmLoop();
+        // 上一帧准备好的 OBJ 属性、动画 tile、滚动表与调色板在 VBlank 开头一次提交
+        ObjShadow_Commit();
+        Reveal_Commit();
+        TileAnim_Commit();
+        Raster_Commit();
+        PaletteFx_Commit();
 
         scanKeys();
+
+        // START 打开总览地图：在本帧的 "frame" 计时之前处理，总览自己逐帧计时，两者不嵌套；
+        // 返回后按上一帧的滚动值重新生成被清空的滚动表，从下一帧继续
+        if(keysDown() & KEY_START) {
+            RunOverview(playerX, playerY);
+            Raster_Begin(scrollHofs, scrollVofs);
+            continue;
+        }
+
+        PROFILE_FRAME_END();
+        PROFILE_SCOPE("frame");
+
+        GameMemory_BeginFrame();
+
+        UpdateBgmLoop();
+
         const u16 keys = keysHeld();
 
+        // A：逐字显示时跳过，整页后翻页，最后一页关闭；关闭后再按重新打开
+        if(keysDown() & KEY_A) {
+            if(Dialog_IsVisible()) {
+                Dialog_Advance();
+            } else {
+                Dialog_Show(g_WelcomeText);
+            }
+        }
+
         int dx = 0;
         int dy = 0;
 
@@ -743,14 +779,14 @@ int main()
         bool moved = false;
         if(dx != 0) {
             const int nextX = playerX + dx;
-            if(!IsPlayerBlocked(nextX, playerY)) {
+            if(!IsActorBlocked(nextX, playerY)) {
                 playerX = nextX;
                 moved = true;
             }
         }
         if(dy != 0) {
             const int nextY = playerY + dy;
-            if(!IsPlayerBlocked(playerX, nextY)) {
+            if(!IsActorBlocked(playerX, nextY)) {
                 playerY = nextY;
                 moved = true;
             }
@@ -764,93 +800,86 @@ int main()
         if(playerX > mapPixelW) playerX = mapPixelW;
         if(playerY > mapPixelH) playerY = mapPixelH;
 
-        camX = playerX - 120;
-        camY = playerY - 80;
-
-        if(camX < 0) camX = 0;
-        if(camY < 0) camY = 0;
-        if(camX > mapPixelW - 240) camX = mapPixelW - 240;
-        if(camY > mapPixelH - 160) camY = mapPixelH - 160;
+        Camera_Update(&camera, playerX, playerY, dx, dy);
+        camX = Camera_X(&camera);
+        camY = Camera_Y(&camera);
 
-        // 计算需要的 buffer world tile 起点（64x32）
-        const int camTileX8 = camX >> 3;
-        const int camTileY8 = camY >> 3;
-
-        int wantBufX = bufX;
-        int wantBufY = bufY;
-
-        // 保证可视范围落在 [buf, buf+size) 内
-        // 注意：当像素滚动不是 8 的整数倍时，屏幕边缘会额外露出 1 列/行 8x8 tile，需要一并覆盖，否则会出现最右竖条/最下横条跳动。
-        if(camTileX8 < bufX) {
-            wantBufX = camTileX8;
-        } else if(camTileX8 + 30 > bufX + 63) {
-            wantBufX = camTileX8 - 33;
-        }
+        Entities_Update(camX, camY, playerX, playerY);
+        PathFind_Update(g_PathExpansionsPerFrame);
+        Dialog_Update();
+        TileAnim_Update();
 
-        if(camTileY8 < bufY) {
-            wantBufY = camTileY8;
-        } else if(camTileY8 + 20 > bufY + 31) {
-            wantBufY = camTileY8 - 11;
+        // L 切换昼夜（整体朝深蓝混合）
+        if(keysDown() & KEY_L) {
+            night = !night;
+            PaletteFx_FadeTint(RGB5(2, 3, 10), night ? 14 : 0, 60);
         }
+        PaletteFx_Update();
 
-        if(wantBufX < 0) wantBufX = 0;
-        if(wantBufY < 0) wantBufY = 0;
-        if(wantBufX > worldTilesW - 64) wantBufX = worldTilesW - 64;
-        if(wantBufY > worldTilesH - 32) wantBufY = worldTilesH - 32;
+        // 计算需要的 buffer world tile 起点（64x32）
+        int wantBufX;
+        int wantBufY;
+        Camera_BufferTarget(camX, camY, bufX, bufY, &wantBufX, &wantBufY);
+        PROFILE_COUNT("stream cols", wantBufX > bufX ? wantBufX - bufX : bufX - wantBufX);
+        PROFILE_COUNT("stream rows", wantBufY > bufY ? wantBufY - bufY : bufY - wantBufY);
 
         // X 方向增量更新
+        // 滚入的 VRAM 列 / 行之前保存的是窗口另一端（相隔 64 列 / 32 行）的世界位置
         while(bufX < wantBufX) {
             bufX++;
-            const int vramX = Wrap64(bufX + 63);
             const int worldX = bufX + 63;
-            UpdateLayerColumn(bg0Map, 0, bufX, bufY, vramX, worldX);
-            UpdateLayerColumn(bg1Map, 1, bufX, bufY, vramX, worldX);
-            UpdateLayerColumn(bg2Map, 2, bufX, bufY, vramX, worldX);
-            UpdateLayerColumn(bg3Map, 3, bufX, bufY, vramX, worldX);
+            LayerStream_Column(bg0Map, 0, bufY, worldX, worldX - 64);
+            LayerStream_Column(bg1Map, 1, bufY, worldX, worldX - 64);
+            LayerStream_Column(bg2Map, 2, bufY, worldX, worldX - 64);
+            LayerStream_Column(bg3Map, 3, bufY, worldX, worldX - 64);
         }
         while(bufX > wantBufX) {
             bufX--;
-            const int vramX = Wrap64(bufX);
             const int worldX = bufX;
-            UpdateLayerColumn(bg0Map, 0, bufX, bufY, vramX, worldX);
-            UpdateLayerColumn(bg1Map, 1, bufX, bufY, vramX, worldX);
-            UpdateLayerColumn(bg2Map, 2, bufX, bufY, vramX, worldX);
-            UpdateLayerColumn(bg3Map, 3, bufX, bufY, vramX, worldX);
+            LayerStream_Column(bg0Map, 0, bufY, worldX, worldX + 64);
+            LayerStream_Column(bg1Map, 1, bufY, worldX, worldX + 64);
+            LayerStream_Column(bg2Map, 2, bufY, worldX, worldX + 64);
+            LayerStream_Column(bg3Map, 3, bufY, worldX, worldX + 64);
         }
 
         // Y 方向增量更新
         while(bufY < wantBufY) {
             bufY++;
-            const int vramY = Wrap32(bufY + 31);
             const int worldY = bufY + 31;
-            UpdateLayerRow(bg0Map, 0, bufX, bufY, vramY, worldY);
-            UpdateLayerRow(bg1Map, 1, bufX, bufY, vramY, worldY);
-            UpdateLayerRow(bg2Map, 2, bufX, bufY, vramY, worldY);
-            UpdateLayerRow(bg3Map, 3, bufX, bufY, vramY, worldY);
+            LayerStream_Row(bg0Map, 0, bufX, worldY, worldY - 32);
+            LayerStream_Row(bg1Map, 1, bufX, worldY, worldY - 32);
+            LayerStream_Row(bg2Map, 2, bufX, worldY, worldY - 32);
+            LayerStream_Row(bg3Map, 3, bufX, worldY, worldY - 32);
         }
         while(bufY > wantBufY) {
             bufY--;
-            const int vramY = Wrap32(bufY);
             const int worldY = bufY;
-            UpdateLayerRow(bg0Map, 0, bufX, bufY, vramY, worldY);
-            UpdateLayerRow(bg1Map, 1, bufX, bufY, vramY, worldY);
-            UpdateLayerRow(bg2Map, 2, bufX, bufY, vramY, worldY);
-            UpdateLayerRow(bg3Map, 3, bufX, bufY, vramY, worldY);
+            LayerStream_Row(bg0Map, 0, bufX, worldY, worldY + 32);
+            LayerStream_Row(bg1Map, 1, bufX, worldY, worldY + 32);
+            LayerStream_Row(bg2Map, 2, bufX, worldY, worldY + 32);
+            LayerStream_Row(bg3Map, 3, bufX, worldY, worldY + 32);
         }
 
-        // 设置 BG 滚动（不闪烁）
+        // 沿滚动方向预取区块：每帧至多解压一个，跨入新区块时已在缓存
+        WorldChunks_Prefetch(bufX, bufY, camX - prevCamX, camY - prevCamY);
+        prevCamX = camX;
+        prevCamY = camY;
+
+        // BG 滚动写入下一帧的滚动表，VBlank 开头与 OAM 一起提交（不闪烁）
         const int hofs = camX - bufX * 8 + (Wrap64(bufX) * 8);
         const int vofs = camY - bufY * 8 + (Wrap32(bufY) * 8);
+        scrollHofs = hofs & 511;
+        scrollVofs = vofs & 255;
+        Raster_Begin(scrollHofs, scrollVofs);
 
-        REG_BG0HOFS = (u16)(hofs & 511);
-        REG_BG1HOFS = (u16)(hofs & 511);
-        REG_BG2HOFS = (u16)(hofs & 511);
-        REG_BG3HOFS = (u16)(hofs & 511);
-
-        REG_BG0VOFS = (u16)(vofs & 255);
-        REG_BG1VOFS = (u16)(vofs & 255);
-        REG_BG2VOFS = (u16)(vofs & 255);
-        REG_BG3VOFS = (u16)(vofs & 255);
+        // SELECT 切换热浪效果（4 个图层逐行正弦扭曲）
+        if(keysDown() & KEY_SELECT) {
+            heatShimmer = !heatShimmer;
+        }
+        if(heatShimmer) {
+            Raster_Wave(RASTER_BG_ALL, 0, RASTER_LINES, 2, 3, rasterPhase);
+            rasterPhase++;
+        }
 
         // 角色屏幕坐标（相机边缘时不强制居中）
         int sprX = playerX - camX - 16;
@@ -859,9 +888,36 @@ int main()
         if(sprY < -32) sprY = -32;
         if(sprX > 240) sprX = 240;
         if(sprY > 160) sprY = 160;
-        g_Oam[0].attr0 = (u16)((g_Oam[0].attr0 & 0xFF00) | (sprY & 0x00FF));
-        g_Oam[0].attr1 = (u16)((g_Oam[0].attr1 & 0xFE00) | (sprX & 0x01FF));
-        SetPlayerObjHFlip(faceLeft);
+
+        // 弹跳：双倍显示区域，左上移 16；按显示高度下移，脚底保持不动；水平翻转用负的 X 缩放
+        if(squashFrame < 0 && (keysDown() & KEY_R)) {
+            squashFrame = 0;
+        }
+        if(squashFrame >= (int)(sizeof(g_PlayerSquash) / sizeof(g_PlayerSquash[0]))) {
+            ObjAffine_Release(playerMatrix);
+            playerMatrix = OBJAFFINE_NONE;
+            ObjAffine_ClearObj(&g_ShadowOam[0]);
+            squashFrame = -1;
+        }
+        if(squashFrame >= 0) {
+            const s16 scaleX = g_PlayerSquash[squashFrame][0];
+            const s16 scaleY = g_PlayerSquash[squashFrame][1];
+            playerMatrix = ObjAffine_Change(playerMatrix, 0, (s16)(faceLeft ? -scaleX : scaleX), scaleY);
+            if(playerMatrix != OBJAFFINE_NONE) {
+                ObjAffine_SetObj(&g_ShadowOam[0], playerMatrix, true);
+                // 显示高度为 32 * scaleY / 256，下移 (32 - 高度) / 2
+                sprX -= 16;
+                sprY -= 16;
+                sprY += 16 - scaleY / 16;
+            }
+            squashFrame++;
+        }
+
+        g_ShadowOam[0].attr0 = (u16)((g_ShadowOam[0].attr0 & 0xFF00) | (sprY & 0x00FF));
+        g_ShadowOam[0].attr1 = (u16)((g_ShadowOam[0].attr1 & 0xFE00) | (sprX & 0x01FF));
+        if(playerMatrix == OBJAFFINE_NONE) {
+            SetPlayerObjHFlip(faceLeft);
+        }
 
         // 走路帧切换
         const bool walking = (dx != 0 || dy != 0);
@@ -871,5 +927,28 @@ int main()
         } else {
             SetPlayerObjTile(g_PlayerObjFrame0TileId);
         }
+
+        // 屋顶遮罩（脚下格子为碰撞盒中心）
+        const int cellX = playerX >> 4;
+        const int cellY = (playerY + 8) >> 4;
+        if(cellX != roofCellX || cellY != roofCellY) {
+            roofCellX = cellX;
+            roofCellY = cellY;
+            const bool roofNear = IsRoofNear(cellX, cellY);
+            if(roofNear != roofOpen) {
+                roofOpen = roofNear;
+                Reveal_Open(roofOpen, 12);
+            }
+        }
+        if(keysDown() & KEY_B) {
+            Reveal_SetShape(Reveal_GetShape() == REVEAL_CIRCLE ? REVEAL_RECT : REVEAL_CIRCLE);
+        }
+        Reveal_Update(playerX - camX, playerY - camY);
+
+        // 遮罩 OBJ 不显示图像，放在最前；对话框紧跟玩家（盖住 NPC），NPC 按纵坐标排序占用之后的 OBJ 槽位，其余隐藏
+        int nextObj = Reveal_WriteOam(1);
+        nextObj = Dialog_WriteOam(nextObj);
+        nextObj = Entities_WriteOam(nextObj, camX, camY, g_PlayerObjFrame0TileId, g_PlayerObjFrame1TileId, &g_FrameArena);
+        ObjShadow_HideFrom(nextObj);
     }
 }
@@ -0,0 +1,73 @@
+/*------------------------------------------------------------------------
+名称：游戏内存预算
+说明：EWRAM Arena 存储区定义与占用报告
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：存储区放在 .sbss（EWRAM，不占 ROM 初始化数据）
+------------------------------------------------------------------------*/
+
+#include "GameMemory.h"
+
+#include "DebugLog.h"
+
+static u8 g_MapArenaStorage[GAMEMEMORY_MAP_ARENA_BYTES] EWRAM_BSS __attribute__((aligned(4)));
+static u8 g_FrameArenaStorage[GAMEMEMORY_FRAME_ARENA_BYTES] EWRAM_BSS __attribute__((aligned(4)));
+
+MemArena g_MapArena;
+MemArena g_FrameArena;
+
+static const MemPool* g_GameMemoryPools[8];
+static int g_GameMemoryPoolCount = 0;
+
+static u32 g_GameMemoryFrame = 0;
+
+void GameMemory_Init()
+{
+    MemArena_Init(&g_MapArena, "map", g_MapArenaStorage, sizeof(g_MapArenaStorage));
+    MemArena_Init(&g_FrameArena, "frame", g_FrameArenaStorage, sizeof(g_FrameArenaStorage));
+    g_GameMemoryFrame = 0;
+}
+
+void GameMemory_ResetMap()
+{
+    MemArena_Reset(&g_MapArena);
+}
+
+void GameMemory_BeginFrame()
+{
+    MemArena_Reset(&g_FrameArena);
+
+#if defined(GBA_PROFILE)
+    g_GameMemoryFrame++;
+    if(g_GameMemoryFrame >= 600) {
+        g_GameMemoryFrame = 0;
+        GameMemory_Report();
+    }
+#endif
+}
+
+void GameMemory_RegisterPool(const MemPool* pool)
+{
+    for(int i = 0; i < g_GameMemoryPoolCount; i++) {
+        if(g_GameMemoryPools[i] == pool) {
+            return;
+        }
+    }
+    GBA_ASSERT(g_GameMemoryPoolCount < 8);
+    if(g_GameMemoryPoolCount < 8) {
+        g_GameMemoryPools[g_GameMemoryPoolCount++] = pool;
+    }
+}
+
+void GameMemory_Report()
+{
+    // 只统计两个 Arena 的容量，不含其它 EWRAM 全局变量与 .ewram 段
+    DebugLog_Printf(DEBUGLOG_INFO, "[mem] arenas only: map + frame %lu B of %lu B EWRAM",
+                    (unsigned long)(g_MapArena.capacity + g_FrameArena.capacity), (unsigned long)(256 * 1024));
+    MemArena_Log(&g_MapArena);
+    MemArena_Log(&g_FrameArena);
+    for(int i = 0; i < g_GameMemoryPoolCount; i++) {
+        MemPool_Log(g_GameMemoryPools[i]);
+    }
+}
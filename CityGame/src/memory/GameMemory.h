@@ -0,0 +1,51 @@
+/*------------------------------------------------------------------------
+名称：游戏内存预算
+说明：CityGame 运行时的 EWRAM 分配：地图生命周期 Arena、逐帧临时 Arena
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：EWRAM 共 256KB，此处静态划分并记录峰值；实体等定长对象使用各模块自己的 MemPool
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "Arena.h"
+
+// EWRAM 预算划分（字节）
+#define GAMEMEMORY_MAP_ARENA_BYTES (128 * 1024)
+#define GAMEMEMORY_FRAME_ARENA_BYTES (16 * 1024)
+
+/// <summary>
+/// 地图生命周期 Arena：切换区域时整体重置（解压地图、NPC 表、文本缓冲等）。
+/// </summary>
+extern MemArena g_MapArena;
+
+/// <summary>
+/// 逐帧临时 Arena：每帧开头重置，只能存放本帧内使用的数据（如 NPC 的 OAM 排序键）。
+/// </summary>
+extern MemArena g_FrameArena;
+
+/// <summary>
+/// 初始化全部 Arena（启动时调用一次）。
+/// </summary>
+void GameMemory_Init();
+
+/// <summary>
+/// 进入新区域：重置地图 Arena。
+/// </summary>
+void GameMemory_ResetMap();
+
+/// <summary>
+/// 帧开始：重置逐帧 Arena；profile 配置下每 600 帧输出一次占用。
+/// </summary>
+void GameMemory_BeginFrame();
+
+/// <summary>
+/// 登记一个对象池，使其出现在占用报告中（最多 8 个；重复登记同一对象池时忽略）。
+/// </summary>
+void GameMemory_RegisterPool(const MemPool* pool);
+
+/// <summary>
+/// 通过调试日志输出全部 Arena/Pool 的占用与峰值。
+/// </summary>
+void GameMemory_Report();
@@ -0,0 +1,127 @@
+/*------------------------------------------------------------------------
+名称：对话框
+说明：基于 ZhTileCanvas 的两行分页打字机对话框
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：画布 256x32 像素（32x4 图块），屏幕只显示左侧 240 像素
+      排版结果由 ZhLayout_Get 缓存，翻页只清除文字区域，不重新测量；每帧最多画 g_DialogGlyphsPerStep 个字
+------------------------------------------------------------------------*/
+
+#include "Dialog.h"
+
+#include "ZhFontType.h"
+#include "Profiler.h"
+#include "../graphics/ObjShadow.h"
+
+// OBJ 图块：玩家两帧 256 色 32x32 共占 0~63
+static const int g_DialogFirstTile = 64;
+static const int g_DialogPaletteBank = DIALOG_PALETTE_BANK;
+
+// 调色板组内颜色：0 透明，1 文字，2 底色，3 边框
+static const int g_DialogColorText = 1;
+static const int g_DialogColorBack = 2;
+static const int g_DialogColorFrame = 3;
+
+static const int g_DialogScreenY = 160 - 32;
+static const int g_DialogTextX = 8;
+static const int g_DialogTextWidth = 240 - 16;
+static const int g_DialogTextHeight = 26;
+static const int g_DialogLineY0 = 3;
+static const int g_DialogLineHeight = 14;
+static const int g_DialogLinesPerPage = 2;
+
+// 打字速度：每 2 帧 1 个字
+static const int g_DialogGlyphsPerStep = 1;
+static const int g_DialogFramesPerStep = 2;
+
+static ZhTileCanvas g_DialogCanvas;
+static ZhTypewriter g_DialogTyper;
+static bool g_DialogVisible = false;
+
+void Dialog_Init()
+{
+    volatile u16* objPal = (volatile u16*)0x05000200 + g_DialogPaletteBank * 16;
+    objPal[g_DialogColorText] = RGB5(31, 31, 31);
+    objPal[g_DialogColorBack] = RGB5(3, 4, 10);
+    objPal[g_DialogColorFrame] = RGB5(20, 20, 26);
+
+    ZhTile_Init(&g_DialogCanvas, 0x06010000, g_DialogFirstTile, 32, 4, ZHTILE_LAYOUT_OBJ64X32);
+    g_DialogVisible = false;
+}
+
+void Dialog_Show(const char* text)
+{
+    // 边框 + 底色
+    ZhTile_SetColors(&g_DialogCanvas, g_DialogColorText, g_DialogColorFrame);
+    ZhTile_Clear(&g_DialogCanvas);
+    g_DialogCanvas.bg = g_DialogColorBack;
+    ZhTile_ClearRect(&g_DialogCanvas, 1, 1, 240 - 2, 32 - 2);
+
+    ZhTypeBox box;
+    box.canvas = &g_DialogCanvas;
+    box.face = 0;
+    box.x = g_DialogTextX;
+    box.y = g_DialogLineY0;
+    box.width = g_DialogTextWidth;
+    box.height = g_DialogTextHeight;
+    box.lineHeight = g_DialogLineHeight;
+    box.linesPerPage = g_DialogLinesPerPage;
+    box.clearOnPage = 1;
+    box.effect = ZHBLIT_PLAIN;
+    box.color = 0;
+    box.background = 0;
+    box.effectColor = 0;
+
+    ZhType_SetSpeed(&g_DialogTyper, g_DialogGlyphsPerStep, g_DialogFramesPerStep);
+    ZhType_Begin(&g_DialogTyper, text, &box);
+    g_DialogVisible = true;
+}
+
+void Dialog_Update()
+{
+    if(!g_DialogVisible || ZhType_State(&g_DialogTyper) != ZHTYPE_TYPING) {
+        return;
+    }
+    PROFILE_SCOPE("dialog type");
+    ZhType_Step(&g_DialogTyper);
+}
+
+void Dialog_Advance()
+{
+    if(!g_DialogVisible) {
+        return;
+    }
+
+    PROFILE_SCOPE("dialog draw");
+    switch(ZhType_State(&g_DialogTyper)) {
+        case ZHTYPE_TYPING:
+            ZhType_Skip(&g_DialogTyper);
+            break;
+        case ZHTYPE_PAGE_END:
+            ZhType_NextPage(&g_DialogTyper);
+            break;
+        default:
+            Dialog_Hide();
+            break;
+    }
+}
+
+void Dialog_Hide()
+{
+    g_DialogVisible = false;
+}
+
+bool Dialog_IsVisible()
+{
+    return g_DialogVisible;
+}
+
+int Dialog_WriteOam(int firstSlot)
+{
+    if(!g_DialogVisible || firstSlot + DIALOG_OBJ_COUNT > 128) {
+        return firstSlot;
+    }
+    const int used = ZhTile_WriteObjAttrs(&g_DialogCanvas, &g_ShadowOam[firstSlot].attr0, 0, g_DialogScreenY, g_DialogPaletteBank, 0);
+    return firstSlot + used;
+}
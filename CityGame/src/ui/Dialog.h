@@ -0,0 +1,55 @@
+/*------------------------------------------------------------------------
+名称：对话框
+说明：屏幕底部的中文对话框，长文本经 ZhFontLayout 折行分页、ZhFontType 逐帧打字显示，文字经 ZhFont 图块后端栅格化到 OBJ 图块，由 4 个 64x32 的 16 色 OBJ 显示
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：4 个 BG 全部用于地图，因此对话框走 OBJ；占用 OBJ 图块 64~191 与 OBJ 调色板第 15 组
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+// 对话框占用的 OBJ 数量（4 个 64x32）
+#define DIALOG_OBJ_COUNT 4
+// 对话框专用的 OBJ 调色板组
+#define DIALOG_PALETTE_BANK 15
+
+/// <summary>
+/// 初始化对话框画布与调色板（需在玩家 OBJ 图块载入之后调用）。
+/// </summary>
+void Dialog_Init();
+
+/// <summary>
+/// 显示对话框：UTF-8 文本按对话框宽度自动折行、每页两行，从第一页开始逐字显示。
+/// </summary>
+/// <param name="text">文本（需在对话期间保持有效；\n 换行，\f 换页）</param>
+void Dialog_Show(const char* text);
+
+/// <summary>
+/// 每帧调用一次：推进打字效果（隐藏或本页已显示完时立即返回）。
+/// </summary>
+void Dialog_Update();
+
+/// <summary>
+/// 确认键：正在打字时显示完本页，本页已显示完时翻页，最后一页时关闭对话框。
+/// </summary>
+void Dialog_Advance();
+
+/// <summary>
+/// 隐藏对话框。
+/// </summary>
+void Dialog_Hide();
+
+/// <summary>
+/// 对话框是否显示中。
+/// </summary>
+bool Dialog_IsVisible();
+
+/// <summary>
+/// 把对话框写入影子 OAM。
+/// </summary>
+/// <param name="firstSlot">起始 OAM 槽位</param>
+/// <returns>下一个可用槽位（隐藏时等于 firstSlot）</returns>
+int Dialog_WriteOam(int firstSlot);
@@ -0,0 +1,124 @@
+/*------------------------------------------------------------------------
+名称：镜头
+说明：死区推动、前瞻与位置平滑、边缘限制；缓冲窗口的最少移动策略
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：停下时保留最后的前瞻偏移，避免松开方向键后镜头回退又产生一次滚动
+------------------------------------------------------------------------*/
+
+#include "Camera.h"
+
+#include "../generated_assets.h"
+
+// 屏幕中心（像素）
+#define CAMERA_HALF_W 120
+#define CAMERA_HALF_H 80
+
+const CameraConfig g_CameraLocked = { 0, 0, 0, 0, 0, 0 };
+const CameraConfig g_CameraDefault = { 24, 16, 32, 16, 4, 3 };
+
+static inline s32 Clamp(s32 value, s32 lo, s32 hi)
+{
+    if(value < lo) return lo;
+    if(value > hi) return hi;
+    return value;
+}
+
+/// <summary>
+/// 一维死区：焦点越出 [中心 - zone, 中心 + zone] 时把目标推到刚好容纳焦点的位置。
+/// </summary>
+static inline s32 PushGoal(s32 goal, s32 focus, int half, int zone)
+{
+    const s32 center = goal + (half << 8);
+    if(focus > center + (zone << 8)) {
+        return focus - ((zone + half) << 8);
+    }
+    if(focus < center - (zone << 8)) {
+        return focus + ((zone - half) << 8);
+    }
+    return goal;
+}
+
+/// <summary>
+/// 前瞻目标：移动时取该方向的前瞻距离，停下时保持不变。
+/// </summary>
+static inline s32 LookTarget(s32 current, int vel, int distance)
+{
+    if(vel > 0) return distance << 8;
+    if(vel < 0) return -(distance << 8);
+    return current;
+}
+
+/// <summary>
+/// 每帧靠近目标 1 / 2^shift，不足一步时直接到位（避免停在目标前几个 1/256 像素而差 1 像素）。
+/// </summary>
+static inline s32 Approach(s32 value, s32 goal, int shift)
+{
+    const s32 step = (goal - value) >> shift;
+    return step == 0 ? goal : value + step;
+}
+
+void Camera_Init(Camera* camera, const CameraConfig* config, int mapPixelW, int mapPixelH, int focusX, int focusY)
+{
+    camera->config = *config;
+    camera->maxX = mapPixelW - 240 > 0 ? mapPixelW - 240 : 0;
+    camera->maxY = mapPixelH - 160 > 0 ? mapPixelH - 160 : 0;
+    camera->lookX = 0;
+    camera->lookY = 0;
+    camera->goalX = Clamp((focusX - CAMERA_HALF_W) << 8, 0, camera->maxX << 8);
+    camera->goalY = Clamp((focusY - CAMERA_HALF_H) << 8, 0, camera->maxY << 8);
+    camera->x = camera->goalX;
+    camera->y = camera->goalY;
+}
+
+void Camera_Update(Camera* camera, int focusX, int focusY, int velX, int velY)
+{
+    const CameraConfig* config = &camera->config;
+
+    const s32 lookTargetX = LookTarget(camera->lookX, velX, config->lookAheadX);
+    const s32 lookTargetY = LookTarget(camera->lookY, velY, config->lookAheadY);
+    camera->lookX = Approach(camera->lookX, lookTargetX, config->lookAheadShift);
+    camera->lookY = Approach(camera->lookY, lookTargetY, config->lookAheadShift);
+
+    const s32 fx = (focusX << 8) + camera->lookX;
+    const s32 fy = (focusY << 8) + camera->lookY;
+    camera->goalX = Clamp(PushGoal(camera->goalX, fx, CAMERA_HALF_W, config->deadZoneX), 0, camera->maxX << 8);
+    camera->goalY = Clamp(PushGoal(camera->goalY, fy, CAMERA_HALF_H, config->deadZoneY), 0, camera->maxY << 8);
+
+    camera->x = Approach(camera->x, camera->goalX, config->smoothShift);
+    camera->y = Approach(camera->y, camera->goalY, config->smoothShift);
+}
+
+void Camera_BufferTarget(int camX, int camY, int bufX, int bufY, int* wantBufX, int* wantBufY)
+{
+    const int worldTilesW = g_MapWidth * 2;
+    const int worldTilesH = g_MapHeight * 2;
+    const int camTileX8 = camX >> 3;
+    const int camTileY8 = camY >> 3;
+
+    int wantX = bufX;
+    int wantY = bufY;
+
+    // 保证可视范围落在 [buf, buf+size) 内
+    // 注意：当像素滚动不是 8 的整数倍时，屏幕边缘会额外露出 1 列/行 8x8 tile，需要一并覆盖，否则会出现最右竖条/最下横条跳动。
+    if(camTileX8 < bufX) {
+        wantX = camTileX8;
+    } else if(camTileX8 + 30 > bufX + 63) {
+        wantX = camTileX8 - 33;
+    }
+
+    if(camTileY8 < bufY) {
+        wantY = camTileY8;
+    } else if(camTileY8 + 20 > bufY + 31) {
+        wantY = camTileY8 - 11;
+    }
+
+    if(wantX < 0) wantX = 0;
+    if(wantY < 0) wantY = 0;
+    if(wantX > worldTilesW - 64) wantX = worldTilesW - 64;
+    if(wantY > worldTilesH - 32) wantY = worldTilesH - 32;
+
+    *wantBufX = wantX;
+    *wantBufY = wantY;
+}
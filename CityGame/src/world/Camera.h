@@ -0,0 +1,91 @@
+/*------------------------------------------------------------------------
+名称：镜头
+说明：跟随目标的镜头：死区、按移动方向的前瞻、定点平滑与地图边缘限制，以及 64x32 环形 BG 缓冲窗口的移动策略
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：位置用 24.8 定点；目标在死区内移动时镜头不动，BG 不滚动也不流式写入。
+      缓冲窗口只在可视范围越出窗口时移动最少的列 / 行：横向留 33 列、纵向留 11 行的余量，
+      来回走动在余量用完前不会重复写入同一列 / 行
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 镜头参数。
+/// </summary>
+struct CameraConfig
+{
+    s16 deadZoneX;      // 死区半宽（像素，相对屏幕中心）
+    s16 deadZoneY;      // 死区半高
+    s16 lookAheadX;     // 水平移动时焦点前移的像素
+    s16 lookAheadY;     // 垂直移动时焦点前移的像素
+    u8 lookAheadShift;  // 前瞻偏移的平滑（每帧靠近 1 / 2^shift）
+    u8 smoothShift;     // 镜头位置的平滑（每帧靠近 1 / 2^shift，0 为立即到位）
+};
+
+/// <summary>
+/// 原来的锁定镜头（无死区、无前瞻、无平滑），用于基准对比。
+/// </summary>
+extern const CameraConfig g_CameraLocked;
+
+/// <summary>
+/// 游戏默认参数。
+/// </summary>
+extern const CameraConfig g_CameraDefault;
+
+struct Camera
+{
+    CameraConfig config;
+    s32 x;              // 左上角，24.8 定点
+    s32 y;
+    s32 goalX;          // 死区推动后的目标左上角，24.8 定点
+    s32 goalY;
+    s32 lookX;          // 当前前瞻偏移，24.8 定点
+    s32 lookY;
+    int maxX;           // 左上角上限（像素）
+    int maxY;
+};
+
+/// <summary>
+/// 初始化并直接对准 (focusX, focusY)。
+/// </summary>
+/// <param name="mapPixelW">地图像素宽</param>
+/// <param name="mapPixelH">地图像素高</param>
+void Camera_Init(Camera* camera, const CameraConfig* config, int mapPixelW, int mapPixelH, int focusX, int focusY);
+
+/// <summary>
+/// 每帧调用一次：焦点越出死区时推动目标，前瞻与位置向目标平滑靠近，并限制在地图内。
+/// </summary>
+/// <param name="velX">焦点本帧的水平移动（只看正负）</param>
+/// <param name="velY">焦点本帧的垂直移动（只看正负）</param>
+void Camera_Update(Camera* camera, int focusX, int focusY, int velX, int velY);
+
+/// <summary>
+/// 镜头左上角像素 X。
+/// </summary>
+static inline int Camera_X(const Camera* camera)
+{
+    return camera->x >> 8;
+}
+
+/// <summary>
+/// 镜头左上角像素 Y。
+/// </summary>
+static inline int Camera_Y(const Camera* camera)
+{
+    return camera->y >> 8;
+}
+
+/// <summary>
+/// 缓冲窗口应移动到的位置：可视范围（含未对齐时多露出的 1 列 / 行）仍在窗口内时保持不动，否则移动最少的列 / 行。
+/// </summary>
+/// <param name="camX">镜头左上角像素 X</param>
+/// <param name="camY">镜头左上角像素 Y</param>
+/// <param name="bufX">当前窗口左上角世界 8x8 tile X</param>
+/// <param name="bufY">当前窗口左上角世界 8x8 tile Y</param>
+/// <param name="wantBufX">输出：目标窗口 X</param>
+/// <param name="wantBufY">输出：目标窗口 Y</param>
+void Camera_BufferTarget(int camX, int camY, int bufX, int bufY, int* wantBufX, int* wantBufY);
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------
+名称：地图碰撞
+说明：基于 16x16 世界格子的障碍判断，供角色与 NPC 共用
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：约定 Objects（图层 2）与 Doors/windows/roof（图层 3）非 0 即为障碍，构建期合成为 g_WorldSolidBits 位图，
+      判断不经过区块缓存（NPC 与寻路会访问镜头附近以外的格子）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "../generated_assets.h"
+
+/// <summary>
+/// 判断 16x16 世界格子是否为障碍物。
+/// </summary>
+/// <param name="cellX16">16x16 格子 X</param>
+/// <param name="cellY16">16x16 格子 Y</param>
+/// <returns>为 true 表示不可穿越</returns>
+static inline bool IsSolidCell16(int cellX16, int cellY16)
+{
+    if(cellX16 < 0 || cellY16 < 0 || cellX16 >= g_MapWidth || cellY16 >= g_MapHeight) {
+        return true;
+    }
+
+    const u8 bits = g_WorldSolidBits[cellY16 * g_WorldSolidStride + (cellX16 >> 3)];
+    return ((bits >> (cellX16 & 7)) & 1) != 0;
+}
+
+/// <summary>
+/// 判断角色（玩家或 NPC）在指定像素坐标是否会与障碍物碰撞。
+/// </summary>
+/// <param name="px">角色中心像素 X</param>
+/// <param name="py">角色中心像素 Y</param>
+/// <returns>为 true 表示会碰撞，不能移动到该位置</returns>
+static inline bool IsActorBlocked(int px, int py)
+{
+    // 采用脚下碰撞盒（更贴近实际行走）
+    const int centerX = px;
+    const int centerY = py + 8;
+    const int halfW = 6;
+    const int halfH = 6;
+
+    const int x0 = centerX - halfW;
+    const int x1 = centerX + halfW;
+    const int y0 = centerY - halfH;
+    const int y1 = centerY + halfH;
+
+    if(IsSolidCell16(x0 / 16, y0 / 16)) return true;
+    if(IsSolidCell16(x1 / 16, y0 / 16)) return true;
+    if(IsSolidCell16(x0 / 16, y1 / 16)) return true;
+    if(IsSolidCell16(x1 / 16, y1 / 16)) return true;
+    return false;
+}
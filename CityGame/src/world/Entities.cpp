@@ -0,0 +1,679 @@
+/*------------------------------------------------------------------------
+名称：NPC 实体系统
+说明：SoA 实体存储、16x16 格子空间哈希、行人移动与 OAM 输出
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：空间哈希桶号取格子坐标低 4 位（16x16 桶），相邻格子永不同桶；桶内为双向链表，换格时 O(1) 维护
+      走路径 / 流场时逐格对准格子中心，每次只沿一个轴移动且不越过目标，因此始终在可通行格子之间直行
+------------------------------------------------------------------------*/
+
+#include "Entities.h"
+
+#include "Collision.h"
+#include "PathFind.h"
+#include "Profiler.h"
+#include "../graphics/ObjShadow.h"
+
+s32 g_EntityPosX[ENTITY_MAX];
+s32 g_EntityPosY[ENTITY_MAX];
+s16 g_EntityVelX[ENTITY_MAX];
+s16 g_EntityVelY[ENTITY_MAX];
+u8 g_EntityAnimTick[ENTITY_MAX];
+u8 g_EntityFlags[ENTITY_MAX];
+u8 g_EntitySprite[ENTITY_MAX];
+
+// 游走模式下为换方向倒计时；走路径 / 流场时为被挡住的剩余耐心
+static u8 g_EntityWalkTimer[ENTITY_MAX];
+
+/// <summary>
+/// 行人行为模式。
+/// </summary>
+enum EntityMode
+{
+    ENTITY_MODE_WANDER = 0,     // 随机游走
+    ENTITY_MODE_WAIT_PATH = 1,  // 已提交寻路请求，原地等待结果
+    ENTITY_MODE_ROUTE = 2,      // 沿 A* 路径逐格行走
+    ENTITY_MODE_GATHER = 3,     // 沿共享流场走向聚集点
+};
+
+/// <summary>
+/// 路径缓冲（对象池块）。
+/// </summary>
+struct EntityRoute
+{
+    u16 count;
+    u16 next;
+    u16 cells[ENTITY_ROUTE_CELLS];
+};
+
+static u8 g_EntityMode[ENTITY_MAX];
+static s8 g_EntityTicket[ENTITY_MAX];
+static EntityRoute* g_EntityRoute[ENTITY_MAX];
+// 当前要走到的格子（PATH_CELL 编码），到达格子中心后再取下一格
+static u16 g_EntityTarget[ENTITY_MAX];
+
+static MemPool g_EntityRoutePool;
+static bool g_EntityRouting = false;
+static int g_EntityGatherField = -1;
+static EntityRouteStats g_EntityRouteStats;
+
+// 空间哈希：实体当前登记的格子与桶内链表
+static s16 g_EntityCellX[ENTITY_MAX];
+static s16 g_EntityCellY[ENTITY_MAX];
+static u8 g_EntityGridNext[ENTITY_MAX];
+static u8 g_EntityGridPrev[ENTITY_MAX];
+static u8 g_EntityGridHead[256];
+
+// 存活实体的紧凑 id 列表（遍历用）与 id -> 列表位置
+static u8 g_EntityActive[ENTITY_MAX];
+static u8 g_EntityActiveIndex[ENTITY_MAX];
+static int g_EntityActiveCount = 0;
+
+// 空闲 id 栈
+static u8 g_EntityFreeIds[ENTITY_MAX];
+static int g_EntityFreeCount = 0;
+
+static u32 g_EntityRandom = 1;
+static u32 g_EntityFrame = 0;
+
+// 行人速度：0.5 像素/帧（8.8 定点）
+static const s16 g_WalkerSpeed = 0x80;
+
+// 走路动画：24 tick 一个周期，前 12 tick 为帧 0
+static const u8 g_WalkAnimPeriod = 24;
+
+// 屏幕外判定的外扩边距（像素）
+static const int g_OnscreenMargin = 32;
+
+// 走路径 / 流场时被挡住多少帧后放弃，回到游走
+static const u8 g_RoutePatience = 60;
+
+static inline int GridBucket(int cellX16, int cellY16)
+{
+    return (cellX16 & 15) | ((cellY16 & 15) << 4);
+}
+
+static inline u32 NextRandom()
+{
+    g_EntityRandom = g_EntityRandom * 1664525u + 1013904223u;
+    return g_EntityRandom >> 16;
+}
+
+/// <summary>
+/// 把实体挂到格子所在桶的链表头。
+/// </summary>
+static void GridInsert(int id, int cellX16, int cellY16)
+{
+    const int bucket = GridBucket(cellX16, cellY16);
+    const u8 head = g_EntityGridHead[bucket];
+
+    g_EntityCellX[id] = (s16)cellX16;
+    g_EntityCellY[id] = (s16)cellY16;
+    g_EntityGridPrev[id] = ENTITY_NONE;
+    g_EntityGridNext[id] = head;
+    if(head != ENTITY_NONE) {
+        g_EntityGridPrev[head] = (u8)id;
+    }
+    g_EntityGridHead[bucket] = (u8)id;
+}
+
+/// <summary>
+/// 把实体从当前登记的桶中摘下。
+/// </summary>
+static void GridRemove(int id)
+{
+    const u8 prev = g_EntityGridPrev[id];
+    const u8 next = g_EntityGridNext[id];
+    if(prev != ENTITY_NONE) {
+        g_EntityGridNext[prev] = next;
+    } else {
+        g_EntityGridHead[GridBucket(g_EntityCellX[id], g_EntityCellY[id])] = next;
+    }
+    if(next != ENTITY_NONE) {
+        g_EntityGridPrev[next] = prev;
+    }
+}
+
+/// <summary>
+/// 随机选择新方向（含停留），并设置持续帧数。
+/// </summary>
+static void PickDirection(int id)
+{
+    static const s8 dirX[5] = { 0, 1, -1, 0, 0 };
+    static const s8 dirY[5] = { 0, 0, 0, 1, -1 };
+
+    const u32 r = NextRandom();
+    const int dir = (int)((r * 5) >> 16);
+    g_EntityVelX[id] = (s16)(dirX[dir] * g_WalkerSpeed);
+    g_EntityVelY[id] = (s16)(dirY[dir] * g_WalkerSpeed);
+    g_EntityWalkTimer[id] = (u8)(32 + (r & 63));
+}
+
+/// <summary>
+/// 游走计时到期时决定下一段行为：约 1/16 发起短途寻路，约 1/32 走向聚集点，其余随机换方向。
+/// </summary>
+static void ChooseBehavior(int id)
+{
+    const u32 r = NextRandom();
+    const int cellX16 = g_EntityCellX[id];
+    const int cellY16 = g_EntityCellY[id];
+
+    if(g_EntityRouting && (r & 15) == 0) {
+        // 目标取周围 ±16 格内的随机可通行格子
+        const u32 g = NextRandom();
+        const int goalX16 = cellX16 + (int)(g & 31) - 16;
+        const int goalY16 = cellY16 + (int)((g >> 5) & 31) - 16;
+        EntityRoute* route = PathFind_IsWalkable(goalX16, goalY16) ? (EntityRoute*)MemPool_Alloc(&g_EntityRoutePool) : 0;
+        if(route != 0) {
+            const int ticket = PathFind_Request(cellX16, cellY16, goalX16, goalY16);
+            if(ticket >= 0) {
+                g_EntityRoute[id] = route;
+                g_EntityTicket[id] = (s8)ticket;
+                g_EntityMode[id] = ENTITY_MODE_WAIT_PATH;
+                g_EntityVelX[id] = 0;
+                g_EntityVelY[id] = 0;
+                g_EntityRouteStats.requests++;
+                return;
+            }
+            MemPool_Free(&g_EntityRoutePool, route);
+        }
+    }
+
+    if(((r >> 4) & 31) == 0 && PathFind_IsFlowFieldReady(g_EntityGatherField)) {
+        // 先回到所在格子中心，再按流场逐格前进
+        g_EntityTarget[id] = PATH_CELL(cellX16, cellY16);
+        g_EntityMode[id] = ENTITY_MODE_GATHER;
+        g_EntityWalkTimer[id] = g_RoutePatience;
+        g_EntityVelX[id] = 0;
+        g_EntityVelY[id] = 0;
+        g_EntityRouteStats.gathers++;
+        return;
+    }
+
+    PickDirection(id);
+}
+
+/// <summary>
+/// 归还实体占用的路径缓冲与寻路票据。
+/// </summary>
+static void ReleaseRoute(int id)
+{
+    if(g_EntityRoute[id] != 0) {
+        MemPool_Free(&g_EntityRoutePool, g_EntityRoute[id]);
+        g_EntityRoute[id] = 0;
+    }
+    if(g_EntityTicket[id] >= 0) {
+        PathFind_Release(g_EntityTicket[id]);
+        g_EntityTicket[id] = -1;
+    }
+}
+
+/// <summary>
+/// 结束路径 / 流场行走，回到游走。
+/// </summary>
+static void EndRoute(int id, bool arrived)
+{
+    ReleaseRoute(id);
+    if(arrived) {
+        g_EntityRouteStats.arrived++;
+    } else {
+        g_EntityRouteStats.abandoned++;
+    }
+    g_EntityMode[id] = ENTITY_MODE_WANDER;
+    PickDirection(id);
+}
+
+/// <summary>
+/// 到达当前目标格子中心后取下一格：路径取下一个格子，流场按所在格子的方向前进一格。
+/// </summary>
+/// <returns>为 false 表示已走到终点</returns>
+static bool NextTarget(int id)
+{
+    const int cellX16 = PATH_CELL_X(g_EntityTarget[id]);
+    const int cellY16 = PATH_CELL_Y(g_EntityTarget[id]);
+
+    if(g_EntityMode[id] == ENTITY_MODE_ROUTE) {
+        EntityRoute* route = g_EntityRoute[id];
+        if(++route->next >= route->count) {
+            return false;
+        }
+        g_EntityTarget[id] = route->cells[route->next];
+        return true;
+    }
+
+    switch(PathFind_FlowDir(g_EntityGatherField, cellX16, cellY16)) {
+    case PATH_DIR_RIGHT: g_EntityTarget[id] = PATH_CELL(cellX16 + 1, cellY16); return true;
+    case PATH_DIR_LEFT: g_EntityTarget[id] = PATH_CELL(cellX16 - 1, cellY16); return true;
+    case PATH_DIR_DOWN: g_EntityTarget[id] = PATH_CELL(cellX16, cellY16 + 1); return true;
+    case PATH_DIR_UP: g_EntityTarget[id] = PATH_CELL(cellX16, cellY16 - 1); return true;
+    default: return false;
+    }
+}
+
+/// <summary>
+/// 路径 / 流场模式的一次更新：等待寻路结果，或朝目标格子中心移动。
+/// </summary>
+/// <param name="outVx">输出本次位移 X（24.8，已限制不越过目标）</param>
+/// <param name="outVy">输出本次位移 Y</param>
+/// <returns>为 false 表示本次不移动</returns>
+static bool RouteStep(int id, int step, int* outVx, int* outVy)
+{
+    if(g_EntityMode[id] == ENTITY_MODE_WAIT_PATH) {
+        const int ticket = g_EntityTicket[id];
+        const PathStatus status = PathFind_Poll(ticket);
+        if(status == PATH_PENDING) {
+            return false;
+        }
+
+        EntityRoute* route = g_EntityRoute[id];
+        // TakePath 取出路径并释放票据；失败的票据需要单独释放
+        route->count = 0;
+        if(status == PATH_READY) {
+            route->count = (u16)PathFind_TakePath(ticket, route->cells, ENTITY_ROUTE_CELLS);
+        } else {
+            PathFind_Release(ticket);
+        }
+        route->next = 0;
+        g_EntityTicket[id] = -1;
+        if(route->count == 0) {
+            EndRoute(id, false);
+            return false;
+        }
+
+        // 路径第一格就是所在格子：先对准格子中心
+        g_EntityTarget[id] = route->cells[0];
+        g_EntityMode[id] = ENTITY_MODE_ROUTE;
+        g_EntityWalkTimer[id] = g_RoutePatience;
+    }
+
+    // 格子中心像素坐标（角色中心在格子中心上方 8 像素）
+    s32 targetX = ((PATH_CELL_X(g_EntityTarget[id]) << 4) + 8) << 8;
+    s32 targetY = (PATH_CELL_Y(g_EntityTarget[id]) << 4) << 8;
+    if(g_EntityPosX[id] == targetX && g_EntityPosY[id] == targetY) {
+        if(!NextTarget(id)) {
+            EndRoute(id, true);
+            return false;
+        }
+        targetX = ((PATH_CELL_X(g_EntityTarget[id]) << 4) + 8) << 8;
+        targetY = (PATH_CELL_Y(g_EntityTarget[id]) << 4) << 8;
+    }
+
+    // 先对齐 X 再对齐 Y，每次只沿一个轴移动，位移不超过剩余距离
+    const s32 maxMove = g_WalkerSpeed * step;
+    s32 dx = targetX - g_EntityPosX[id];
+    s32 dy = 0;
+    if(dx == 0) {
+        dy = targetY - g_EntityPosY[id];
+    }
+    if(dx > maxMove) dx = maxMove;
+    if(dx < -maxMove) dx = -maxMove;
+    if(dy > maxMove) dy = maxMove;
+    if(dy < -maxMove) dy = -maxMove;
+
+    // 速度只用于朝向与走路动画
+    g_EntityVelX[id] = (s16)(dx > 0 ? g_WalkerSpeed : (dx < 0 ? -g_WalkerSpeed : 0));
+    g_EntityVelY[id] = (s16)(dy > 0 ? g_WalkerSpeed : (dy < 0 ? -g_WalkerSpeed : 0));
+    *outVx = dx;
+    *outVy = dy;
+    return true;
+}
+
+bool Entities_Init(MemArena* arena)
+{
+    // 票据与流场由 PathFind_Init 统一作废，这里只丢弃引用
+    g_EntityRouting = false;
+    g_EntityGatherField = -1;
+    g_EntityRouteStats.requests = 0;
+    g_EntityRouteStats.gathers = 0;
+    g_EntityRouteStats.arrived = 0;
+    g_EntityRouteStats.abandoned = 0;
+    if(arena != 0) {
+        void* storage = MemArena_Alloc(arena, sizeof(EntityRoute) * ENTITY_ROUTE_SLOTS, 4);
+        if(storage != 0) {
+            MemPool_Init(&g_EntityRoutePool, "entity routes", storage, sizeof(EntityRoute), ENTITY_ROUTE_SLOTS);
+            g_EntityRouting = true;
+        }
+    }
+
+    for(int i = 0; i < 256; i++) {
+        g_EntityGridHead[i] = ENTITY_NONE;
+    }
+    for(int i = 0; i < ENTITY_MAX; i++) {
+        g_EntityFlags[i] = 0;
+        g_EntitySprite[i] = ENTITY_NONE;
+        g_EntityMode[i] = ENTITY_MODE_WANDER;
+        g_EntityTicket[i] = -1;
+        g_EntityRoute[i] = 0;
+        // 倒序入栈，先分配小 id
+        g_EntityFreeIds[i] = (u8)(ENTITY_MAX - 1 - i);
+    }
+    g_EntityFreeCount = ENTITY_MAX;
+    g_EntityActiveCount = 0;
+    g_EntityFrame = 0;
+    return g_EntityRouting;
+}
+
+bool Entities_SetGathering(int cellX16, int cellY16)
+{
+    PathFind_ReleaseFlowField(g_EntityGatherField);
+    g_EntityGatherField = -1;
+
+    // 由近到远逐圈查找可通行格子
+    for(int r = 0; r <= 8; r++) {
+        for(int dy = -r; dy <= r; dy++) {
+            for(int dx = -r; dx <= r; dx++) {
+                if((dx != -r && dx != r && dy != -r && dy != r) || !PathFind_IsWalkable(cellX16 + dx, cellY16 + dy)) {
+                    continue;
+                }
+                g_EntityGatherField = PathFind_AcquireFlowField(cellX16 + dx, cellY16 + dy);
+                return g_EntityGatherField >= 0;
+            }
+        }
+    }
+    return false;
+}
+
+const MemPool* Entities_RoutePool()
+{
+    return &g_EntityRoutePool;
+}
+
+void Entities_GetRouteStats(EntityRouteStats* out)
+{
+    *out = g_EntityRouteStats;
+}
+
+int Entities_Count()
+{
+    return g_EntityActiveCount;
+}
+
+int Entities_Spawn(int px, int py)
+{
+    if(g_EntityFreeCount == 0) {
+        return -1;
+    }
+
+    const int id = g_EntityFreeIds[--g_EntityFreeCount];
+
+    g_EntityPosX[id] = px << 8;
+    g_EntityPosY[id] = py << 8;
+    g_EntityVelX[id] = 0;
+    g_EntityVelY[id] = 0;
+    g_EntityAnimTick[id] = 0;
+    g_EntityFlags[id] = ENTITY_FLAG_ALIVE;
+    g_EntitySprite[id] = ENTITY_NONE;
+    g_EntityWalkTimer[id] = 0;
+    g_EntityMode[id] = ENTITY_MODE_WANDER;
+
+    g_EntityActiveIndex[id] = (u8)g_EntityActiveCount;
+    g_EntityActive[g_EntityActiveCount++] = (u8)id;
+
+    GridInsert(id, px >> 4, (py + 8) >> 4);
+    return id;
+}
+
+void Entities_Despawn(int id)
+{
+    if(id < 0 || id >= ENTITY_MAX || (g_EntityFlags[id] & ENTITY_FLAG_ALIVE) == 0) {
+        return;
+    }
+
+    GridRemove(id);
+    ReleaseRoute(id);
+    g_EntityMode[id] = ENTITY_MODE_WANDER;
+
+    // 用列表末尾的实体填补空位
+    const int index = g_EntityActiveIndex[id];
+    const u8 last = g_EntityActive[--g_EntityActiveCount];
+    g_EntityActive[index] = last;
+    g_EntityActiveIndex[last] = (u8)index;
+
+    g_EntityFlags[id] = 0;
+    g_EntitySprite[id] = ENTITY_NONE;
+    g_EntityFreeIds[g_EntityFreeCount++] = (u8)id;
+}
+
+int Entities_SpawnWalkers(int count, u32 seed)
+{
+    g_EntityRandom = seed | 1;
+
+    int spawned = 0;
+    for(int attempt = 0; attempt < count * 8 && spawned < count; attempt++) {
+        const int cellX16 = (int)((NextRandom() * (u32)g_MapWidth) >> 16);
+        const int cellY16 = (int)((NextRandom() * (u32)g_MapHeight) >> 16);
+
+        // 角色中心在格子中心上方 8 像素（脚下碰撞盒中心落在格子中心）
+        const int px = cellX16 * 16 + 8;
+        const int py = cellY16 * 16;
+        if(IsActorBlocked(px, py) || Entities_IsCellOccupied(cellX16, cellY16, -1)) {
+            continue;
+        }
+
+        const int id = Entities_Spawn(px, py);
+        if(id < 0) {
+            break;
+        }
+        PickDirection(id);
+        spawned++;
+    }
+    return spawned;
+}
+
+void Entities_Update(int camX, int camY, int playerX, int playerY)
+{
+    PROFILE_SCOPE("entities");
+
+    g_EntityFrame++;
+
+    const int playerCellX = playerX >> 4;
+    const int playerCellY = (playerY + 8) >> 4;
+
+    const int viewX0 = camX - g_OnscreenMargin;
+    const int viewY0 = camY - g_OnscreenMargin;
+    const int viewX1 = camX + 240 + g_OnscreenMargin;
+    const int viewY1 = camY + 160 + g_OnscreenMargin;
+
+    int updated = 0;
+
+    for(int i = 0; i < g_EntityActiveCount; i++) {
+        const int id = g_EntityActive[i];
+
+        const int px = g_EntityPosX[id] >> 8;
+        const int py = g_EntityPosY[id] >> 8;
+
+        const bool onscreen = (px >= viewX0 && px < viewX1 && py >= viewY0 && py < viewY1);
+        int step = 1;
+        if(onscreen) {
+            g_EntityFlags[id] |= ENTITY_FLAG_ONSCREEN;
+        } else {
+            g_EntityFlags[id] &= (u8)~ENTITY_FLAG_ONSCREEN;
+            // 屏幕外：按 id 错开，每 4 帧更新一次，步长放大 4 倍保持平均速度
+            if(((id + g_EntityFrame) & 3) != 0) {
+                continue;
+            }
+            step = 4;
+        }
+        updated++;
+
+        const bool routed = (g_EntityMode[id] != ENTITY_MODE_WANDER);
+        int vx = 0;
+        int vy = 0;
+        if(routed) {
+            if(!RouteStep(id, step, &vx, &vy)) {
+                continue;
+            }
+        } else {
+            if(g_EntityWalkTimer[id] <= step) {
+                ChooseBehavior(id);
+            } else {
+                g_EntityWalkTimer[id] = (u8)(g_EntityWalkTimer[id] - step);
+            }
+            vx = g_EntityVelX[id] * step;
+            vy = g_EntityVelY[id] * step;
+        }
+        if(vx == 0 && vy == 0) {
+            continue;
+        }
+
+        const s32 nextX = g_EntityPosX[id] + vx;
+        const s32 nextY = g_EntityPosY[id] + vy;
+        const int npx = nextX >> 8;
+        const int npy = nextY >> 8;
+        const int cellX16 = npx >> 4;
+        const int cellY16 = (npy + 8) >> 4;
+
+        bool blocked = false;
+        if(npx != px || npy != py) {
+            blocked = IsActorBlocked(npx, npy);
+        }
+        const bool cellChanged = (cellX16 != g_EntityCellX[id] || cellY16 != g_EntityCellY[id]);
+        if(!blocked && cellChanged) {
+            blocked = (cellX16 == playerCellX && cellY16 == playerCellY) || Entities_IsCellOccupied(cellX16, cellY16, id);
+        }
+
+        if(blocked) {
+            if(!routed) {
+                PickDirection(id);
+            } else if(g_EntityWalkTimer[id] <= step) {
+                EndRoute(id, false);
+            } else {
+                // 原地等待对方让开
+                g_EntityWalkTimer[id] = (u8)(g_EntityWalkTimer[id] - step);
+                g_EntityVelX[id] = 0;
+                g_EntityVelY[id] = 0;
+            }
+            continue;
+        }
+
+        g_EntityPosX[id] = nextX;
+        g_EntityPosY[id] = nextY;
+        if(routed) {
+            g_EntityWalkTimer[id] = g_RoutePatience;
+        }
+
+        if(cellChanged) {
+            GridRemove(id);
+            GridInsert(id, cellX16, cellY16);
+        }
+
+        if(vx < 0) {
+            g_EntityFlags[id] |= ENTITY_FLAG_FACE_LEFT;
+        } else if(vx > 0) {
+            g_EntityFlags[id] &= (u8)~ENTITY_FLAG_FACE_LEFT;
+        }
+
+        int tick = g_EntityAnimTick[id] + step;
+        if(tick >= g_WalkAnimPeriod) {
+            tick -= g_WalkAnimPeriod;
+        }
+        g_EntityAnimTick[id] = (u8)tick;
+    }
+
+    PROFILE_COUNT("entity updates", updated);
+}
+
+/// <summary>
+/// 把一个实体写入影子 OAM 槽位。
+/// </summary>
+static inline void WriteSprite(int slot, int id, int sx, int sy, u16 frame0TileId, u16 frame1TileId)
+{
+    const bool moving = (g_EntityVelX[id] != 0 || g_EntityVelY[id] != 0);
+    const u16 tileId = (moving && g_EntityAnimTick[id] >= g_WalkAnimPeriod / 2) ? frame1TileId : frame0TileId;
+    const u16 hflip = (g_EntityFlags[id] & ENTITY_FLAG_FACE_LEFT) ? 0x1000 : 0;
+
+    // 与玩家相同：256 色、32x32、优先级 0（槽位越小越靠前，玩家固定占 0 号）
+    g_ShadowOam[slot].attr0 = (u16)((sy & 0xFF) | 0x2000);
+    g_ShadowOam[slot].attr1 = (u16)((sx & 0x1FF) | 0x8000 | hflip);
+    g_ShadowOam[slot].attr2 = (u16)(tileId & 0x03FF);
+    g_EntitySprite[id] = (u8)slot;
+}
+
+int Entities_WriteOam(int firstSlot, int camX, int camY, u16 frame0TileId, u16 frame1TileId, MemArena* scratch)
+{
+    PROFILE_SCOPE("entity oam");
+
+    int slot = firstSlot;
+
+    // 排序键：((159 - sy) << 7) | id（sy 为 -31..159），升序即屏幕纵坐标从下到上；只在本帧使用，取自临时 Arena
+    u16* keys = 0;
+    if(scratch != 0 && g_EntityActiveCount > 0) {
+        keys = (u16*)MemArena_Alloc(scratch, (u32)g_EntityActiveCount * sizeof(u16), 4);
+    }
+    int keyCount = 0;
+
+    for(int i = 0; i < g_EntityActiveCount; i++) {
+        const int id = g_EntityActive[i];
+
+        const int sx = (g_EntityPosX[id] >> 8) - camX - 16;
+        const int sy = (g_EntityPosY[id] >> 8) - camY - 16;
+        g_EntitySprite[id] = ENTITY_NONE;
+        if(sx <= -32 || sx >= 240 || sy <= -32 || sy >= 160) {
+            continue;
+        }
+
+        if(keys == 0) {
+            if(slot < 128) {
+                WriteSprite(slot++, id, sx, sy, frame0TileId, frame1TileId);
+            }
+            continue;
+        }
+
+        // 屏幕内通常只有几十个，插入排序即可
+        const u16 key = (u16)(((159 - sy) << 7) | id);
+        int k = keyCount++;
+        while(k > 0 && keys[k - 1] > key) {
+            keys[k] = keys[k - 1];
+            k--;
+        }
+        keys[k] = key;
+    }
+
+    for(int k = 0; k < keyCount && slot < 128; k++) {
+        const int id = keys[k] & 0x7F;
+        const int sx = (g_EntityPosX[id] >> 8) - camX - 16;
+        const int sy = (g_EntityPosY[id] >> 8) - camY - 16;
+        WriteSprite(slot++, id, sx, sy, frame0TileId, frame1TileId);
+    }
+
+    return slot;
+}
+
+int Entities_QueryCell(int cellX16, int cellY16, u8* outIds, int maxIds)
+{
+    int found = 0;
+    for(u8 id = g_EntityGridHead[GridBucket(cellX16, cellY16)]; id != ENTITY_NONE; id = g_EntityGridNext[id]) {
+        if(g_EntityCellX[id] == cellX16 && g_EntityCellY[id] == cellY16) {
+            if(found >= maxIds) {
+                break;
+            }
+            outIds[found++] = id;
+        }
+    }
+    return found;
+}
+
+int Entities_QueryNeighbors(int cellX16, int cellY16, int radius, u8* outIds, int maxIds)
+{
+    int found = 0;
+    for(int cy = cellY16 - radius; cy <= cellY16 + radius; cy++) {
+        for(int cx = cellX16 - radius; cx <= cellX16 + radius; cx++) {
+            found += Entities_QueryCell(cx, cy, outIds + found, maxIds - found);
+            if(found >= maxIds) {
+                return found;
+            }
+        }
+    }
+    return found;
+}
+
+bool Entities_IsCellOccupied(int cellX16, int cellY16, int ignoreId)
+{
+    for(u8 id = g_EntityGridHead[GridBucket(cellX16, cellY16)]; id != ENTITY_NONE; id = g_EntityGridNext[id]) {
+        if(id != ignoreId && g_EntityCellX[id] == cellX16 && g_EntityCellY[id] == cellY16) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,134 @@
+/*------------------------------------------------------------------------
+名称：NPC 实体系统
+说明：结构数组（SoA）存放位置/速度/动画/精灵槽，按 16x16 格子做空间哈希，用于邻居与碰撞查询
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：设计容量 128；屏幕外实体每 4 帧更新一次（步长 x4）；数据全部在 IWRAM
+      行人游走间隙随机发起短途寻路（A* 票据）或沿共享流场走向聚集点；路径缓冲来自对象池（地图 Arena）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "Arena.h"
+
+#define ENTITY_MAX 128
+#define ENTITY_NONE 0xFF
+
+// 实体状态位
+#define ENTITY_FLAG_ALIVE 0x01
+#define ENTITY_FLAG_FACE_LEFT 0x02
+#define ENTITY_FLAG_ONSCREEN 0x04
+
+// 路径缓冲：同时走路径的行人数与每条路径保留的格子数（更长的路径截断，走到截断处再回到游走）
+#define ENTITY_ROUTE_SLOTS 24
+#define ENTITY_ROUTE_CELLS 48
+
+// 实体系统逐帧 CPU 预算（周期，约 10% 帧时间），基准测试按 100 个行人统计是否超出
+#define ENTITY_BUDGET_CYCLES_PER_FRAME 28000
+
+// SoA 存储（按实体 id 索引）；位置与速度为 24.8 / 8.8 定点像素
+extern s32 g_EntityPosX[ENTITY_MAX];
+extern s32 g_EntityPosY[ENTITY_MAX];
+extern s16 g_EntityVelX[ENTITY_MAX];
+extern s16 g_EntityVelY[ENTITY_MAX];
+extern u8 g_EntityAnimTick[ENTITY_MAX];
+extern u8 g_EntityFlags[ENTITY_MAX];
+extern u8 g_EntitySprite[ENTITY_MAX];
+
+/// <summary>
+/// 寻路行为统计（自 Entities_Init 起累计）。
+/// </summary>
+struct EntityRouteStats
+{
+    u32 requests;   // 提交的寻路请求
+    u32 gathers;    // 开始沿流场走向聚集点
+    u32 arrived;    // 走完路径或到达聚集点
+    u32 abandoned;  // 寻路失败或被挡住超时后放弃
+};
+
+/// <summary>
+/// 清空全部实体与空间哈希，并从 arena 分配路径缓冲对象池（需在 PathFind_Init 之后调用）。
+/// </summary>
+/// <param name="arena">路径缓冲所在 Arena；为 0 时不分配，行人只随机游走</param>
+/// <returns>为 false 表示路径缓冲不可用（行人只随机游走）</returns>
+bool Entities_Init(MemArena* arena);
+
+/// <summary>
+/// 设置聚集点：释放旧流场，在目标附近 8 格内找可通行格子并申请共享流场。
+/// </summary>
+/// <returns>为 false 表示附近没有可通行格子或流场已满（行人不再聚集）</returns>
+bool Entities_SetGathering(int cellX16, int cellY16);
+
+/// <summary>
+/// 路径缓冲对象池（用于占用报告；Entities_Init 返回 true 后有效）。
+/// </summary>
+const MemPool* Entities_RoutePool();
+
+void Entities_GetRouteStats(EntityRouteStats* out);
+
+/// <summary>
+/// 当前存活实体数量。
+/// </summary>
+int Entities_Count();
+
+/// <summary>
+/// 在像素坐标处生成一个静止实体。
+/// </summary>
+/// <returns>实体 id；已满时返回 -1</returns>
+int Entities_Spawn(int px, int py);
+
+/// <summary>
+/// 移除实体。
+/// </summary>
+void Entities_Despawn(int id);
+
+/// <summary>
+/// 在地图上随机可通行的格子生成行人（同一格子不重复）。
+/// </summary>
+/// <param name="count">数量</param>
+/// <param name="seed">随机种子</param>
+/// <returns>实际生成数量</returns>
+int Entities_SpawnWalkers(int count, u32 seed);
+
+/// <summary>
+/// 更新全部实体：游走或沿路径 / 流场行走、地图与实体间碰撞、空间哈希维护。
+/// </summary>
+/// <param name="camX">相机像素 X</param>
+/// <param name="camY">相机像素 Y</param>
+/// <param name="playerX">玩家中心像素 X（NPC 不会走进玩家所在格子）</param>
+/// <param name="playerY">玩家中心像素 Y</param>
+void Entities_Update(int camX, int camY, int playerX, int playerY);
+
+/// <summary>
+/// 把屏幕内的实体按纵坐标从下到上写入影子 OAM（靠下的 NPC 槽位小、画在前面）。
+/// </summary>
+/// <param name="firstSlot">起始 OAM 槽位</param>
+/// <param name="camX">相机像素 X</param>
+/// <param name="camY">相机像素 Y</param>
+/// <param name="frame0TileId">走路帧 0 的 OBJ tile id</param>
+/// <param name="frame1TileId">走路帧 1 的 OBJ tile id</param>
+/// <param name="scratch">排序键所在的临时 Arena（通常为 g_FrameArena）；为 0 或空间不足时按存活列表顺序写入</param>
+/// <returns>下一个可用槽位</returns>
+int Entities_WriteOam(int firstSlot, int camX, int camY, u16 frame0TileId, u16 frame1TileId, MemArena* scratch);
+
+/// <summary>
+/// 查询某个 16x16 格子内的实体。
+/// </summary>
+/// <param name="outIds">输出 id 数组</param>
+/// <param name="maxIds">输出上限</param>
+/// <returns>找到的数量</returns>
+int Entities_QueryCell(int cellX16, int cellY16, u8* outIds, int maxIds);
+
+/// <summary>
+/// 查询以某格子为中心、半径 radius 格的方形范围内的实体。
+/// </summary>
+int Entities_QueryNeighbors(int cellX16, int cellY16, int radius, u8* outIds, int maxIds);
+
+/// <summary>
+/// 判断格子是否被其它实体占据。
+/// </summary>
+/// <param name="ignoreId">忽略的实体 id（-1 表示不忽略）</param>
+bool Entities_IsCellOccupied(int cellX16, int cellY16, int ignoreId);
@@ -0,0 +1,261 @@
+/*------------------------------------------------------------------------
+名称：图层流式更新
+说明：按占用区间写入 / 清除 64x32 环形 BG map 的列与行
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：区间在构建期按 16x16 格子生成，这里展开为 8x8 tile 区间并裁剪到缓冲窗口；
+      窗口最多跨 33 个格子，一条线上的区间不超过 17 个。
+      元 tile 序号从区块缓存读取，沿一条线只在跨过区块边界时重新取区块，每读一个元 tile 写两个 8x8 条目；
+      旧位置的清除只看区间，不访问区块
+------------------------------------------------------------------------*/
+
+#include "LayerStream.h"
+
+#include "MemOps.h"
+#include "Profiler.h"
+#include "WorldChunks.h"
+#include "../generated_assets.h"
+
+#define LAYERSTREAM_MAX_SPANS 20
+
+// 8x8 tile 区间 [start, end)
+struct LayerSpan
+{
+    s16 start;
+    s16 end;
+};
+
+static LayerStreamStats g_LayerStreamStats = { 0, 0, 0 };
+
+// 沿一条线读取格子时缓存当前区块
+struct ChunkCursor
+{
+    int layerIndex;
+    int chunkX;
+    int chunkY;
+    const u16* cells;
+};
+
+static inline void ChunkCursor_Init(ChunkCursor* cursor, int layerIndex)
+{
+    cursor->layerIndex = layerIndex;
+    cursor->chunkX = -1;
+    cursor->chunkY = -1;
+    cursor->cells = 0;
+}
+
+/// <summary>
+/// 格子 (cellX, cellY) 的元 tile 的 4 个屏幕条目（左上、右上、左下、右下）。
+/// </summary>
+static inline const u16* ChunkCursor_Metatile(ChunkCursor* cursor, int cellX, int cellY)
+{
+    const int chunkX = cellX >> WORLD_CHUNK_SHIFT;
+    const int chunkY = cellY >> WORLD_CHUNK_SHIFT;
+    if(chunkX != cursor->chunkX || chunkY != cursor->chunkY) {
+        cursor->cells = WorldChunks_Get(cursor->layerIndex, chunkX, chunkY);
+        cursor->chunkX = chunkX;
+        cursor->chunkY = chunkY;
+    }
+    const int mask = WORLD_CHUNK_CELLS - 1;
+    return g_Metatiles + (cursor->cells[((cellY & mask) << WORLD_CHUNK_SHIFT) | (cellX & mask)] << 2);
+}
+
+static inline void WriteBgMapEntry(volatile u16* base, int vramX, int vramY, u16 tileId)
+{
+    // 64x32：由两个 32x32 screenblock 组成（左右各一个）
+    const int block = (vramX >= 32) ? 1 : 0;
+    const int x = vramX & 31;
+    base[block * 1024 + vramY * 32 + x] = tileId;
+}
+
+/// <summary>
+/// 取出第 line 条线的占用区间，展开为 8x8 tile 区间并裁剪到 [lo, hi)。
+/// </summary>
+/// <returns>区间数</returns>
+static int CollectSpans(const unsigned short* index, const unsigned short* runs, int line, int lo, int hi, LayerSpan* out)
+{
+    const unsigned short* run = runs + index[line] * 2;
+    const unsigned short* end = runs + index[line + 1] * 2;
+    int count = 0;
+    for(; run < end; run += 2) {
+        int start = run[0] * 2;
+        int stop = run[1] * 2;
+        if(stop <= lo) {
+            continue;
+        }
+        if(start >= hi) {
+            break;
+        }
+        if(start < lo) start = lo;
+        if(stop > hi) stop = hi;
+        out[count].start = (s16)start;
+        out[count].end = (s16)stop;
+        count++;
+    }
+    return count;
+}
+
+/// <summary>
+/// a 中未被 b 覆盖的部分（两者均为升序不相交区间）。
+/// </summary>
+/// <returns>区间数（不超过 na + nb）</returns>
+static int SubtractSpans(const LayerSpan* a, int na, const LayerSpan* b, int nb, LayerSpan* out)
+{
+    int count = 0;
+    int j = 0;
+    for(int i = 0; i < na; i++) {
+        int start = a[i].start;
+        const int stop = a[i].end;
+        while(j < nb && b[j].end <= start) {
+            j++;
+        }
+        for(int k = j; start < stop; k++) {
+            if(k >= nb || b[k].start >= stop) {
+                out[count].start = (s16)start;
+                out[count].end = (s16)stop;
+                count++;
+                break;
+            }
+            if(b[k].start > start) {
+                out[count].start = (s16)start;
+                out[count].end = b[k].start;
+                count++;
+            }
+            start = b[k].end;
+        }
+    }
+    return count;
+}
+
+static int SpanLength(const LayerSpan* spans, int count)
+{
+    int total = 0;
+    for(int i = 0; i < count; i++) {
+        total += spans[i].end - spans[i].start;
+    }
+    return total;
+}
+
+/// <summary>
+/// 写入世界行 worldY 在 spans 内的 tile。
+/// </summary>
+static void WriteRowSpans(volatile u16* bgMap, int layerIndex, int worldY, const LayerSpan* spans, int count)
+{
+    ChunkCursor cursor;
+    ChunkCursor_Init(&cursor, layerIndex);
+    const int cellY = worldY >> 1;
+    const int qy = (worldY & 1) << 1;
+    const int vramY = worldY & 31;
+    for(int i = 0; i < count; i++) {
+        const int end = spans[i].end;
+        int tx = spans[i].start;
+        // 区间起点在格子右半时先写单个条目，之后每读一个元 tile 写左右两个
+        if(tx & 1) {
+            WriteBgMapEntry(bgMap, tx & 63, vramY, ChunkCursor_Metatile(&cursor, tx >> 1, cellY)[qy + 1]);
+            tx++;
+        }
+        for(; tx < end; tx += 2) {
+            const u16* entries = ChunkCursor_Metatile(&cursor, tx >> 1, cellY) + qy;
+            WriteBgMapEntry(bgMap, tx & 63, vramY, entries[0]);
+            if(tx + 1 < end) {
+                WriteBgMapEntry(bgMap, (tx + 1) & 63, vramY, entries[1]);
+            }
+        }
+    }
+}
+
+void LayerStream_Fill(volatile u16* bgMap, int layerIndex, int bufX, int bufY)
+{
+    VramFill((void*)bgMap, 0, 64 * 32 * 2);
+
+    const int lineBase = layerIndex * (g_MapHeight + 1);
+    LayerSpan spans[LAYERSTREAM_MAX_SPANS];
+    int written = 0;
+    for(int worldY = bufY; worldY < bufY + 32; worldY++) {
+        const int count = CollectSpans(g_LayerRowRunIndex, g_LayerRowRuns, lineBase + (worldY >> 1), bufX, bufX + 64, spans);
+        WriteRowSpans(bgMap, layerIndex, worldY, spans, count);
+        written += SpanLength(spans, count);
+    }
+
+    g_LayerStreamStats.written += (u32)written;
+    g_LayerStreamStats.skipped += (u32)(64 * 32 - written);
+}
+
+void LayerStream_Column(volatile u16* bgMap, int layerIndex, int bufY, int worldX, int oldWorldX)
+{
+    PROFILE_SCOPE("layer column");
+    const int lineBase = layerIndex * (g_MapWidth + 1);
+    LayerSpan spans[LAYERSTREAM_MAX_SPANS];
+    LayerSpan old[LAYERSTREAM_MAX_SPANS];
+    LayerSpan stale[LAYERSTREAM_MAX_SPANS * 2];
+    const int count = CollectSpans(g_LayerColRunIndex, g_LayerColRuns, lineBase + (worldX >> 1), bufY, bufY + 32, spans);
+    const int oldCount = CollectSpans(g_LayerColRunIndex, g_LayerColRuns, lineBase + (oldWorldX >> 1), bufY, bufY + 32, old);
+    const int staleCount = SubtractSpans(old, oldCount, spans, count, stale);
+
+    ChunkCursor cursor;
+    ChunkCursor_Init(&cursor, layerIndex);
+    const int cellX = worldX >> 1;
+    const int qx = worldX & 1;
+    const int vramX = worldX & 63;
+    for(int i = 0; i < count; i++) {
+        const int end = spans[i].end;
+        int ty = spans[i].start;
+        // 区间起点在格子下半时先写单个条目，之后每读一个元 tile 写上下两个
+        if(ty & 1) {
+            WriteBgMapEntry(bgMap, vramX, ty & 31, ChunkCursor_Metatile(&cursor, cellX, ty >> 1)[qx + 2]);
+            ty++;
+        }
+        for(; ty < end; ty += 2) {
+            const u16* entries = ChunkCursor_Metatile(&cursor, cellX, ty >> 1) + qx;
+            WriteBgMapEntry(bgMap, vramX, ty & 31, entries[0]);
+            if(ty + 1 < end) {
+                WriteBgMapEntry(bgMap, vramX, (ty + 1) & 31, entries[2]);
+            }
+        }
+    }
+    for(int i = 0; i < staleCount; i++) {
+        for(int ty = stale[i].start; ty < stale[i].end; ty++) {
+            WriteBgMapEntry(bgMap, vramX, ty & 31, 0);
+        }
+    }
+
+    const int written = SpanLength(spans, count);
+    const int cleared = SpanLength(stale, staleCount);
+    g_LayerStreamStats.written += (u32)written;
+    g_LayerStreamStats.cleared += (u32)cleared;
+    g_LayerStreamStats.skipped += (u32)(32 - written - cleared);
+    PROFILE_COUNT("layer skip", 32 - written - cleared);
+}
+
+void LayerStream_Row(volatile u16* bgMap, int layerIndex, int bufX, int worldY, int oldWorldY)
+{
+    PROFILE_SCOPE("layer row");
+    const int lineBase = layerIndex * (g_MapHeight + 1);
+    LayerSpan spans[LAYERSTREAM_MAX_SPANS];
+    LayerSpan old[LAYERSTREAM_MAX_SPANS];
+    LayerSpan stale[LAYERSTREAM_MAX_SPANS * 2];
+    const int count = CollectSpans(g_LayerRowRunIndex, g_LayerRowRuns, lineBase + (worldY >> 1), bufX, bufX + 64, spans);
+    const int oldCount = CollectSpans(g_LayerRowRunIndex, g_LayerRowRuns, lineBase + (oldWorldY >> 1), bufX, bufX + 64, old);
+    const int staleCount = SubtractSpans(old, oldCount, spans, count, stale);
+
+    WriteRowSpans(bgMap, layerIndex, worldY, spans, count);
+    const int vramY = worldY & 31;
+    for(int i = 0; i < staleCount; i++) {
+        for(int tx = stale[i].start; tx < stale[i].end; tx++) {
+            WriteBgMapEntry(bgMap, tx & 63, vramY, 0);
+        }
+    }
+
+    const int written = SpanLength(spans, count);
+    const int cleared = SpanLength(stale, staleCount);
+    g_LayerStreamStats.written += (u32)written;
+    g_LayerStreamStats.cleared += (u32)cleared;
+    g_LayerStreamStats.skipped += (u32)(64 - written - cleared);
+    PROFILE_COUNT("layer skip", 64 - written - cleared);
+}
+
+const LayerStreamStats* LayerStream_GetStats()
+{
+    return &g_LayerStreamStats;
+}
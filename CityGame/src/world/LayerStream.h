@@ -0,0 +1,51 @@
+/*------------------------------------------------------------------------
+名称：图层流式更新
+说明：把 4 个 TMX 图层写入 64x32 环形 BG map：初次整体填充，滚动时逐列 / 逐行增量更新
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：按构建期生成的占用区间（每行 / 每列非空格子的 [start, end)）只写非空部分；
+      滚入列 / 行所在的 VRAM 位置之前保存的是相隔 64 列 / 32 行的世界位置，只清除其中新内容未覆盖的非空区间
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 累计写入统计（条目数）。
+/// </summary>
+struct LayerStreamStats
+{
+    u32 written;    // 写入非空 tile
+    u32 cleared;    // 清除旧的非空 tile
+    u32 skipped;    // 新旧都为空，未写
+};
+
+/// <summary>
+/// 写入整个缓冲窗口：先整体清零（VramFill），再写各行的非空区间。
+/// </summary>
+/// <param name="bgMap">64x32 BG map（两个相邻 screenblock）</param>
+/// <param name="layerIndex">图层 0~3</param>
+/// <param name="bufX">窗口左上角世界 8x8 tile X</param>
+/// <param name="bufY">窗口左上角世界 8x8 tile Y</param>
+void LayerStream_Fill(volatile u16* bgMap, int layerIndex, int bufX, int bufY);
+
+/// <summary>
+/// 滚入一列（窗口行范围为 [bufY, bufY + 32)）。
+/// </summary>
+/// <param name="worldX">新列的世界 8x8 tile X</param>
+/// <param name="oldWorldX">该 VRAM 列之前保存的世界列（worldX -/+ 64）</param>
+void LayerStream_Column(volatile u16* bgMap, int layerIndex, int bufY, int worldX, int oldWorldX);
+
+/// <summary>
+/// 滚入一行（窗口列范围为 [bufX, bufX + 64)）。
+/// </summary>
+/// <param name="worldY">新行的世界 8x8 tile Y</param>
+/// <param name="oldWorldY">该 VRAM 行之前保存的世界行（worldY -/+ 32）</param>
+void LayerStream_Row(volatile u16* bgMap, int layerIndex, int bufX, int worldY, int oldWorldY);
+
+/// <summary>
+/// 累计统计（自启动以来）。
+/// </summary>
+const LayerStreamStats* LayerStream_GetStats();
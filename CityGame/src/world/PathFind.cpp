@@ -0,0 +1,785 @@
+/*------------------------------------------------------------------------
+名称：网格寻路服务
+说明：分时 A*、BFS 流场与按目标共享的路径缓存
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：网格四周加一圈障碍、行宽取 2 的幂：邻居无需越界判断，格子坐标用移位/掩码取得（GBA 没有硬件除法）
+------------------------------------------------------------------------*/
+
+#include "PathFind.h"
+
+#include "Collision.h"
+#include "DebugLog.h"
+#include "Profiler.h"
+
+#include <string.h>
+
+// 父方向字节的最高位：已关闭（已从开放列表取出）
+#define PATH_CLOSED 0x80
+// 流场中目标格子的内部标记
+#define PATH_FLOW_GOAL 4
+
+enum FlowState
+{
+    FLOW_FREE = 0,
+    FLOW_QUEUED = 1,
+    FLOW_BUILDING = 2,
+    FLOW_READY = 3,
+};
+
+struct PathRequest
+{
+    u8 status;       // PathStatus
+    s8 entry;        // PATH_READY 时引用的缓存条目
+    u16 offset;      // 起点在缓存路径中的位置（复用别人路径的后半段）
+    u16 start;       // 内部格子序号
+    u16 goal;
+    u16 order;       // 提交顺序（先来先算）
+};
+
+struct PathCacheEntry
+{
+    u16 goal;
+    u16 length;      // 0 表示空条目
+    u32 lastUse;
+    u8 refs;         // 引用它的 PATH_READY 票据数，非 0 时不可淘汰
+};
+
+struct FlowField
+{
+    u16 goal;
+    u8 state;
+    u8 refs;
+    u8* dir;
+};
+
+static bool g_PathReady = false;
+
+// 加边框后的网格
+static int g_PathShift = 0;
+static int g_PathStride = 0;
+static int g_PathCellCount = 0;
+static s16 g_PathOffset[4];
+static u8* g_PathWalk = 0;
+// 连通区域编号（0 为障碍）：不同区域之间直接判定不可达，免去整区搜索
+static u16* g_PathRegion = 0;
+
+// A* 工作区（同一时刻只有一个搜索）
+static u16* g_PathStamp = 0;
+static u16* g_PathG = 0;
+static u8* g_PathParent = 0;
+static u32* g_PathHeap = 0;
+static int g_PathHeapCount = 0;
+static u16 g_PathSearchStamp = 0;
+static int g_PathSearchTicket = -1;
+
+static PathRequest g_PathRequests[PATH_MAX_REQUESTS];
+static u16 g_PathOrder = 0;
+
+static PathCacheEntry g_PathCache[PATH_CACHE_SIZE];
+static u16* g_PathCacheCells = 0;
+static u32 g_PathUseClock = 0;
+
+// 流场（同一时刻只构建一个，BFS 队列共享）
+static FlowField g_PathFlow[PATH_MAX_FLOWFIELDS];
+static u16* g_PathQueue = 0;
+static int g_PathQueueHead = 0;
+static int g_PathQueueTail = 0;
+static int g_PathFlowBuilding = -1;
+
+static PathStats g_PathStats;
+
+static inline int CellX(int cell)
+{
+    return cell & (g_PathStride - 1);
+}
+
+static inline int CellY(int cell)
+{
+    return cell >> g_PathShift;
+}
+
+static inline int ToCell(int cellX16, int cellY16)
+{
+    return ((cellY16 + 1) << g_PathShift) + cellX16 + 1;
+}
+
+static inline u16 ToPublicCell(int cell)
+{
+    return PATH_CELL(CellX(cell) - 1, CellY(cell) - 1);
+}
+
+static inline int Distance(int cellA, int cellB)
+{
+    int dx = CellX(cellA) - CellX(cellB);
+    int dy = CellY(cellA) - CellY(cellB);
+    if(dx < 0) dx = -dx;
+    if(dy < 0) dy = -dy;
+    return dx + dy;
+}
+
+static inline bool InMap(int cellX16, int cellY16)
+{
+    return cellX16 >= 0 && cellY16 >= 0 && cellX16 < g_MapWidth && cellY16 < g_MapHeight;
+}
+
+static inline u16* CacheCells(int entry)
+{
+    return g_PathCacheCells + entry * PATH_MAX_LEN;
+}
+
+/// <summary>
+/// 从地图图层重建可通行网格（边框与行尾填充格子均为障碍）。
+/// </summary>
+static void BuildWalkGrid()
+{
+    memset(g_PathWalk, 0, (u32)g_PathCellCount);
+    for(int y = 0; y < g_MapHeight; y++) {
+        u8* row = g_PathWalk + ToCell(0, y);
+        for(int x = 0; x < g_MapWidth; x++) {
+            row[x] = IsSolidCell16(x, y) ? 0 : 1;
+        }
+    }
+
+    // 逐个未编号的可通行格子做洪水填充（借用流场的 BFS 队列）
+    memset(g_PathRegion, 0, (u32)g_PathCellCount * sizeof(u16));
+    u16 region = 0;
+    for(int cell = 0; cell < g_PathCellCount; cell++) {
+        if(!g_PathWalk[cell] || g_PathRegion[cell] != 0) {
+            continue;
+        }
+        region++;
+        int head = 0;
+        int tail = 0;
+        g_PathRegion[cell] = region;
+        g_PathQueue[tail++] = (u16)cell;
+        while(head < tail) {
+            const int current = g_PathQueue[head++];
+            for(int d = 0; d < 4; d++) {
+                const int next = current + g_PathOffset[d];
+                if(g_PathWalk[next] && g_PathRegion[next] == 0) {
+                    g_PathRegion[next] = region;
+                    g_PathQueue[tail++] = (u16)next;
+                }
+            }
+        }
+    }
+}
+
+static inline bool Connected(int cellA, int cellB)
+{
+    return g_PathRegion[cellA] != 0 && g_PathRegion[cellA] == g_PathRegion[cellB];
+}
+
+// ---------------------------------------------------------------- 开放列表（二叉小顶堆，键 = f << 16 | 格子）
+
+static inline void HeapPush(u32 key)
+{
+    int i = g_PathHeapCount++;
+    while(i > 0) {
+        const int parent = (i - 1) >> 1;
+        if(g_PathHeap[parent] <= key) {
+            break;
+        }
+        g_PathHeap[i] = g_PathHeap[parent];
+        i = parent;
+    }
+    g_PathHeap[i] = key;
+}
+
+static inline u32 HeapPop()
+{
+    const u32 top = g_PathHeap[0];
+    const u32 last = g_PathHeap[--g_PathHeapCount];
+    const int count = g_PathHeapCount;
+
+    int i = 0;
+    for(;;) {
+        int child = i * 2 + 1;
+        if(child >= count) {
+            break;
+        }
+        if(child + 1 < count && g_PathHeap[child + 1] < g_PathHeap[child]) {
+            child++;
+        }
+        if(last <= g_PathHeap[child]) {
+            break;
+        }
+        g_PathHeap[i] = g_PathHeap[child];
+        i = child;
+    }
+    if(count > 0) {
+        g_PathHeap[i] = last;
+    }
+    return top;
+}
+
+// ---------------------------------------------------------------- 缓存
+
+/// <summary>
+/// 在缓存中查找到达 goal 且经过 start 的路径。
+/// </summary>
+/// <returns>条目号，未命中返回 -1；outOffset 为 start 在路径中的位置</returns>
+static int CacheLookup(int start, int goal, int* outOffset)
+{
+    for(int e = 0; e < PATH_CACHE_SIZE; e++) {
+        const PathCacheEntry& entry = g_PathCache[e];
+        if(entry.length == 0 || entry.goal != goal) {
+            continue;
+        }
+        const u16* cells = CacheCells(e);
+        for(int i = 0; i < entry.length; i++) {
+            if(cells[i] == start) {
+                *outOffset = i;
+                return e;
+            }
+        }
+    }
+    return -1;
+}
+
+static void MarkReady(PathRequest& request, int entry, int offset)
+{
+    request.status = PATH_READY;
+    request.entry = (s8)entry;
+    request.offset = (u16)offset;
+    g_PathCache[entry].refs++;
+    g_PathCache[entry].lastUse = ++g_PathUseClock;
+}
+
+/// <summary>
+/// 选一个可写入的缓存条目：优先空条目，否则淘汰最久未用且未被引用的条目。
+/// </summary>
+static int CacheVictim()
+{
+    int victim = -1;
+    for(int e = 0; e < PATH_CACHE_SIZE; e++) {
+        const PathCacheEntry& entry = g_PathCache[e];
+        if(entry.refs != 0) {
+            continue;
+        }
+        if(entry.length == 0) {
+            return e;
+        }
+        if(victim < 0 || entry.lastUse < g_PathCache[victim].lastUse) {
+            victim = e;
+        }
+    }
+    return victim;
+}
+
+static void CacheClear()
+{
+    for(int e = 0; e < PATH_CACHE_SIZE; e++) {
+        g_PathCache[e].length = 0;
+        g_PathCache[e].refs = 0;
+    }
+}
+
+// ---------------------------------------------------------------- A*
+
+static void FinishSearch(bool found, int goal)
+{
+    PathRequest& request = g_PathRequests[g_PathSearchTicket];
+    g_PathSearchTicket = -1;
+
+    if(!found) {
+        request.status = PATH_FAILED;
+        g_PathStats.searchesFailed++;
+        return;
+    }
+
+    // 路径长度 = g + 1，已由搜索剪枝保证不超过 PATH_MAX_LEN
+    const int length = g_PathG[goal] + 1;
+    const int entry = CacheVictim();
+    GBA_ASSERT(entry >= 0);
+
+    PathCacheEntry& slot = g_PathCache[entry];
+    slot.goal = (u16)goal;
+    slot.length = (u16)length;
+
+    u16* cells = CacheCells(entry);
+    int cell = goal;
+    for(int i = length - 1; i >= 0; i--) {
+        cells[i] = (u16)cell;
+        if(i > 0) {
+            cell -= g_PathOffset[g_PathParent[cell] & 3];
+        }
+    }
+
+    MarkReady(request, entry, 0);
+    g_PathStats.searchesDone++;
+
+    // 排队中的请求如果能复用这条路径（同目标且起点在路径上），一并完成
+    for(int t = 0; t < PATH_MAX_REQUESTS; t++) {
+        PathRequest& other = g_PathRequests[t];
+        if(other.status != PATH_PENDING || other.goal != goal) {
+            continue;
+        }
+        for(int i = 0; i < length; i++) {
+            if(cells[i] == other.start) {
+                MarkReady(other, entry, i);
+                g_PathStats.cacheHits++;
+                break;
+            }
+        }
+    }
+}
+
+static void BeginSearch(int ticket)
+{
+    const PathRequest& request = g_PathRequests[ticket];
+
+    if(++g_PathSearchStamp == 0) {
+        // 戳记回绕：清零后从 1 开始，避免旧格子被误认为本轮已访问
+        memset(g_PathStamp, 0, (u32)g_PathCellCount * sizeof(u16));
+        g_PathSearchStamp = 1;
+    }
+
+    g_PathSearchTicket = ticket;
+    g_PathHeapCount = 0;
+
+    const int start = request.start;
+    g_PathStamp[start] = g_PathSearchStamp;
+    g_PathG[start] = 0;
+    g_PathParent[start] = 0;
+    HeapPush(((u32)Distance(start, request.goal) << 16) | (u32)start);
+}
+
+/// <summary>
+/// 推进当前搜索。
+/// </summary>
+/// <returns>本次消耗的扩展数</returns>
+static int SearchStep(int budget)
+{
+    const int goal = g_PathRequests[g_PathSearchTicket].goal;
+    const u16 stamp = g_PathSearchStamp;
+    int used = 0;
+
+    while(used < budget) {
+        if(g_PathHeapCount == 0) {
+            FinishSearch(false, goal);
+            return used;
+        }
+
+        const int cell = (int)(HeapPop() & 0xFFFF);
+        used++;
+        if(g_PathParent[cell] & PATH_CLOSED) {
+            continue;
+        }
+        g_PathParent[cell] |= PATH_CLOSED;
+
+        if(cell == goal) {
+            FinishSearch(true, goal);
+            return used;
+        }
+
+        const int g = g_PathG[cell] + 1;
+        for(int d = 0; d < 4; d++) {
+            const int next = cell + g_PathOffset[d];
+            if(!g_PathWalk[next]) {
+                continue;
+            }
+            if(g_PathStamp[next] == stamp && ((g_PathParent[next] & PATH_CLOSED) || g_PathG[next] <= g)) {
+                continue;
+            }
+
+            // 曼哈顿距离可采纳：f 达到 PATH_MAX_LEN 时路径必然超长，直接剪枝
+            const int f = g + Distance(next, goal);
+            if(f >= PATH_MAX_LEN) {
+                continue;
+            }
+            if(g_PathHeapCount >= g_PathCellCount) {
+                continue;
+            }
+
+            g_PathStamp[next] = stamp;
+            g_PathG[next] = (u16)g;
+            g_PathParent[next] = (u8)d;
+            HeapPush(((u32)f << 16) | (u32)next);
+        }
+    }
+    return used;
+}
+
+/// <summary>
+/// 取最早提交的排队请求，先查缓存（期间可能已有同目标路径算完），未命中再开始搜索。
+/// </summary>
+static bool StartNextSearch()
+{
+    for(;;) {
+        int ticket = -1;
+        for(int t = 0; t < PATH_MAX_REQUESTS; t++) {
+            if(g_PathRequests[t].status != PATH_PENDING) {
+                continue;
+            }
+            if(ticket < 0 || (s16)(g_PathRequests[t].order - g_PathRequests[ticket].order) < 0) {
+                ticket = t;
+            }
+        }
+        if(ticket < 0) {
+            return false;
+        }
+
+        PathRequest& request = g_PathRequests[ticket];
+        if(!Connected(request.start, request.goal)) {
+            // 地图变化后起点或终点被堵住或不再连通
+            request.status = PATH_FAILED;
+            continue;
+        }
+
+        int offset = 0;
+        const int entry = CacheLookup(request.start, request.goal, &offset);
+        if(entry >= 0) {
+            MarkReady(request, entry, offset);
+            g_PathStats.cacheHits++;
+            continue;
+        }
+
+        g_PathStats.cacheMisses++;
+        BeginSearch(ticket);
+        return true;
+    }
+}
+
+// ---------------------------------------------------------------- 流场
+
+static void BeginFlowField(int field)
+{
+    FlowField& flow = g_PathFlow[field];
+    memset(flow.dir, PATH_DIR_NONE, (u32)g_PathCellCount);
+
+    g_PathFlowBuilding = field;
+    g_PathQueueHead = 0;
+    g_PathQueueTail = 0;
+    flow.state = FLOW_BUILDING;
+
+    if(g_PathWalk[flow.goal]) {
+        flow.dir[flow.goal] = PATH_FLOW_GOAL;
+        g_PathQueue[g_PathQueueTail++] = flow.goal;
+    }
+}
+
+/// <summary>
+/// 从目标向外做 BFS，每个格子记录走回上一圈的方向。
+/// </summary>
+static int FlowStep(int budget)
+{
+    static const u8 opposite[4] = { PATH_DIR_LEFT, PATH_DIR_RIGHT, PATH_DIR_UP, PATH_DIR_DOWN };
+
+    FlowField& flow = g_PathFlow[g_PathFlowBuilding];
+    u8* dir = flow.dir;
+    int used = 0;
+
+    while(used < budget && g_PathQueueHead < g_PathQueueTail) {
+        const int cell = g_PathQueue[g_PathQueueHead++];
+        used++;
+        for(int d = 0; d < 4; d++) {
+            const int next = cell + g_PathOffset[d];
+            if(g_PathWalk[next] && dir[next] == PATH_DIR_NONE) {
+                dir[next] = opposite[d];
+                g_PathQueue[g_PathQueueTail++] = (u16)next;
+            }
+        }
+    }
+
+    if(g_PathQueueHead >= g_PathQueueTail) {
+        flow.state = FLOW_READY;
+        g_PathFlowBuilding = -1;
+        g_PathStats.flowFieldCells += (u32)g_PathQueueTail;
+    }
+    return used;
+}
+
+static bool StartNextFlowField()
+{
+    for(int f = 0; f < PATH_MAX_FLOWFIELDS; f++) {
+        if(g_PathFlow[f].state == FLOW_QUEUED) {
+            BeginFlowField(f);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------- 对外接口
+
+bool PathFind_Init(MemArena* arena)
+{
+    g_PathReady = false;
+
+    // 行宽取不小于 宽+2 的 2 的幂；格子序号须放得进 u16
+    g_PathShift = 0;
+    while((1 << g_PathShift) < g_MapWidth + 2) {
+        g_PathShift++;
+    }
+    g_PathStride = 1 << g_PathShift;
+    g_PathCellCount = g_PathStride * (g_MapHeight + 2);
+    if(g_MapWidth > 254 || g_MapHeight > 254 || g_PathCellCount > 0x10000) {
+        DebugLog_Printf(DEBUGLOG_ERROR, "[path] map %dx%d too large", g_MapWidth, g_MapHeight);
+        return false;
+    }
+
+    g_PathOffset[PATH_DIR_RIGHT] = 1;
+    g_PathOffset[PATH_DIR_LEFT] = -1;
+    g_PathOffset[PATH_DIR_DOWN] = (s16)g_PathStride;
+    g_PathOffset[PATH_DIR_UP] = (s16)-g_PathStride;
+
+    const u32 cells = (u32)g_PathCellCount;
+    g_PathWalk = (u8*)MemArena_Alloc(arena, cells, 4);
+    g_PathRegion = (u16*)MemArena_Alloc(arena, cells * sizeof(u16), 4);
+    g_PathStamp = (u16*)MemArena_AllocZero(arena, cells * sizeof(u16), 4);
+    g_PathG = (u16*)MemArena_Alloc(arena, cells * sizeof(u16), 4);
+    g_PathParent = (u8*)MemArena_Alloc(arena, cells, 4);
+    g_PathHeap = (u32*)MemArena_Alloc(arena, cells * sizeof(u32), 4);
+    g_PathQueue = (u16*)MemArena_Alloc(arena, cells * sizeof(u16), 4);
+    g_PathCacheCells = (u16*)MemArena_Alloc(arena, PATH_CACHE_SIZE * PATH_MAX_LEN * sizeof(u16), 4);
+    bool ok = g_PathWalk && g_PathRegion && g_PathStamp && g_PathG && g_PathParent && g_PathHeap && g_PathQueue && g_PathCacheCells;
+    for(int f = 0; f < PATH_MAX_FLOWFIELDS; f++) {
+        g_PathFlow[f].dir = (u8*)MemArena_Alloc(arena, cells, 4);
+        g_PathFlow[f].state = FLOW_FREE;
+        g_PathFlow[f].refs = 0;
+        ok = ok && g_PathFlow[f].dir;
+    }
+    if(!ok) {
+        DebugLog_Printf(DEBUGLOG_ERROR, "[path] arena %s out of memory", arena->name);
+        return false;
+    }
+
+    for(int t = 0; t < PATH_MAX_REQUESTS; t++) {
+        g_PathRequests[t].status = PATH_FREE;
+    }
+    CacheClear();
+    g_PathSearchStamp = 0;
+    g_PathSearchTicket = -1;
+    g_PathFlowBuilding = -1;
+
+    BuildWalkGrid();
+    PathFind_ResetStats();
+    g_PathReady = true;
+    return true;
+}
+
+void PathFind_OnMapChanged()
+{
+    if(!g_PathReady) {
+        return;
+    }
+
+    BuildWalkGrid();
+    CacheClear();
+    g_PathSearchTicket = -1;
+
+    // 已完成但未取走的结果可能已不成立（新障碍或新通路）：退回排队重新计算；地图外的请求保持失败
+    for(int t = 0; t < PATH_MAX_REQUESTS; t++) {
+        PathRequest& request = g_PathRequests[t];
+        if(request.status == PATH_READY || (request.status == PATH_FAILED && request.start != 0)) {
+            request.status = PATH_PENDING;
+        }
+    }
+
+    g_PathFlowBuilding = -1;
+    for(int f = 0; f < PATH_MAX_FLOWFIELDS; f++) {
+        if(g_PathFlow[f].state != FLOW_FREE) {
+            g_PathFlow[f].state = FLOW_QUEUED;
+        }
+    }
+}
+
+bool PathFind_IsWalkable(int cellX16, int cellY16)
+{
+    if(!g_PathReady || !InMap(cellX16, cellY16)) {
+        return false;
+    }
+    return g_PathWalk[ToCell(cellX16, cellY16)] != 0;
+}
+
+int PathFind_Request(int startX16, int startY16, int goalX16, int goalY16)
+{
+    if(!g_PathReady) {
+        return -1;
+    }
+
+    int ticket = -1;
+    for(int t = 0; t < PATH_MAX_REQUESTS; t++) {
+        if(g_PathRequests[t].status == PATH_FREE) {
+            ticket = t;
+            break;
+        }
+    }
+    if(ticket < 0) {
+        return -1;
+    }
+
+    PathRequest& request = g_PathRequests[ticket];
+    request.order = g_PathOrder++;
+
+    if(!InMap(startX16, startY16) || !InMap(goalX16, goalY16)) {
+        request.start = 0;
+        request.goal = 0;
+        request.status = PATH_FAILED;
+        return ticket;
+    }
+
+    request.start = (u16)ToCell(startX16, startY16);
+    request.goal = (u16)ToCell(goalX16, goalY16);
+    if(!Connected(request.start, request.goal)) {
+        request.status = PATH_FAILED;
+        return ticket;
+    }
+
+    int offset = 0;
+    const int entry = CacheLookup(request.start, request.goal, &offset);
+    if(entry >= 0) {
+        MarkReady(request, entry, offset);
+        g_PathStats.cacheHits++;
+    } else {
+        // 未命中先排队；开始搜索前会再查一次缓存，命中则不计入未命中
+        request.status = PATH_PENDING;
+    }
+    return ticket;
+}
+
+PathStatus PathFind_Poll(int ticket)
+{
+    if(ticket < 0 || ticket >= PATH_MAX_REQUESTS) {
+        return PATH_FREE;
+    }
+    return (PathStatus)g_PathRequests[ticket].status;
+}
+
+int PathFind_TakePath(int ticket, u16* outCells, int maxCells)
+{
+    if(ticket < 0 || ticket >= PATH_MAX_REQUESTS || g_PathRequests[ticket].status != PATH_READY) {
+        return 0;
+    }
+
+    const PathRequest& request = g_PathRequests[ticket];
+    const PathCacheEntry& entry = g_PathCache[request.entry];
+    const u16* cells = CacheCells(request.entry) + request.offset;
+
+    int count = entry.length - request.offset;
+    if(count > maxCells) {
+        count = maxCells;
+    }
+    for(int i = 0; i < count; i++) {
+        outCells[i] = ToPublicCell(cells[i]);
+    }
+
+    PathFind_Release(ticket);
+    return count;
+}
+
+void PathFind_Release(int ticket)
+{
+    if(ticket < 0 || ticket >= PATH_MAX_REQUESTS) {
+        return;
+    }
+
+    PathRequest& request = g_PathRequests[ticket];
+    if(request.status == PATH_READY) {
+        g_PathCache[request.entry].refs--;
+    } else if(ticket == g_PathSearchTicket) {
+        g_PathSearchTicket = -1;
+    }
+    request.status = PATH_FREE;
+}
+
+int PathFind_AcquireFlowField(int goalX16, int goalY16)
+{
+    if(!g_PathReady || !InMap(goalX16, goalY16)) {
+        return -1;
+    }
+
+    const u16 goal = (u16)ToCell(goalX16, goalY16);
+    int freeSlot = -1;
+    for(int f = 0; f < PATH_MAX_FLOWFIELDS; f++) {
+        FlowField& flow = g_PathFlow[f];
+        if(flow.state != FLOW_FREE && flow.goal == goal) {
+            flow.refs++;
+            return f;
+        }
+        if(freeSlot < 0 && flow.refs == 0) {
+            freeSlot = f;
+        }
+    }
+    if(freeSlot < 0) {
+        return -1;
+    }
+
+    FlowField& flow = g_PathFlow[freeSlot];
+    if(g_PathFlowBuilding == freeSlot) {
+        g_PathFlowBuilding = -1;
+    }
+    flow.goal = goal;
+    flow.refs = 1;
+    flow.state = FLOW_QUEUED;
+    return freeSlot;
+}
+
+void PathFind_ReleaseFlowField(int field)
+{
+    if(field < 0 || field >= PATH_MAX_FLOWFIELDS || g_PathFlow[field].refs == 0) {
+        return;
+    }
+    // 引用归零后保留结果：同一目标很快再次被请求时可直接复用
+    g_PathFlow[field].refs--;
+}
+
+bool PathFind_IsFlowFieldReady(int field)
+{
+    return field >= 0 && field < PATH_MAX_FLOWFIELDS && g_PathFlow[field].state == FLOW_READY;
+}
+
+int PathFind_FlowDir(int field, int cellX16, int cellY16)
+{
+    if(!PathFind_IsFlowFieldReady(field) || !InMap(cellX16, cellY16)) {
+        return PATH_DIR_NONE;
+    }
+    const u8 dir = g_PathFlow[field].dir[ToCell(cellX16, cellY16)];
+    return dir < 4 ? dir : PATH_DIR_NONE;
+}
+
+void PathFind_Update(int maxExpansions)
+{
+    if(!g_PathReady) {
+        return;
+    }
+
+    PROFILE_SCOPE("pathfind");
+
+    bool searching = (g_PathSearchTicket >= 0) || StartNextSearch();
+    bool flowing = (g_PathFlowBuilding >= 0) || StartNextFlowField();
+
+    // 两类任务都有时各分一半预算，一方提前完成则余下的给另一方
+    int used = 0;
+    while(used < maxExpansions && (searching || flowing)) {
+        const int remain = maxExpansions - used;
+        if(searching) {
+            used += SearchStep(flowing ? (remain + 1) / 2 : remain);
+            searching = (g_PathSearchTicket >= 0) || StartNextSearch();
+        }
+        if(flowing && used < maxExpansions) {
+            used += FlowStep(maxExpansions - used);
+            flowing = (g_PathFlowBuilding >= 0) || StartNextFlowField();
+        }
+    }
+
+    g_PathStats.frames++;
+    g_PathStats.expansions += (u32)used;
+    if((u32)used > g_PathStats.maxExpansionsPerFrame) {
+        g_PathStats.maxExpansionsPerFrame = (u32)used;
+    }
+    PROFILE_COUNT("path expansions", used);
+}
+
+void PathFind_GetStats(PathStats* out)
+{
+    *out = g_PathStats;
+}
+
+void PathFind_ResetStats()
+{
+    memset(&g_PathStats, 0, sizeof(g_PathStats));
+}
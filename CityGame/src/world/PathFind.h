@@ -0,0 +1,128 @@
+/*------------------------------------------------------------------------
+名称：网格寻路服务
+说明：基于 16x16 碰撞格子的分时 A*（每帧限定扩展节点数、跨帧续算）、共享流场与路径缓存
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：工作区从地图 Arena 分配；地图变化时调用 PathFind_OnMapChanged 使缓存与流场失效
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "Arena.h"
+
+// 单条路径最多格子数（含起点与终点）；更远的目标应使用流场
+#define PATH_MAX_LEN 128
+// 同时排队的寻路请求数
+#define PATH_MAX_REQUESTS 16
+// 路径缓存条目数（大于请求数：已完成未取走的票据会锁定条目，保证总有可淘汰的条目）
+#define PATH_CACHE_SIZE 24
+// 共享流场数量
+#define PATH_MAX_FLOWFIELDS 4
+
+// 移动方向（流场输出）
+#define PATH_DIR_RIGHT 0
+#define PATH_DIR_LEFT 1
+#define PATH_DIR_DOWN 2
+#define PATH_DIR_UP 3
+#define PATH_DIR_NONE 0xFF
+
+// 路径输出的格子编码：x | (y << 8)
+#define PATH_CELL(x, y) ((u16)((x) | ((y) << 8)))
+#define PATH_CELL_X(cell) ((int)((cell) & 0xFF))
+#define PATH_CELL_Y(cell) ((int)((cell) >> 8))
+
+/// <summary>
+/// 寻路请求状态。
+/// </summary>
+enum PathStatus
+{
+    PATH_FREE = 0,     // 票据未使用
+    PATH_PENDING = 1,  // 排队或正在搜索
+    PATH_READY = 2,    // 已找到路径
+    PATH_FAILED = 3,   // 不可达或超过 PATH_MAX_LEN
+};
+
+/// <summary>
+/// 统计数据（自 PathFind_ResetStats 起累计）。
+/// </summary>
+struct PathStats
+{
+    u32 frames;
+    u32 expansions;
+    u32 maxExpansionsPerFrame;
+    u32 searchesDone;
+    u32 searchesFailed;
+    u32 cacheHits;
+    u32 cacheMisses;
+    u32 flowFieldCells;
+};
+
+/// <summary>
+/// 从当前地图构建可通行网格并分配工作区（需在 GameMemory_ResetMap 之后调用）。
+/// </summary>
+/// <returns>为 false 表示地图过大（宽 > 254）或 Arena 空间不足，寻路不可用</returns>
+bool PathFind_Init(MemArena* arena);
+
+/// <summary>
+/// 地图内容变化（开门、移除障碍等）：重建可通行网格，清空缓存，未取走的路径、进行中的搜索与流场全部重新计算。
+/// </summary>
+void PathFind_OnMapChanged();
+
+/// <summary>
+/// 格子是否可通行。
+/// </summary>
+bool PathFind_IsWalkable(int cellX16, int cellY16);
+
+/// <summary>
+/// 提交寻路请求；命中缓存时票据立即为 PATH_READY。
+/// </summary>
+/// <returns>票据（0..PATH_MAX_REQUESTS-1）；队列已满返回 -1</returns>
+int PathFind_Request(int startX16, int startY16, int goalX16, int goalY16);
+
+/// <summary>
+/// 查询票据状态。
+/// </summary>
+PathStatus PathFind_Poll(int ticket);
+
+/// <summary>
+/// 取出已完成的路径（PATH_CELL 编码，从起点到终点）并释放票据。
+/// </summary>
+/// <returns>写入的格子数；票据未完成时返回 0</returns>
+int PathFind_TakePath(int ticket, u16* outCells, int maxCells);
+
+/// <summary>
+/// 放弃票据（无论状态）。
+/// </summary>
+void PathFind_Release(int ticket);
+
+/// <summary>
+/// 创建（或复用同一目标的）共享流场，后台分时构建。
+/// </summary>
+/// <returns>流场 id；已满返回 -1</returns>
+int PathFind_AcquireFlowField(int goalX16, int goalY16);
+
+/// <summary>
+/// 释放流场引用，引用数归零后槽位可被复用。
+/// </summary>
+void PathFind_ReleaseFlowField(int field);
+
+/// <summary>
+/// 流场是否构建完成。
+/// </summary>
+bool PathFind_IsFlowFieldReady(int field);
+
+/// <summary>
+/// 查询流场：在该格子应走的方向（PATH_DIR_*），不可达或未完成返回 PATH_DIR_NONE。
+/// </summary>
+int PathFind_FlowDir(int field, int cellX16, int cellY16);
+
+/// <summary>
+/// 每帧调用：在 maxExpansions 个节点预算内推进 A* 搜索与流场构建。
+/// </summary>
+void PathFind_Update(int maxExpansions);
+
+void PathFind_GetStats(PathStats* out);
+void PathFind_ResetStats();
@@ -0,0 +1,177 @@
+/*------------------------------------------------------------------------
+名称：世界区块缓存
+说明：区块索引查找、LRU 槽位管理、BIOS LZ77 解压与方向预取
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：唯一区块可被多个位置 / 图层引用，槽位按唯一区块序号缓存，重复内容只解压一次
+------------------------------------------------------------------------*/
+
+#include "WorldChunks.h"
+
+#include "DebugLog.h"
+#include "Profiler.h"
+#include "../generated_assets.h"
+
+#define WORLD_CHUNK_EMPTY 0xFFFF
+#define WORLD_SLOT_NONE 0xFF
+
+struct WorldSlot
+{
+    u16 chunk;      // 唯一区块序号，WORLD_CHUNK_EMPTY 表示空闲
+    u32 lastUse;
+};
+
+static const u16 g_WorldEmptyChunk[WORLD_CHUNK_CELLS * WORLD_CHUNK_CELLS] = { 0 };
+
+static bool g_WorldReady = false;
+static u16* g_WorldSlotData = 0;
+// 唯一区块序号 -> 槽位（WORLD_SLOT_NONE 表示未缓存）
+static u8* g_WorldSlotOf = 0;
+static WorldSlot g_WorldSlots[WORLD_CACHE_SLOTS];
+static u32 g_WorldUseClock = 0;
+static WorldChunkStats g_WorldStats = { 0, 0, 0, 0 };
+
+/// <summary>
+/// 区块 (chunkX, chunkY) 的唯一区块序号，越界或全空返回 WORLD_CHUNK_EMPTY。
+/// </summary>
+static inline u16 ChunkId(int layerIndex, int chunkX, int chunkY)
+{
+    if(chunkX < 0 || chunkY < 0 || chunkX >= g_WorldChunksW || chunkY >= g_WorldChunksH) {
+        return WORLD_CHUNK_EMPTY;
+    }
+    return g_WorldChunkIndex[(layerIndex * g_WorldChunksH + chunkY) * g_WorldChunksW + chunkX];
+}
+
+static inline u16* SlotData(int slot)
+{
+    return g_WorldSlotData + slot * (WORLD_CHUNK_CELLS * WORLD_CHUNK_CELLS);
+}
+
+/// <summary>
+/// 淘汰最久未用的槽位并解压 chunk。
+/// </summary>
+/// <returns>槽位</returns>
+static int LoadChunk(u16 chunk)
+{
+    PROFILE_SCOPE("chunk load");
+    int slot = 0;
+    for(int i = 1; i < WORLD_CACHE_SLOTS; i++) {
+        if(g_WorldSlots[i].lastUse < g_WorldSlots[slot].lastUse) {
+            slot = i;
+        }
+    }
+
+    WorldSlot* s = &g_WorldSlots[slot];
+    if(s->chunk != WORLD_CHUNK_EMPTY) {
+        g_WorldSlotOf[s->chunk] = WORLD_SLOT_NONE;
+        g_WorldStats.evictions++;
+    }
+    LZ77UnCompWram(g_WorldChunkData + g_WorldChunkOffset[chunk], SlotData(slot));
+    s->chunk = chunk;
+    s->lastUse = ++g_WorldUseClock;
+    g_WorldSlotOf[chunk] = (u8)slot;
+    return slot;
+}
+
+bool WorldChunks_Init(MemArena* arena)
+{
+    g_WorldReady = false;
+    g_WorldUseClock = 0;
+    g_WorldStats.hits = 0;
+    g_WorldStats.loads = 0;
+    g_WorldStats.prefetches = 0;
+    g_WorldStats.evictions = 0;
+
+    const u32 slotBytes = WORLD_CACHE_SLOTS * WORLD_CHUNK_CELLS * WORLD_CHUNK_CELLS * sizeof(u16);
+    g_WorldSlotData = (u16*)MemArena_Alloc(arena, slotBytes, 4);
+    g_WorldSlotOf = (u8*)MemArena_Alloc(arena, g_WorldChunkCount, 4);
+    if(!g_WorldSlotData || (!g_WorldSlotOf && g_WorldChunkCount > 0)) {
+        DebugLog_Printf(DEBUGLOG_ERROR, "[world] arena %s out of memory", arena->name);
+        return false;
+    }
+
+    for(u32 i = 0; i < g_WorldChunkCount; i++) {
+        g_WorldSlotOf[i] = WORLD_SLOT_NONE;
+    }
+    for(int i = 0; i < WORLD_CACHE_SLOTS; i++) {
+        g_WorldSlots[i].chunk = WORLD_CHUNK_EMPTY;
+        g_WorldSlots[i].lastUse = 0;
+    }
+
+    g_WorldReady = true;
+    DebugLog_Printf(DEBUGLOG_INFO, "[world] %dx%d chunks x 4 layers, %u unique, cache %d slots (%lu B)",
+                    g_WorldChunksW, g_WorldChunksH, g_WorldChunkCount, WORLD_CACHE_SLOTS, (unsigned long)slotBytes);
+    return true;
+}
+
+const u16* WorldChunks_Get(int layerIndex, int chunkX, int chunkY)
+{
+    const u16 chunk = ChunkId(layerIndex, chunkX, chunkY);
+    if(chunk == WORLD_CHUNK_EMPTY || !g_WorldReady) {
+        return g_WorldEmptyChunk;
+    }
+
+    int slot = g_WorldSlotOf[chunk];
+    if(slot != WORLD_SLOT_NONE) {
+        g_WorldSlots[slot].lastUse = ++g_WorldUseClock;
+        g_WorldStats.hits++;
+    } else {
+        slot = LoadChunk(chunk);
+        g_WorldStats.loads++;
+    }
+    return SlotData(slot);
+}
+
+bool WorldChunks_Prefetch(int bufX, int bufY, int dirX, int dirY)
+{
+    if(!g_WorldReady) {
+        return false;
+    }
+
+    // 缓冲窗口覆盖的格子范围（闭区间），沿滚动方向延伸
+    int x0 = bufX >> 1;
+    int x1 = (bufX + 63) >> 1;
+    int y0 = bufY >> 1;
+    int y1 = (bufY + 31) >> 1;
+    if(dirX > 0) x1 += WORLD_PREFETCH_CELLS;
+    if(dirX < 0) x0 -= WORLD_PREFETCH_CELLS;
+    if(dirY > 0) y1 += WORLD_PREFETCH_CELLS;
+    if(dirY < 0) y0 -= WORLD_PREFETCH_CELLS;
+
+    // 算术右移：负坐标落到 -1 号区块，由 ChunkId 判为越界
+    // 范围内已缓存的区块一并刷新使用时间，保证 LRU 淘汰的总是范围外的槽位
+    const int cx0 = x0 >> WORLD_CHUNK_SHIFT;
+    const int cx1 = x1 >> WORLD_CHUNK_SHIFT;
+    const int cy0 = y0 >> WORLD_CHUNK_SHIFT;
+    const int cy1 = y1 >> WORLD_CHUNK_SHIFT;
+    u16 missing = WORLD_CHUNK_EMPTY;
+    for(int layer = 0; layer < 4; layer++) {
+        for(int cy = cy0; cy <= cy1; cy++) {
+            for(int cx = cx0; cx <= cx1; cx++) {
+                const u16 chunk = ChunkId(layer, cx, cy);
+                if(chunk == WORLD_CHUNK_EMPTY) {
+                    continue;
+                }
+                const int slot = g_WorldSlotOf[chunk];
+                if(slot != WORLD_SLOT_NONE) {
+                    g_WorldSlots[slot].lastUse = ++g_WorldUseClock;
+                } else if(missing == WORLD_CHUNK_EMPTY) {
+                    missing = chunk;
+                }
+            }
+        }
+    }
+    if(missing == WORLD_CHUNK_EMPTY) {
+        return false;
+    }
+
+    LoadChunk(missing);
+    g_WorldStats.prefetches++;
+    return true;
+}
+
+const WorldChunkStats* WorldChunks_GetStats()
+{
+    return &g_WorldStats;
+}
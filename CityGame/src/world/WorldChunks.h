@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------
+名称：世界区块缓存
+说明：按需把镜头附近的 16x16 格子区块从 ROM 解压（BIOS LZ77）到 EWRAM 缓存，并按滚动方向预取
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：缓存槽从地图 Arena 分配，LRU 淘汰；全空区块不占槽位。
+      槽位数按最坏情况取：BG 缓冲窗口（33x17 格）加上预取余量最多覆盖 4x3 个区块，4 个图层共 48 个
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "Arena.h"
+
+// 区块边长（格子）
+#define WORLD_CHUNK_SHIFT 4
+#define WORLD_CHUNK_CELLS (1 << WORLD_CHUNK_SHIFT)
+// 缓存槽数量
+#define WORLD_CACHE_SLOTS 48
+// 预取：缓冲窗口沿滚动方向向前延伸的格子数
+#define WORLD_PREFETCH_CELLS 8
+
+/// <summary>
+/// 缓存统计（自 WorldChunks_Init 起累计）。
+/// </summary>
+struct WorldChunkStats
+{
+    u32 hits;           // 请求时已在缓存
+    u32 loads;          // 请求时才解压（滚动卡顿的来源，预取充分时应接近 0）
+    u32 prefetches;     // 预取解压
+    u32 evictions;      // 淘汰的已占用槽位
+};
+
+/// <summary>
+/// 分配缓存槽与区块到槽位的映射表（需在 GameMemory_ResetMap 之后调用）。
+/// </summary>
+/// <returns>为 false 表示 Arena 空间不足</returns>
+bool WorldChunks_Init(MemArena* arena);
+
+/// <summary>
+/// 取得图层 layerIndex 的区块 (chunkX, chunkY) 的 16x16 元 tile 序号（行优先），不在缓存时立即解压。
+/// </summary>
+/// <returns>全空或越界的区块返回共享的全 0 区块；指针在下一次解压前有效</returns>
+const u16* WorldChunks_Get(int layerIndex, int chunkX, int chunkY);
+
+/// <summary>
+/// 在 BG 缓冲窗口沿滚动方向延伸 WORLD_PREFETCH_CELLS 格的范围内，解压至多一个尚未缓存的区块。
+/// </summary>
+/// <param name="bufX">窗口左上角世界 8x8 tile X</param>
+/// <param name="bufY">窗口左上角世界 8x8 tile Y</param>
+/// <param name="dirX">水平滚动方向（负、0、正）</param>
+/// <param name="dirY">垂直滚动方向（负、0、正）</param>
+/// <returns>为 true 表示本次解压了一个区块</returns>
+bool WorldChunks_Prefetch(int bufX, int bufY, int dirX, int dirY);
+
+/// <summary>
+/// 累计统计。
+/// </summary>
+const WorldChunkStats* WorldChunks_GetStats();
@@ -21,6 +21,76 @@ def _decode_layer_data_base64_zlib(data_text: str, cell_count: int) -> list[int]
     return list(gids)
 
 
+# 非 0 元素的连续区间，展开为 [start0, end0, start1, end1, ...]（end 不含）
+def _occupied_runs(gids: list[int]) -> list[int]:
+    runs: list[int] = []
+    start = -1
+    for i, gid in enumerate(gids):
+        if gid != 0 and start < 0:
+            start = i
+        elif gid == 0 and start >= 0:
+            runs.extend((start, i))
+            start = -1
+    if start >= 0:
+        runs.extend((start, len(gids)))
+    return runs
+
+
+# GBA BIOS LZ77（SWI 0x11 / 0x12，类型 0x10）：贪心匹配，长度 3~18、距离 1~4096
+def _lz77_compress(data: bytes) -> bytes:
+    out = bytearray(struct.pack("<I", 0x10 | (len(data) << 8)))
+    pos = 0
+    while pos < len(data):
+        flag_at = len(out)
+        out.append(0)
+        for bit in range(8):
+            if pos >= len(data):
+                break
+            best_len = 0
+            best_disp = 0
+            max_len = min(18, len(data) - pos)
+            for cand in range(max(0, pos - 4096), pos):
+                n = 0
+                while n < max_len and data[cand + n] == data[pos + n]:
+                    n += 1
+                if n > best_len:
+                    best_len = n
+                    best_disp = pos - cand
+                    if n == max_len:
+                        break
+            if best_len >= 3:
+                out[flag_at] |= 0x80 >> bit
+                out.append(((best_len - 3) << 4) | ((best_disp - 1) >> 8))
+                out.append((best_disp - 1) & 0xFF)
+                pos += best_len
+            else:
+                out.append(data[pos])
+                pos += 1
+    return bytes(out)
+
+
+def _lz77_decompress(src: bytes) -> bytes:
+    size = struct.unpack_from("<I", src, 0)[0] >> 8
+    out = bytearray()
+    pos = 4
+    while len(out) < size:
+        flags = src[pos]
+        pos += 1
+        for bit in range(8):
+            if len(out) >= size:
+                break
+            if flags & (0x80 >> bit):
+                length = (src[pos] >> 4) + 3
+                disp = (((src[pos] & 0x0F) << 8) | src[pos + 1]) + 1
+                pos += 2
+                for _ in range(length):
+                    out.append(out[-disp])
+            else:
+                out.append(src[pos])
+                pos += 1
+    return bytes(out)
+
+
 def _rgb_to_bgr555(r: int, g: int, b: int) -> int:
     r5 = (r & 0xFF) >> 3
     g5 = (g & 0xFF) >> 3
@@ -203,6 +273,20 @@ def main() -> None:
     used_gid_list = sorted(used_gids)
     max_gid = max(used_gid_list) if used_gid_list else 0
 
+    # 动画 tile（Tiled 的 <animation>）：只处理地图中用到的 tile，运行时整块改写其 4 个 8x8 tile
+    animations: list[tuple[int, list[tuple[int, int]]]] = []
+    for tile in tileset.findall("tile"):
+        animation = tile.find("animation")
+        if animation is None:
+            continue
+        gid = int(tile.get("id")) + 1
+        frames = [(int(f.get("tileid")) + 1, int(f.get("duration"))) for f in animation.findall("frame")]
+        if gid in used_gids and len(frames) >= 2:
+            animations.append((gid, frames))
+
+    # 调色板需要覆盖动画帧（帧 tile 不一定出现在地图里）
+    palette_gid_list = sorted(used_gids | {frame_gid for _, frames in animations for frame_gid, _ in frames})
+
     tileset_rgba = Image.open(tileset_png_path).convert("RGBA")
 
     # 角色两帧
@@ -217,7 +301,7 @@ def main() -> None:
     player1_rgba = _remove_white_outline(Image.open(player1_path).convert("RGBA"))
 
     # 生成调色板源图：把所有会用到的 tile 与角色帧拼起来，再量化为 256 色
-    composite_w = len(used_gid_list) * tile_w + player0_rgba.size[0] + player1_rgba.size[0]
+    composite_w = len(palette_gid_list) * tile_w + player0_rgba.size[0] + player1_rgba.size[0]
     composite_h = max(tile_h, player0_rgba.size[1], player1_rgba.size[1], 1)
     if composite_w <= 0:
         composite_w = 1
@@ -225,7 +309,7 @@ def main() -> None:
     composite = Image.new("RGBA", (composite_w, composite_h), (0, 0, 0, 0))
 
     x_cursor = 0
-    for gid in used_gid_list:
+    for gid in palette_gid_list:
         tile_index = gid - 1
         tile_rgba = _crop_tileset_tile(tileset_rgba, tile_index, columns, tile_w, tile_h, spacing)
         composite.paste(tile_rgba, (x_cursor, 0), tile_rgba)
@@ -241,31 +325,155 @@ def main() -> None:
     # GBA 调色板（BGR555）
     gba_palette = [_rgb_to_bgr555(palette[i * 3 + 0], palette[i * 3 + 1], palette[i * 3 + 2]) for i in range(256)]
 
-    # gid -> 8x8 tile baseIndex 映射（16x16 由 2x2 个 8x8 组成）
-    # 0 号 tile 预留为空白 tile，便于 gid==0 时使用。
-    gid_to_base_tile8 = [0] * (max_gid + 1)
-
+    # 8x8 tile 去重（含水平 / 垂直翻转），0 号 tile 预留为空白 tile
     bg_tiles: list[int] = [0] * (8 * 8)
     bg_tile_count = 1
+    tile8_lookup: dict[bytes, int] = {bytes(64): 0}
 
-    for gid in used_gid_list:
-        base = bg_tile_count
-        gid_to_base_tile8[gid] = base
-
-        tile_index = gid - 1
-        tile_rgba = _crop_tileset_tile(tileset_rgba, tile_index, columns, tile_w, tile_h, spacing)
-        tile_p = _quantize_with_palette(tile_rgba, pal_im)
-        tile_bytes = tile_p.tobytes()
+    def split_tile8(gid: int) -> list[int]:
+        tile_rgba = _crop_tileset_tile(tileset_rgba, gid - 1, columns, tile_w, tile_h, spacing)
+        tile_bytes = _quantize_with_palette(tile_rgba, pal_im).tobytes()
 
         # 按象限拆分为 4 个 8x8（顺序：左上、右上、左下、右下）
+        out: list[int] = []
         for qy in range(2):
             for qx in range(2):
                 for y in range(8):
                     row = (qy * 8 + y) * 16
                     col = qx * 8
-                    bg_tiles.extend(tile_bytes[row + col : row + col + 8])
+                    out.extend(tile_bytes[row + col : row + col + 8])
+        return out
 
-        bg_tile_count += 4
+    def flip_tile8(pixels: bytes, hflip: bool, vflip: bool) -> bytes:
+        rows = [pixels[y * 8 : y * 8 + 8] for y in range(8)]
+        if vflip:
+            rows.reverse()
+        if hflip:
+            rows = [row[::-1] for row in rows]
+        return b"".join(rows)
+
+    # 屏幕条目：bit 0~9 tile 序号，bit 10 水平翻转，bit 11 垂直翻转（256 色模式不使用 bit 12~15 的调色板号）
+    def add_tile8(pixels: bytes, shared: bool) -> int:
+        nonlocal bg_tile_count
+        if shared and pixels in tile8_lookup:
+            return tile8_lookup[pixels]
+        tile = bg_tile_count
+        bg_tiles.extend(pixels)
+        bg_tile_count += 1
+        if shared:
+            for hflip in (False, True):
+                for vflip in (False, True):
+                    tile8_lookup.setdefault(flip_tile8(pixels, hflip, vflip), tile | (hflip << 10) | (vflip << 11))
+        return tile
+
+    # 元 tile（16x16）：每个 4 个屏幕条目（左上、右上、左下、右下），0 号为空；地图与区块只存元 tile 序号。
+    # 动画 tile 运行时整块改写其 4 个 8x8，因此独占连续的 tile，不参与去重
+    animated_gids = {gid for gid, _ in animations}
+    metatiles: list[int] = [0, 0, 0, 0]
+    metatile_lookup: dict[tuple[int, ...], int] = {(0, 0, 0, 0): 0}
+    gid_to_metatile: dict[int, int] = {0: 0}
+    gid_to_base_tile8: dict[int, int] = {}
+    for gid in used_gid_list:
+        quads = split_tile8(gid)
+        animated = gid in animated_gids
+        if animated:
+            gid_to_base_tile8[gid] = bg_tile_count
+        entries = tuple(add_tile8(bytes(quads[q * 64 : q * 64 + 64]), not animated) for q in range(4))
+        if animated or entries not in metatile_lookup:
+            metatile_lookup.setdefault(entries, len(metatiles) // 4)
+            gid_to_metatile[gid] = len(metatiles) // 4
+            metatiles.extend(entries)
+        else:
+            gid_to_metatile[gid] = metatile_lookup[entries]
+    metatile_count = len(metatiles) // 4
+    print(f"[assets] metatiles: {metatile_count} (from {len(used_gid_list)} gids), "
+          f"8x8 tiles: {bg_tile_count} (without dedupe {1 + 4 * len(used_gid_list)})")
+
+    # 各图层的元 tile 序号（行优先）
+    layer_cells: list[list[int]] = [[gid_to_metatile[gid] for gid in layer.gids] for layer in layers]
+
+    # 总览图（模式 1 的 BG2 仿射图层，64x64 tile = 512x512 像素）：每个 16x16 格子四层合成后 2:1 缩小为一个 8x8 tile
+    # （2x2 像素取众数，不产生调色板外的颜色），相同 tile 只存一份，0 号为空白 tile；
+    # 仿射 BG 的屏幕条目只有 8 位，唯一 tile 超过 255 个时把最少用的 tile 并入像素差异最小的 tile
+    overview_size = 64
+    if map_w > overview_size or map_h > overview_size:
+        raise RuntimeError("地图超过总览图 64x64 格子")
+    gid_pixels: dict[int, bytes] = {}
+
+    def gid_image(gid: int) -> bytes:
+        if gid not in gid_pixels:
+            tile_rgba = _crop_tileset_tile(tileset_rgba, gid - 1, columns, tile_w, tile_h, spacing)
+            gid_pixels[gid] = _quantize_with_palette(tile_rgba, pal_im).tobytes()
+        return gid_pixels[gid]
+
+    cell_images: list[bytes] = []
+    for idx in range(cell_count):
+        merged = bytearray(tile_w * tile_h)
+        for layer in layers:
+            gid = layer.gids[idx]
+            if gid == 0:
+                continue
+            pixels = gid_image(gid)
+            for i, value in enumerate(pixels):
+                if value != 0:
+                    merged[i] = value
+        small = bytearray(64)
+        for y in range(8):
+            for x in range(8):
+                block = [merged[(2 * y + dy) * tile_w + 2 * x + dx] for dy in range(2) for dx in range(2)]
+                small[y * 8 + x] = max(block, key=lambda v: (block.count(v), v == block[0]))
+        cell_images.append(bytes(small))
+
+    overview_use: dict[bytes, int] = {}
+    for image in cell_images:
+        if any(image):
+            overview_use[image] = overview_use.get(image, 0) + 1
+    overview_unique = len(overview_use)
+    overview_remap: dict[bytes, bytes] = {}
+    while len(overview_use) > 255:
+        rare = min(overview_use, key=lambda image: overview_use[image])
+        count = overview_use.pop(rare)
+        nearest = min(overview_use, key=lambda image: sum(a != b for a, b in zip(image, rare)))
+        overview_use[nearest] += count
+        overview_remap[rare] = nearest
+        for src, dst in overview_remap.items():
+            if dst == rare:
+                overview_remap[src] = nearest
+
+    overview_tiles: list[int] = [0] * 64
+    overview_tile_ids: dict[bytes, int] = {bytes(64): 0}
+    overview_map: list[int] = [0] * (overview_size * overview_size)
+    for idx, image in enumerate(cell_images):
+        image = overview_remap.get(image, image)
+        if image not in overview_tile_ids:
+            overview_tile_ids[image] = len(overview_tiles) // 64
+            overview_tiles.extend(image)
+        overview_map[(idx // map_w) * overview_size + idx % map_w] = overview_tile_ids[image]
+    print(f"[assets] overview: {len(overview_tiles) // 64} tiles (unique {overview_unique + 1}, merged {len(overview_remap)}), "
+          f"{overview_size}x{overview_size} affine map")
+
+    # 动画帧：每帧 4 个 8x8（256 字节），相同帧只存一份；时长换算为 60Hz 帧数
+    anim_base_tile8: list[int] = []
+    anim_first_frame: list[int] = []
+    anim_frame_count: list[int] = []
+    anim_frame_image: list[int] = []
+    anim_frame_ticks: list[int] = []
+    anim_images: list[int] = []
+    anim_image_index: dict[int, int] = {}
+    for gid, frames in animations:
+        anim_base_tile8.append(gid_to_base_tile8[gid])
+        anim_first_frame.append(len(anim_frame_image))
+        anim_frame_count.append(len(frames))
+        for frame_gid, duration in frames:
+            if frame_gid not in anim_image_index:
+                anim_image_index[frame_gid] = len(anim_images) // 256
+                anim_images.extend(split_tile8(frame_gid))
+            anim_frame_image.append(anim_image_index[frame_gid])
+            anim_frame_ticks.append(max(1, round(duration * 60 / 1000)))
+        print(f"[assets] anim gid {gid}: {len(frames)} frames, 256 B VRAM per tick")
+    if animations:
+        print(f"[assets] anims: {len(animations)}, worst case {len(animations) * 256} B VRAM per tick, "
+              f"{len(anim_images)} B frame data")
 
     # 角色精灵：打包为 32x32 的 8x8 tiles（256 色 OBJ）
     player0_p = _quantize_with_palette(player0_rgba, pal_im)
@@ -324,6 +532,14 @@ def main() -> None:
         lines.append("};")
         return "\n".join(lines)
 
+    def fmt_u32_array(name: str, values: list[int], per_line: int = 8) -> str:
+        lines = [f"extern const unsigned int {name}[] __attribute__((aligned(4))) = {{"]
+        for i in range(0, len(values), per_line):
+            chunk = values[i : i + per_line]
+            lines.append("    " + ", ".join(f"0x{v:08X}" for v in chunk) + ",")
+        lines.append("};")
+        return "\n".join(lines)
+
     def fmt_u8_array(name: str, values: list[int], per_line: int = 24) -> str:
         lines = [f"extern const unsigned char {name}[] __attribute__((aligned(4))) = {{"]
         for i in range(0, len(values), per_line):
@@ -341,18 +557,133 @@ def main() -> None:
         "",
     ]
 
-    # 图层数据（u16 存 gid，0 表示空）
+    # 世界区块：每个图层切成 16x16 格子的区块（地图边缘补 0），内容相同的区块只存一份并各自 LZ77 压缩；
+    # 索引按 [图层][区块行][区块列] 排列，全空区块记为 0xFFFF，不占 ROM 也不占运行时缓存
+    chunk_cells = 16
+    chunks_w = (map_w + chunk_cells - 1) // chunk_cells
+    chunks_h = (map_h + chunk_cells - 1) // chunk_cells
+    chunk_index: list[int] = []
+    chunk_offsets: list[int] = []
+    chunk_data = bytearray()
+    chunk_ids: dict[bytes, int] = {}
+    empty_chunks = 0
+    for layer in layer_cells:
+        for cy in range(chunks_h):
+            for cx in range(chunks_w):
+                cells: list[int] = []
+                for y in range(cy * chunk_cells, (cy + 1) * chunk_cells):
+                    for x in range(cx * chunk_cells, (cx + 1) * chunk_cells):
+                        cells.append(layer[y * map_w + x] if x < map_w and y < map_h else 0)
+                if not any(cells):
+                    chunk_index.append(0xFFFF)
+                    empty_chunks += 1
+                    continue
+                raw = struct.pack(f"<{len(cells)}H", *cells)
+                chunk_id = chunk_ids.get(raw)
+                if chunk_id is None:
+                    chunk_id = len(chunk_ids)
+                    if chunk_id >= 0xFFFF:
+                        raise RuntimeError("唯一区块数超过 65534")
+                    chunk_ids[raw] = chunk_id
+                    packed = _lz77_compress(raw)
+                    if _lz77_decompress(packed) != raw:
+                        raise RuntimeError("区块 LZ77 压缩校验失败")
+                    chunk_offsets.append(len(chunk_data))
+                    # BIOS 解压要求源地址 4 字节对齐
+                    chunk_data += packed + bytes((-len(packed)) % 4)
+                chunk_index.append(chunk_id)
+
+    print(f"[assets] world chunks: {chunks_w}x{chunks_h} x 4 layers, unique {len(chunk_ids)}, empty {empty_chunks}, "
+          f"raw {len(chunk_ids) * chunk_cells * chunk_cells * 2} B, lz77 {len(chunk_data)} B "
+          f"(+ index {len(chunk_index) * 2} B; flat layers would be {4 * cell_count * 2} B)")
+
+    cpp_parts.append(f"extern const int g_WorldChunksW = {chunks_w};\nextern const int g_WorldChunksH = {chunks_h};\n")
+    cpp_parts.append(f"extern const unsigned int g_WorldChunkCount = {len(chunk_ids)};\n")
+    cpp_parts.append(f"extern const unsigned int g_WorldChunkDataBytes = {len(chunk_data)};\n")
+    cpp_parts.append(fmt_u16_array("g_WorldChunkIndex", chunk_index, per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u32_array("g_WorldChunkOffset", chunk_offsets or [0], per_line=8))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u8_array("g_WorldChunkData", list(chunk_data) or [0], per_line=32))
+    cpp_parts.append("")
+
+    # 碰撞位图：Objects（图层 2）与 Doors/windows/roof（图层 3）非 0 的格子，每行 (宽 + 7) / 8 字节，bit x & 7
+    solid_stride = (map_w + 7) // 8
+    solid_bits = [0] * (solid_stride * map_h)
+    for y in range(map_h):
+        for x in range(map_w):
+            idx = y * map_w + x
+            if layers[2].gids[idx] != 0 or layers[3].gids[idx] != 0:
+                solid_bits[y * solid_stride + (x >> 3)] |= 1 << (x & 7)
+    cpp_parts.append(f"extern const int g_WorldSolidStride = {solid_stride};\n")
+    cpp_parts.append(fmt_u8_array("g_WorldSolidBits", solid_bits, per_line=32))
+    cpp_parts.append("")
+
+    # 图层占用：每行 / 每列非空格子的连续区间 [start, end)（16x16 格子），流式更新只写这些区间
+    row_run_index: list[int] = []
+    row_runs: list[int] = []
+    col_run_index: list[int] = []
+    col_runs: list[int] = []
     for i, layer in enumerate(layers):
-        layer_u16 = [int(gid) & 0xFFFF for gid in layer.gids]
-        cpp_parts.append(fmt_u16_array(f"g_Layer{i}", layer_u16, per_line=16))
-        cpp_parts.append("")
+        row_count = 0
+        col_count = 0
+        for y in range(map_h):
+            row_run_index.append(len(row_runs) // 2)
+            runs = _occupied_runs([layer_cells[i][y * map_w + x] for x in range(map_w)])
+            row_runs.extend(runs)
+            row_count += len(runs) // 2
+        row_run_index.append(len(row_runs) // 2)
+        for x in range(map_w):
+            col_run_index.append(len(col_runs) // 2)
+            runs = _occupied_runs([layer_cells[i][y * map_w + x] for y in range(map_h)])
+            col_runs.extend(runs)
+            col_count += len(runs) // 2
+        col_run_index.append(len(col_runs) // 2)
+
+        occupied = sum(1 for cell in layer_cells[i] if cell != 0)
+        print(f"[assets] layer {i} {layer.name}: {occupied}/{cell_count} cells ({occupied * 100 // cell_count}%), "
+              f"row runs {row_count}, column runs {col_count}")
+
+    if max(len(row_runs), len(col_runs)) // 2 > 0xFFFF:
+        raise RuntimeError("图层占用区间数超过 65535")
+
+    cpp_parts.append(fmt_u16_array("g_LayerRowRunIndex", row_run_index, per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_LayerRowRuns", row_runs or [0, 0], per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_LayerColRunIndex", col_run_index, per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_LayerColRuns", col_runs or [0, 0], per_line=16))
+    cpp_parts.append("")
 
-    cpp_parts.append(fmt_u16_array("g_GidToBaseTile8", gid_to_base_tile8, per_line=16))
+    cpp_parts.append(f"extern const unsigned int g_MetatileCount = {metatile_count};\n")
+    cpp_parts.append(fmt_u16_array("g_Metatiles", metatiles, per_line=16))
     cpp_parts.append("")
 
     cpp_parts.append(fmt_u8_array("g_BgTiles", bg_tiles, per_line=32))
     cpp_parts.append("")
 
+    cpp_parts.append(f"extern const unsigned int g_OverviewTileCount = {len(overview_tiles) // 64};\n")
+    cpp_parts.append(f"extern const int g_OverviewMapSize = {overview_size};\n")
+    cpp_parts.append(fmt_u8_array("g_OverviewTiles", overview_tiles, per_line=32))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u8_array("g_OverviewMap", overview_map, per_line=32))
+    cpp_parts.append("")
+
+    cpp_parts.append(f"extern const unsigned int g_TileAnimCount = {len(animations)};\n")
+    cpp_parts.append(fmt_u16_array("g_TileAnimBaseTile8", anim_base_tile8 or [0], per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_TileAnimFirstFrame", anim_first_frame or [0], per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_TileAnimFrameCount", anim_frame_count or [0], per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_TileAnimFrameImage", anim_frame_image or [0], per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u16_array("g_TileAnimFrameTicks", anim_frame_ticks or [0], per_line=16))
+    cpp_parts.append("")
+    cpp_parts.append(fmt_u8_array("g_TileAnimFrameData", anim_images or [0], per_line=32))
+    cpp_parts.append("")
+
     cpp_parts.append(f"extern const int g_PlayerWidth = {player0_rgba.size[0]};\nextern const int g_PlayerHeight = {player0_rgba.size[1]};\n")
     cpp_parts.append(f"extern const unsigned short g_PlayerObjFrame0TileId = {player_obj_frame0_tile_id};\n")
     cpp_parts.append(f"extern const unsigned short g_PlayerObjFrame1TileId = {player_obj_frame1_tile_id};\n")
@@ -0,0 +1,32 @@
+/*------------------------------------------------------------------------
+名称：Demo 字体
+说明：由 ZhFont/tool/zhfontc.py 从 font.txt 自动生成：12 像素
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+
+#include "generated_font.h"
+
+// 12 像素：5 字，点阵 59 字节
+static const u16 g_DemoFace12Codes[5] = {
+    0x0020, 0x0041, 0x8DF3, 0x8FC7, 0x952E,
+};
+static const ZhFaceMetric g_DemoFace12Metrics[5] = {
+    { 4, 0x00, 0, 0 },  // U+0020
+    { 6, 0x03, 5, 7 },  // A
+    { 12, 0x00, 12, 12 },  // 跳
+    { 12, 0x00, 12, 12 },  // 过
+    { 12, 0x00, 12, 12 },  // 键
+};
+static const u32 g_DemoFace12Blocks[1] = {
+    0,
+};
+static const u8 g_DemoFace12Bitmap[59] = {
+    0x74, 0x63, 0xF8, 0xC6, 0x20, 0x02, 0x8F, 0x28, 0x92, 0x99, 0xAA, 0xF6, 0xC2, 0x28, 0xB6, 0xCA,
+    0xAA, 0xA2, 0x8B, 0x29, 0xC4, 0x91, 0x87, 0x40, 0x42, 0x04, 0x20, 0x40, 0xFF, 0x00, 0x4E, 0x44,
+    0x22, 0x42, 0x04, 0x21, 0x42, 0x08, 0x50, 0x08, 0xFF, 0x20, 0x82, 0xFE, 0x72, 0xA4, 0x7F, 0xF4,
+    0xA2, 0xFE, 0xF2, 0x82, 0xBE, 0x24, 0x83, 0x7E, 0x6A, 0x81, 0x1F,
+};
+extern const ZhFace g_DemoFace12 = { g_DemoFace12Codes, g_DemoFace12Metrics, g_DemoFace12Blocks, g_DemoFace12Bitmap, 5, 12, 12 };
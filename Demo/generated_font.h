@@ -0,0 +1,17 @@
+/*------------------------------------------------------------------------
+名称：Demo 字体
+说明：由 ZhFont/tool/zhfontc.py 从 font.txt 自动生成：12 像素
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "ZhFontFace.h"
+
+/// <summary>
+/// 12 像素字体（5 字）。
+/// </summary>
+extern const ZhFace g_DemoFace12;
@@ -0,0 +1,55 @@
+/*------------------------------------------------------------------------
+名称：Demo 预编码文本
+说明：由 ZhFont/tool/zhtext.py 从 text.txt 自动生成：预编码字符串与子集字库（26 个字形）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+
+#include "generated_text.h"
+
+static const ZhGlyph g_DemoFontGlyphs[26] = {
+    { { 0x0000, 0x0000, 0x0000, 0x7000, 0x8800, 0x8800, 0xF800, 0x8800, 0x8800, 0x8800, 0x0000, 0x0000 }, 0x0041, 6, 3, 10, 0 },  // A
+    { { 0x0000, 0x0000, 0x0000, 0xF000, 0x4800, 0x4800, 0x7000, 0x4800, 0x4800, 0xF000, 0x0000, 0x0000 }, 0x0042, 6, 3, 10, 0 },  // B
+    { { 0x0000, 0x0000, 0x0000, 0x7000, 0x8800, 0x8000, 0x8000, 0x9800, 0x8800, 0x7000, 0x0000, 0x0000 }, 0x0047, 6, 3, 10, 0 },  // G
+    { { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6000, 0x9000, 0x9000, 0x6000, 0x0000 }, 0xA1A3, 12, 7, 11, 0 },  // 。
+    { { 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800, 0x3000, 0x0000 }, 0xA3AC, 12, 7, 11, 0 },  // ，
+    { { 0x0000, 0x3E00, 0x6300, 0x6300, 0x0600, 0x0C00, 0x0C00, 0x0000, 0x0C00, 0x0C00, 0x0000, 0x0000 }, 0xA3BF, 12, 1, 10, 0 },  // ？
+    { { 0x0880, 0x0FC0, 0x1880, 0x2500, 0x4600, 0x1980, 0x2070, 0xDFC0, 0x1240, 0x1FC0, 0x1240, 0x1FC0 }, 0xB1B8, 12, 0, 12, 0 },  // 备
+    { { 0x0420, 0xFEA0, 0x28A0, 0x44A0, 0xFEA0, 0x10A0, 0x10A0, 0x7CA0, 0x10A0, 0x1E20, 0xE0A0, 0x0040 }, 0xB5BD, 12, 0, 12, 0 },  // 到
+    { { 0x1100, 0x2120, 0x7BF0, 0x4A20, 0x4C20, 0x4820, 0x7920, 0x48A0, 0x48A0, 0x4820, 0x78A0, 0x0040 }, 0xB5C4, 12, 0, 12, 0 },  // 的
+    { { 0x2000, 0x27E0, 0x2040, 0xF880, 0x4880, 0x48A0, 0x57F0, 0x5080, 0x3080, 0x2880, 0x4A80, 0x8100 }, 0xBAC3, 12, 0, 12, 0 },  // 好
+    { { 0x0200, 0x0200, 0xFBF0, 0x1220, 0x5540, 0x2100, 0x2100, 0x2100, 0x5280, 0x5240, 0x8430, 0x1820 }, 0xBBB6, 12, 0, 12, 0 },  // 欢
+    { { 0x2100, 0x23E0, 0xA420, 0xAA40, 0x6180, 0x2640, 0x2040, 0x6FF0, 0xA040, 0x2640, 0x2140, 0x20C0 }, 0xBDAB, 12, 0, 12, 0 },  // 将
+    { { 0x3FC0, 0x2440, 0x3FC0, 0x2440, 0x3FC0, 0x0400, 0x0B00, 0x38F0, 0xC920, 0x0900, 0x1100, 0x6100 }, 0xBDE7, 12, 0, 12, 0 },  // 界
+    { { 0x0040, 0x7FE0, 0x0880, 0x0880, 0x08A0, 0xFFF0, 0x0880, 0x0880, 0x1080, 0x1080, 0x2080, 0xC080 }, 0xBFAA, 12, 0, 12, 0 },  // 开
+    { { 0x0400, 0x0440, 0x7FE0, 0x2480, 0x1500, 0xFFF0, 0x0600, 0x0D00, 0x1480, 0x2470, 0xC420, 0x0400 }, 0xC0B4, 12, 0, 12, 0 },  // 来
+    { { 0x0000, 0x7FE0, 0x0080, 0x0100, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0A00, 0x0400 }, 0xC1CB, 12, 1, 12, 0 },  // 了
+    { { 0x0040, 0xF7E0, 0x9040, 0x9240, 0x9240, 0x93F0, 0x9010, 0xF090, 0x8FD0, 0x0020, 0x00A0, 0x0040 }, 0xC2F0, 12, 0, 12, 0 },  // 吗
+    { { 0x7FE0, 0x4020, 0x5C20, 0x47A0, 0x4020, 0x3F80, 0x2080, 0x3F80, 0x2080, 0x3F80, 0x2080, 0x3F80 }, 0xC3B0, 12, 0, 12, 0 },  // 冒
+    { { 0x1200, 0x1200, 0x27F0, 0x2420, 0x6940, 0xA100, 0x2540, 0x2520, 0x2910, 0x3110, 0x2500, 0x2200 }, 0xC4E3, 12, 0, 12, 0 },  // 你
+    { { 0x2100, 0x2100, 0x2240, 0xFA20, 0x2FF0, 0x2810, 0x4BE0, 0x5220, 0x5220, 0x3220, 0x4BE0, 0x8220 }, 0xCABC, 12, 0, 12, 0 },  // 始
+    { { 0x0440, 0x2440, 0x2440, 0x2440, 0xFFF0, 0x2440, 0x2440, 0x2440, 0x27C0, 0x2440, 0x2000, 0x3FF0 }, 0xCAC0, 12, 0, 12, 0 },  // 世
+    { { 0x0100, 0xF100, 0x9280, 0xA440, 0xC830, 0xA7C0, 0x9000, 0xD520, 0xB540, 0x8540, 0x8080, 0x9FF0 }, 0xCFD5, 12, 0, 12, 0 },  // 险
+    { { 0x0020, 0xF7F0, 0x2420, 0x2520, 0x2520, 0xFD20, 0x2520, 0x2100, 0x3A80, 0xC290, 0x0490, 0x1870 }, 0xCFD6, 12, 0, 12, 0 },  // 现
+    { { 0x4200, 0x2CF0, 0x2890, 0x0890, 0x0890, 0xE890, 0x2ED0, 0x28B0, 0x2080, 0x2080, 0x5000, 0x8FF0 }, 0xD3AD, 12, 0, 12, 0 },  // 迎
+    { { 0x0400, 0x0420, 0xFFF0, 0x0800, 0x1100, 0x2100, 0x6FE0, 0xA100, 0x2100, 0x2120, 0x2FF0, 0x2000 }, 0xD4DA, 12, 0, 12, 0 },  // 在
+    { { 0x0500, 0x8480, 0x47F0, 0x0C80, 0x5480, 0x47F0, 0xC480, 0x47F0, 0x4480, 0x4480, 0x47F0, 0x0400 }, 0xD7BC, 12, 0, 12, 0 },  // 准
+};
+
+extern const ZhTextFont g_DemoFont = { g_DemoFontGlyphs, 26, 0 };
+
+// intro
+static const u16 g_DemoText_intro[27] = {
+    0x000A, 0x0017, 0x000E, 0x0007, 0x0002, 0x0001, 0x0000, 0x0014, 0x000C, 0x0004, 0x0016, 0x0018, 0x0012, 0x000B, 0x000D, 0x0013,
+    0x0012, 0x0008, 0x0011, 0x0015, 0x0003, 0x0019, 0x0006, 0x0009, 0x000F, 0x0010, 0x0005,
+};
+static const ZhTextLine g_DemoLines_intro[2] = {
+    { 0, 21, 234, 0 },
+    { 21, 6, 72, 0 },
+};
+
+extern const ZhText g_DemoTexts[DEMO_TEXT_COUNT] = {
+    { &g_DemoFont, g_DemoText_intro, g_DemoLines_intro, 27, 2, 234, 0 },
+};
@@ -0,0 +1,24 @@
+/*------------------------------------------------------------------------
+名称：Demo 预编码文本
+说明：由 ZhFont/tool/zhtext.py 从 text.txt 自动生成：预编码字符串与子集字库（26 个字形）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include "ZhFontText.h"
+
+/// <summary>
+/// text.txt 中的字符串编号。
+/// </summary>
+enum DemoTextId
+{
+    DEMO_TEXT_INTRO = 0,
+    DEMO_TEXT_COUNT = 1
+};
+
+extern const ZhTextFont g_DemoFont;
+extern const ZhText g_DemoTexts[DEMO_TEXT_COUNT];
@@ -1,6 +1,11 @@
 #include <gba.h>
-#include "ZhFont.h"
-#include <string.h>
+#include "MemOps.h"
+#include "ZhFontType.h"
+#include "generated_font.h"
+#include "generated_text.h"
+
+// 开场文本打字机（每 6 帧一个字，A 键跳过）
+static ZhTypewriter g_IntroTyper;
 
 int main()
 {
@@ -10,16 +15,42 @@ int main()
     SetMode(MODE_3 | BG2_ON);
 
     // 清屏（画背景色）
-    for(int y = 0; y < 160; ++y) {
-        for(int x = 0; x < 240; ++x) {
-            ((volatile u16*)0x06000000)[y * 240 + x] = RGB5(10, 10, 10);
-        }
-    }
+    VramFill((void*)0x06000000, RGB5(10, 10, 10), 240 * 160 * 2);
+
+    // 文本框：左上角两行，白字黑色阴影（字符串由 text.txt 在构建期预编码，只链接用到的字形）
+    ZhTypeBox box;
+    box.canvas = 0;
+    box.face = 0;
+    box.x = 0;
+    box.y = 0;
+    box.width = 240;
+    box.height = 24;
+    box.lineHeight = 12;
+    box.linesPerPage = 2;
+    box.clearOnPage = 0;
+    box.effect = ZHBLIT_SHADOW;
+    box.color = RGB5(31, 31, 31);
+    box.background = RGB5(10, 10, 10);
+    box.effectColor = RGB5(0, 0, 0);
 
-    // 使用打字机效果显示文本
-    ZhFont_DrawUtf8Text_Typing((char*)"欢迎来到GBA世界，现在你将开始你的冒险。", 0, 0, RGB5(31, 31, 31), 6);
-    ZhFont_DrawUtf8Text_Typing((char*)"准备好了吗？", 0, 12, RGB5(31, 31, 31), 6);
+    // 右下角提示：12 像素可变宽字体（HZK12 缩到 8 像素时汉字笔画糊在一起）
+    ZhBlitStyle hint;
+    hint.color = RGB5(20, 20, 20);
+    hint.effectColor = 0;
+    hint.effect = ZHBLIT_PLAIN;
+    ZhFace_DrawUtf8Mode3(&g_DemoFace12, "A 键跳过", 240 - 4 - ZhFace_MeasureUtf8(&g_DemoFace12, "A 键跳过"), 160 - 4 - 12, &hint);
+
+    ZhType_SetSpeed(&g_IntroTyper, 1, 6);
+    ZhType_BeginText(&g_IntroTyper, &g_DemoTexts[DEMO_TEXT_INTRO], &box);
+
+    // 打字机每帧推进一次，不阻塞主循环
     while(1) {
         VBlankIntrWait();
+
+        scanKeys();
+        if(keysDown() & KEY_A) {
+            ZhType_Skip(&g_IntroTyper);
+        }
+        ZhType_Step(&g_IntroTyper);
     }
-}
\ No newline at end of file
+}
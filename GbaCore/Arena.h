@@ -0,0 +1,127 @@
+/*------------------------------------------------------------------------
+名称：线性分配器与定长对象池
+说明：为运行时数据提供 O(1) 分配：线性 Arena（整体重置）与定长块 Pool（空闲链表）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：不使用 newlib malloc；存储区由调用方提供（通常为 EWRAM_BSS 静态数组），均记录峰值占用
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 线性分配器：只能整体重置或回退到某个标记点。
+/// </summary>
+struct MemArena
+{
+    const char* name;
+    u8* base;
+    u32 capacity;
+    u32 offset;
+    u32 highWater;
+    u32 failCount;
+};
+
+/// <summary>
+/// 初始化 Arena。
+/// </summary>
+/// <param name="arena">Arena 对象</param>
+/// <param name="name">名称（用于日志）</param>
+/// <param name="storage">存储区（4 字节对齐）</param>
+/// <param name="capacity">存储区字节数</param>
+void MemArena_Init(MemArena* arena, const char* name, void* storage, u32 capacity);
+
+/// <summary>
+/// 分配一段内存（不清零）；空间不足时返回 0 并累计 failCount。
+/// </summary>
+/// <param name="bytes">字节数</param>
+/// <param name="align">对齐（2 的幂，默认 4）</param>
+void* MemArena_Alloc(MemArena* arena, u32 bytes, u32 align = 4);
+
+/// <summary>
+/// 分配并清零。
+/// </summary>
+void* MemArena_AllocZero(MemArena* arena, u32 bytes, u32 align = 4);
+
+/// <summary>
+/// 整体重置（峰值保留）。
+/// </summary>
+static inline void MemArena_Reset(MemArena* arena)
+{
+    arena->offset = 0;
+}
+
+/// <summary>
+/// 记录当前位置，之后可用 MemArena_Release 回退（用于临时缓冲）。
+/// </summary>
+static inline u32 MemArena_Mark(const MemArena* arena)
+{
+    return arena->offset;
+}
+
+static inline void MemArena_Release(MemArena* arena, u32 mark)
+{
+    if(mark <= arena->offset) {
+        arena->offset = mark;
+    }
+}
+
+/// <summary>
+/// 输出一行占用日志：当前 / 峰值 / 容量 / 失败次数。
+/// </summary>
+void MemArena_Log(const MemArena* arena);
+
+/// <summary>
+/// 定长对象池：空闲块首字保存下一空闲块地址，串成链表，分配与释放均为 O(1)。
+/// </summary>
+struct MemPool
+{
+    const char* name;
+    u8* storage;
+    void* freeHead;
+    u16 blockSize;
+    u16 blockCount;
+    u16 used;
+    u16 highWater;
+    u16 failCount;
+};
+
+/// <summary>
+/// 初始化对象池。
+/// </summary>
+/// <param name="pool">对象池</param>
+/// <param name="name">名称（用于日志）</param>
+/// <param name="storage">存储区（至少 blockSize * blockCount 字节，4 字节对齐）</param>
+/// <param name="blockSize">块大小（向上取整到 4 的倍数，至少 4，最多 65532）</param>
+/// <param name="blockCount">块数量（最多 65535）</param>
+void MemPool_Init(MemPool* pool, const char* name, void* storage, u32 blockSize, u32 blockCount);
+
+/// <summary>
+/// 取出一个块（不清零）；池满时返回 0 并累计 failCount。
+/// </summary>
+void* MemPool_Alloc(MemPool* pool);
+
+/// <summary>
+/// 归还一个块（必须来自同一对象池）。
+/// </summary>
+void MemPool_Free(MemPool* pool, void* block);
+
+/// <summary>
+/// 归还全部块（重建空闲链表，O(n)，用于切换地图时）。
+/// </summary>
+void MemPool_Reset(MemPool* pool);
+
+/// <summary>
+/// 块在池中的序号（含除法，不要在逐帧热路径里调用）。
+/// </summary>
+static inline int MemPool_IndexOf(const MemPool* pool, const void* block)
+{
+    return (int)(((const u8*)block - pool->storage) / pool->blockSize);
+}
+
+/// <summary>
+/// 输出一行占用日志：当前 / 峰值 / 容量 / 失败次数。
+/// </summary>
+void MemPool_Log(const MemPool* pool);
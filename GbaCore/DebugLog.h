@@ -0,0 +1,53 @@
+/*------------------------------------------------------------------------
+名称：调试日志
+说明：通过 mGBA 调试寄存器输出文本日志，供基准测试、性能统计与 debug 配置下的断言使用
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：真机或不支持的模拟器上调用为空操作
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 日志级别（与 mGBA 调试寄存器约定一致）。
+/// </summary>
+enum DebugLogLevel
+{
+    DEBUGLOG_FATAL = 0,
+    DEBUGLOG_ERROR = 1,
+    DEBUGLOG_WARN = 2,
+    DEBUGLOG_INFO = 3,
+    DEBUGLOG_DEBUG = 4,
+};
+
+/// <summary>
+/// 探测并开启 mGBA 调试输出。
+/// </summary>
+/// <returns>为 true 表示当前环境支持日志输出</returns>
+bool DebugLog_Init();
+
+/// <summary>
+/// 按 printf 格式输出一行日志（单行最长 255 字节）。
+/// </summary>
+/// <param name="level">日志级别</param>
+/// <param name="fmt">格式字符串</param>
+void DebugLog_Printf(DebugLogLevel level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+/// <summary>
+/// 断言失败：输出 FATAL 日志（mGBA 会暂停），随后关中断停机。
+/// </summary>
+void DebugLog_AssertFail(const char* expr, const char* file, int line) __attribute__((noreturn));
+
+#if defined(GBA_DEBUG)
+#define GBA_ASSERT(cond) \
+    do { \
+        if(!(cond)) { \
+            DebugLog_AssertFail(#cond, __FILE__, __LINE__); \
+        } \
+    } while(0)
+#else
+#define GBA_ASSERT(cond) ((void)0)
+#endif
@@ -0,0 +1,25 @@
+# ------------------------------------------------------------------------
+# GbaCore.mk：GbaCore 公共模块构建片段
+# 说明：由各工程 Makefile include，提供源文件列表、头文件路径与编译规则
+# 作者：Lion
+# 日期：2026-10-19
+# 备注：需在定义 OBJDIR 之后 include；目标文件输出到 $(OBJDIR)/gbacore
+# ------------------------------------------------------------------------
+
+# 本片段所在目录（以 / 结尾）
+GBACORE_DIR := $(dir $(lastword $(MAKEFILE_LIST)))
+
+# 公共模块源文件列表（位于 GbaCore/src）
+GBACORE_SOURCES := Arena.cpp DebugLog.cpp MemOps.cpp Profiler.cpp WaitState.cpp
+# 对应的目标文件路径
+GBACORE_OBJECTS := $(addprefix $(OBJDIR)/gbacore/,$(GBACORE_SOURCES:.cpp=.o))
+# 公共模块头文件搜索路径
+GBACORE_INCLUDES := -I$(GBACORE_DIR)
+
+# 规则：编译公共模块源文件到 obj/gbacore
+$(OBJDIR)/gbacore/%.o: $(GBACORE_DIR)src/%.cpp
+	@mkdir -p $(dir $@)
+	$(CXX) $(CXXFLAGS) -c $< -o $@
+
+# 内存填充与复制：热点函数都在 IWRAM，以 ARM 模式编译
+$(OBJDIR)/gbacore/MemOps.o: CXXFLAGS += $(ARM_CFLAGS) $(HOT_CFLAGS)
@@ -0,0 +1,60 @@
+/*------------------------------------------------------------------------
+名称：内存填充与复制
+说明：按字节数与对齐在 DMA3、CpuFastSet、IWRAM 中的 ARM ldmia/stmia 循环与逐字循环之间选择后端
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：VRAM / 调色板 / OAM 不能按字节写，Vram* 接口以半字为最小单位并处理首尾不足 32 位的部分
+      自动选择的阈值见 MemOps.cpp，各后端的实测吞吐见 CityGame 的 mem 基准
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 填充 / 复制后端（MemFill32_With / MemCopy32_With 指定，供基准对比）。
+/// </summary>
+enum MemBackend
+{
+    MEM_BACKEND_CPU = 0,    // 逐字 32 位循环
+    MEM_BACKEND_DMA,        // DMA3 32 位（填充为固定源地址）
+    MEM_BACKEND_FASTSET,    // BIOS CpuFastSet（32 字节整块，余下部分逐字）
+    MEM_BACKEND_STMIA,      // IWRAM 中的 ARM 循环，每次 ldmia/stmia 8 个寄存器
+    MEM_BACKEND_COUNT
+};
+
+/// <summary>
+/// 以 32 位值填充（dst 4 字节对齐，bytes 为 4 的倍数）。
+/// </summary>
+void MemFill32(void* dst, u32 value, u32 bytes);
+
+/// <summary>
+/// 32 位复制（dst / src 4 字节对齐，bytes 为 4 的倍数，区域不重叠）。
+/// </summary>
+void MemCopy32(void* dst, const void* src, u32 bytes);
+
+/// <summary>
+/// 以 16 位值填充 VRAM / 调色板 / OAM（dst 2 字节对齐，bytes 为 2 的倍数）。
+/// </summary>
+void VramFill(void* dst, u16 value, u32 bytes);
+
+/// <summary>
+/// 复制到 VRAM / 调色板 / OAM（dst / src 2 字节对齐，bytes 为 2 的倍数）；两者对 4 取余不同时只能逐半字，用 DMA3 16 位。
+/// </summary>
+void VramCopy(void* dst, const void* src, u32 bytes);
+
+/// <summary>
+/// 用指定后端填充（要求同 MemFill32）。
+/// </summary>
+void MemFill32_With(MemBackend backend, void* dst, u32 value, u32 bytes);
+
+/// <summary>
+/// 用指定后端复制（要求同 MemCopy32）。
+/// </summary>
+void MemCopy32_With(MemBackend backend, void* dst, const void* src, u32 bytes);
+
+/// <summary>
+/// 后端名称（用于日志）。
+/// </summary>
+const char* MemBackend_Name(MemBackend backend);
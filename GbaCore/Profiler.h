@@ -0,0 +1,119 @@
+/*------------------------------------------------------------------------
+名称：性能统计
+说明：基于 Timer2/Timer3 级联的 CPU 周期计数器，以及按帧汇总的计时区段与计数器
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：Timer0/Timer1 已被 BGM 占用；区段宏仅在定义 GBA_PROFILE 时生效
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+/// <summary>
+/// 一帧的 CPU 周期数（228 行 x 1232 周期）。
+/// </summary>
+static const u32 g_CyclesPerFrame = 280896;
+
+/// <summary>
+/// 一条扫描线的 CPU 周期数。
+/// </summary>
+static const u32 g_CyclesPerScanline = 1232;
+
+/// <summary>
+/// 计时区段：累计本帧与统计窗口内的周期数。
+/// </summary>
+struct ProfileZone
+{
+    const char* name;
+    u32 start;
+    u32 frameCycles;
+    u32 windowCycles;
+    u32 windowMax;
+    u32 calls;
+    ProfileZone* next;
+    bool registered;
+};
+
+/// <summary>
+/// 计数器：累计本帧与统计窗口内的事件次数。
+/// </summary>
+struct ProfileCounter
+{
+    const char* name;
+    u32 frameValue;
+    u32 windowValue;
+    u32 windowMax;
+    ProfileCounter* next;
+    bool registered;
+};
+
+/// <summary>
+/// 启动 Timer2（F/1）+ Timer3（级联）作为 32 位周期计数器。
+/// </summary>
+void Profiler_Init();
+
+/// <summary>
+/// 读取当前周期计数（约 17 秒回绕一次，差值运算不受影响）。
+/// </summary>
+/// <returns>自 Profiler_Init 起的 CPU 周期数</returns>
+static inline u32 Profiler_Cycles()
+{
+    u32 hi = REG_TM3CNT_L;
+    u32 lo = REG_TM2CNT_L;
+    const u32 hi2 = REG_TM3CNT_L;
+    if(hi != hi2) {
+        // 两次读取之间低 16 位发生了溢出，以新的高位为准重读低位
+        hi = hi2;
+        lo = REG_TM2CNT_L;
+    }
+    return (hi << 16) | lo;
+}
+
+void Profiler_ZoneBegin(ProfileZone* zone);
+void Profiler_ZoneEnd(ProfileZone* zone);
+void Profiler_CounterAdd(ProfileCounter* counter, u32 value);
+
+/// <summary>
+/// 设置统计窗口长度，窗口结束时通过 DebugLog 输出一次汇总。
+/// </summary>
+/// <param name="frames">窗口帧数（默认 60）</param>
+void Profiler_SetReportInterval(u32 frames);
+
+/// <summary>
+/// 帧结束：把本帧数据并入统计窗口，窗口满时输出报告并清零。
+/// </summary>
+void Profiler_EndFrame();
+
+/// <summary>
+/// 作用域计时：构造时开始、析构时结束。
+/// </summary>
+class ProfileScope
+{
+public:
+    explicit ProfileScope(ProfileZone* zone) : m_zone(zone) { Profiler_ZoneBegin(zone); }
+    ~ProfileScope() { Profiler_ZoneEnd(m_zone); }
+
+private:
+    ProfileZone* m_zone;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if defined(GBA_PROFILE)
+#define PROFILE_SCOPE(zoneName) \
+    static ProfileZone PROFILE_CONCAT(s_profileZone, __LINE__) = { zoneName, 0, 0, 0, 0, 0, 0, false }; \
+    ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(&PROFILE_CONCAT(s_profileZone, __LINE__))
+#define PROFILE_COUNT(counterName, value) \
+    do { \
+        static ProfileCounter s_profileCounter = { counterName, 0, 0, 0, 0, false }; \
+        Profiler_CounterAdd(&s_profileCounter, (u32)(value)); \
+    } while(0)
+#define PROFILE_FRAME_END() Profiler_EndFrame()
+#else
+#define PROFILE_SCOPE(zoneName) ((void)0)
+#define PROFILE_COUNT(counterName, value) ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#endif
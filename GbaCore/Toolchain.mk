@@ -0,0 +1,64 @@
+# ------------------------------------------------------------------------
+# Toolchain.mk：工具链发现与构建配置（release / profile / debug）
+# 说明：由各工程 Makefile 在开头 include，提供 CC/CXX/OBJCOPY、CFLAGS、LDFLAGS 与体积报告
+# 作者：Lion
+# 日期：2026-10-19
+# 备注：工具链路径取自环境变量 DEVKITARM / DEVKITPRO（devkitPro 安装时设置）
+# ------------------------------------------------------------------------
+
+# 工具链路径：优先使用环境变量，未设置时回退到 devkitPro 在 Linux 上的默认安装位置
+DEVKITPRO ?= /opt/devkitpro
+DEVKITARM ?= $(DEVKITPRO)/devkitARM
+LIBGBA ?= $(DEVKITPRO)/libgba
+
+ifneq ($(MAKECMDGOALS),clean)
+ifeq ($(wildcard $(DEVKITARM)/bin),)
+$(error 找不到 devkitARM：请设置环境变量 DEVKITARM（当前为 $(DEVKITARM)）)
+endif
+endif
+
+# 工具链命令
+PREFIX := $(DEVKITARM)/bin/arm-none-eabi-
+CC := $(PREFIX)gcc
+CXX := $(PREFIX)g++
+OBJCOPY := $(PREFIX)objcopy
+SIZE := $(PREFIX)size
+PYTHON ?= python3
+
+# 构建配置：make PROFILE=release（默认）| profile | debug
+#   release：-O2 + LTO + 链接时剔除未用节，定义 NDEBUG
+#   profile：同 release，额外定义 GBA_PROFILE 打开 PROFILE_SCOPE/PROFILE_COUNT 计时区段
+#   debug  ：-Og -g，不做 LTO，定义 GBA_DEBUG 打开 GBA_ASSERT
+PROFILE ?= release
+
+ifeq ($(PROFILE),release)
+PROFILE_CFLAGS := -O2 -flto
+PROFILE_DEFINES := -DNDEBUG
+PROFILE_LDFLAGS := -O2 -flto -Wl,--gc-sections
+HOT_CFLAGS := -O3
+else ifeq ($(PROFILE),profile)
+PROFILE_CFLAGS := -O2 -flto
+PROFILE_DEFINES := -DNDEBUG -DGBA_PROFILE
+PROFILE_LDFLAGS := -O2 -flto -Wl,--gc-sections
+HOT_CFLAGS := -O3
+else ifeq ($(PROFILE),debug)
+PROFILE_CFLAGS := -Og -g
+PROFILE_DEFINES := -DGBA_DEBUG
+PROFILE_LDFLAGS := -g -Wl,--gc-sections
+HOT_CFLAGS :=
+else
+$(error 未知的 PROFILE=$(PROFILE)，可选 release / profile / debug)
+endif
+
+# 基本编译选项：生成 Thumb 指令，并将每个函数/数据放入单独节以便链接时剔除
+ARCH := -mthumb -mthumb-interwork
+CFLAGS := $(ARCH) $(PROFILE_CFLAGS) -ffunction-sections -fdata-sections -Wall $(PROFILE_DEFINES)
+
+# ARM 模式编译选项：只用于全部热点函数都放在 IWRAM（IWRAM_CODE）的文件，ROM 为 16 位总线，ARM 代码放 ROM 反而更慢
+ARM_CFLAGS := -marm
+
+# 链接器标志：使用 gba.specs 以生成符合 GBA 的可执行格式
+LDFLAGS := $(ARCH) $(PROFILE_LDFLAGS) -specs=gba.specs
+
+# 体积报告脚本：按地址段统计 ROM / IWRAM / EWRAM 占用
+MEM_REPORT := $(PYTHON) $(dir $(lastword $(MAKEFILE_LIST)))tools/mem_report.py
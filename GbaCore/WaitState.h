@@ -0,0 +1,67 @@
+/*------------------------------------------------------------------------
+名称：卡带等待周期配置
+说明：设置 REG_WAITCNT（ROM/SRAM 等待周期与预取缓冲），并在启动时校验后回退
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：BIOS 默认 WAITCNT=0（WS0 4/2，无预取），所有 ROM 资源读取都受其影响
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#ifndef REG_WAITCNT
+#define REG_WAITCNT (*(volatile u16*)0x04000204)
+#endif
+
+// WAITCNT 位定义（N=首次访问，S=连续访问）
+#define WAITCNT_SRAM_8 0x0003
+#define WAITCNT_WS0_N4 0x0000
+#define WAITCNT_WS0_N3 0x0004
+#define WAITCNT_WS0_N2 0x0008
+#define WAITCNT_WS0_S2 0x0000
+#define WAITCNT_WS0_S1 0x0010
+#define WAITCNT_WS2_N8 0x0300
+#define WAITCNT_PREFETCH 0x4000
+
+/// <summary>
+/// 等待周期档位。
+/// </summary>
+enum WaitStateProfile
+{
+    WAITSTATE_BIOS = 0,  // 0x0000：BIOS 默认，WS0 4/2，无预取
+    WAITSTATE_SAFE = 1,  // 0x4303：WS0 4/2 + 预取，兼容任何卡带
+    WAITSTATE_FAST = 2,  // 0x4317：WS0 3/1 + 预取，官方卡带标准设置
+    WAITSTATE_TURBO = 3, // 0x431B：WS0 2/1 + 预取，部分烧录卡不支持
+    WAITSTATE_COUNT = 4,
+};
+
+/// <summary>
+/// 获取档位对应的 WAITCNT 值。
+/// </summary>
+u16 WaitState_GetValue(WaitStateProfile profile);
+
+/// <summary>
+/// 获取档位名称（用于日志）。
+/// </summary>
+const char* WaitState_GetName(WaitStateProfile profile);
+
+/// <summary>
+/// 直接写入 WAITCNT，不做校验。
+/// </summary>
+void WaitState_Apply(WaitStateProfile profile);
+
+/// <summary>
+/// 启动配置：尝试目标档位，读回 ROM 头与资源数据并与 BIOS 档位下的结果比对，失败则回退到 SAFE。
+/// </summary>
+/// <param name="preferred">期望档位（默认应使用 WAITSTATE_FAST）</param>
+/// <param name="probe">用于校验的 ROM 数据（4 字节对齐，可为 0）</param>
+/// <param name="probeBytes">校验数据字节数</param>
+/// <returns>最终生效的档位</returns>
+WaitStateProfile WaitState_Init(WaitStateProfile preferred, const void* probe, u32 probeBytes);
+
+/// <summary>
+/// 获取当前生效的档位。
+/// </summary>
+WaitStateProfile WaitState_Current();
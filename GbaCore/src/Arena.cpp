@@ -0,0 +1,129 @@
+/*------------------------------------------------------------------------
+名称：线性分配器与定长对象池
+说明：MemArena / MemPool 实现
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：debug 配置下对未对齐存储、越界释放等误用做断言
+------------------------------------------------------------------------*/
+
+#include "Arena.h"
+#include "DebugLog.h"
+
+#include <string.h>
+
+void MemArena_Init(MemArena* arena, const char* name, void* storage, u32 capacity)
+{
+    GBA_ASSERT(((u32)storage & 3) == 0);
+
+    arena->name = name;
+    arena->base = (u8*)storage;
+    arena->capacity = capacity;
+    arena->offset = 0;
+    arena->highWater = 0;
+    arena->failCount = 0;
+}
+
+void* MemArena_Alloc(MemArena* arena, u32 bytes, u32 align)
+{
+    GBA_ASSERT(align != 0 && (align & (align - 1)) == 0);
+
+    const u32 start = (arena->offset + (align - 1)) & ~(align - 1);
+    if(start > arena->capacity || bytes > arena->capacity - start) {
+        arena->failCount++;
+        return 0;
+    }
+
+    arena->offset = start + bytes;
+    if(arena->offset > arena->highWater) {
+        arena->highWater = arena->offset;
+    }
+    return arena->base + start;
+}
+
+void* MemArena_AllocZero(MemArena* arena, u32 bytes, u32 align)
+{
+    void* p = MemArena_Alloc(arena, bytes, align);
+    if(p != 0) {
+        memset(p, 0, bytes);
+    }
+    return p;
+}
+
+void MemArena_Log(const MemArena* arena)
+{
+    DebugLog_Printf(DEBUGLOG_INFO, "[mem] arena %-8s used %6lu  peak %6lu / %6lu B  fail %lu",
+                    arena->name, (unsigned long)arena->offset, (unsigned long)arena->highWater,
+                    (unsigned long)arena->capacity, (unsigned long)arena->failCount);
+}
+
+void MemPool_Init(MemPool* pool, const char* name, void* storage, u32 blockSize, u32 blockCount)
+{
+    GBA_ASSERT(((u32)storage & 3) == 0);
+    GBA_ASSERT(blockCount > 0 && blockCount <= 0xFFFF);
+
+    if(blockSize < 4) {
+        blockSize = 4;
+    }
+    blockSize = (blockSize + 3) & ~3u;
+    // blockSize / blockCount 以 u16 保存
+    GBA_ASSERT(blockSize <= 0xFFFF);
+
+    pool->name = name;
+    pool->storage = (u8*)storage;
+    pool->blockSize = (u16)blockSize;
+    pool->blockCount = (u16)blockCount;
+    pool->highWater = 0;
+    pool->failCount = 0;
+
+    MemPool_Reset(pool);
+}
+
+void MemPool_Reset(MemPool* pool)
+{
+    // 从后往前串链，使分配顺序与地址顺序一致
+    void* next = 0;
+    for(int i = (int)pool->blockCount - 1; i >= 0; i--) {
+        void** block = (void**)(pool->storage + (u32)i * pool->blockSize);
+        *block = next;
+        next = block;
+    }
+    pool->freeHead = next;
+    pool->used = 0;
+}
+
+void* MemPool_Alloc(MemPool* pool)
+{
+    void** block = (void**)pool->freeHead;
+    if(block == 0) {
+        pool->failCount++;
+        return 0;
+    }
+
+    pool->freeHead = *block;
+    pool->used++;
+    if(pool->used > pool->highWater) {
+        pool->highWater = pool->used;
+    }
+    return block;
+}
+
+void MemPool_Free(MemPool* pool, void* block)
+{
+    if(block == 0) {
+        return;
+    }
+
+    GBA_ASSERT((u8*)block >= pool->storage && (u8*)block < pool->storage + (u32)pool->blockSize * pool->blockCount);
+    GBA_ASSERT(pool->used > 0);
+
+    *(void**)block = pool->freeHead;
+    pool->freeHead = block;
+    pool->used--;
+}
+
+void MemPool_Log(const MemPool* pool)
+{
+    DebugLog_Printf(DEBUGLOG_INFO, "[mem] pool  %-8s used %6u  peak %6u / %6u x %u B  fail %u",
+                    pool->name, pool->used, pool->highWater, pool->blockCount, pool->blockSize, pool->failCount);
+}
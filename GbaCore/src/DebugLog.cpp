@@ -0,0 +1,52 @@
+/*------------------------------------------------------------------------
+名称：调试日志
+说明：mGBA 调试寄存器日志输出实现
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：0x04FFF780 写 0xC0DE 开启，读回 0x1DEA 表示支持
+------------------------------------------------------------------------*/
+
+#include "DebugLog.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+static volatile u16* const g_MgbaDebugEnable = (volatile u16*)0x04FFF780;
+static volatile u16* const g_MgbaDebugFlags = (volatile u16*)0x04FFF700;
+static char* const g_MgbaDebugString = (char*)0x04FFF600;
+
+static bool g_DebugLogReady = false;
+
+bool DebugLog_Init()
+{
+    *g_MgbaDebugEnable = 0xC0DE;
+    g_DebugLogReady = (*g_MgbaDebugEnable == 0x1DEA);
+    return g_DebugLogReady;
+}
+
+void DebugLog_Printf(DebugLogLevel level, const char* fmt, ...)
+{
+    if(!g_DebugLogReady) {
+        return;
+    }
+
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(g_MgbaDebugString, 256, fmt, args);
+    va_end(args);
+
+    // bit8 表示提交一行
+    *g_MgbaDebugFlags = (u16)((level & 7) | 0x100);
+}
+
+void DebugLog_AssertFail(const char* expr, const char* file, int line)
+{
+    REG_IME = 0;
+
+    DebugLog_Init();
+    DebugLog_Printf(DEBUGLOG_FATAL, "assert failed: %s (%s:%d)", expr, file, line);
+
+    while(1) {
+    }
+}
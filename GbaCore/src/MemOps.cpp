@@ -0,0 +1,252 @@
+/*------------------------------------------------------------------------
+名称：内存填充与复制
+说明：DMA3 / CpuFastSet / ARM ldmia-stmia / 逐字循环四种后端与按大小自动选择
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：本文件以 ARM 模式编译，热点函数都放在 IWRAM
+      自动选择：不足 32 字节逐字；填充用 stmia（只写不读，比 DMA 固定源填充少一半总线访问）；
+      复制不足 MEMOPS_DMA_COPY_MIN 字节用 ldmia/stmia，更大的用 DMA3（省去取指，启动开销摊薄）
+------------------------------------------------------------------------*/
+
+#include "MemOps.h"
+
+// 复制改用 DMA3 的最小字节数
+#define MEMOPS_DMA_COPY_MIN 512
+// 单次 DMA 的最大传输单元数（计数字段 16 位）
+#define MEMOPS_DMA_CHUNK_WORDS 0x8000
+
+// DMA 填充的源（源地址固定）
+static volatile u32 g_MemFillSource;
+
+static const char* const g_MemBackendNames[MEM_BACKEND_COUNT] = {
+    "cpu",
+    "dma",
+    "fastset",
+    "stmia",
+};
+
+/// <summary>
+/// 逐字填充（volatile，避免被编译器替换为 memset 调用）。
+/// </summary>
+IWRAM_CODE static void CpuFill32(u32* dst, u32 value, u32 words)
+{
+    volatile u32* p = dst;
+    for(u32 i = 0; i < words; i++) {
+        p[i] = value;
+    }
+}
+
+IWRAM_CODE static void CpuCopy32(u32* dst, const u32* src, u32 words)
+{
+    volatile u32* p = dst;
+    for(u32 i = 0; i < words; i++) {
+        p[i] = src[i];
+    }
+}
+
+/// <summary>
+/// 每次 stmia 写 8 个寄存器（32 字节）。
+/// </summary>
+IWRAM_CODE static void ArmFill32(u32* dst, u32 value, u32 blocks)
+{
+    register u32 r2 asm("r2") = value;
+    register u32 r3 asm("r3") = value;
+    register u32 r4 asm("r4") = value;
+    register u32 r5 asm("r5") = value;
+    register u32 r6 asm("r6") = value;
+    register u32 r7 asm("r7") = value;
+    register u32 r8 asm("r8") = value;
+    register u32 r9 asm("r9") = value;
+    asm volatile(
+        "1:\n\t"
+        "stmia %0!, {r2-r9}\n\t"
+        "subs %1, %1, #1\n\t"
+        "bne 1b"
+        : "+r"(dst), "+r"(blocks)
+        : "r"(r2), "r"(r3), "r"(r4), "r"(r5), "r"(r6), "r"(r7), "r"(r8), "r"(r9)
+        : "memory", "cc");
+}
+
+/// <summary>
+/// 每次 ldmia/stmia 搬 8 个寄存器（32 字节）。
+/// </summary>
+IWRAM_CODE static void ArmCopy32(u32* dst, const u32* src, u32 blocks)
+{
+    asm volatile(
+        "1:\n\t"
+        "ldmia %1!, {r2-r9}\n\t"
+        "stmia %0!, {r2-r9}\n\t"
+        "subs %2, %2, #1\n\t"
+        "bne 1b"
+        : "+r"(dst), "+r"(src), "+r"(blocks)
+        :
+        : "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", "memory", "cc");
+}
+
+IWRAM_CODE static void DmaFill32(u32* dst, u32 value, u32 words)
+{
+    g_MemFillSource = value;
+    while(words > 0) {
+        const u32 n = words < MEMOPS_DMA_CHUNK_WORDS ? words : MEMOPS_DMA_CHUNK_WORDS;
+        REG_DMA3CNT = 0;
+        REG_DMA3SAD = (u32)&g_MemFillSource;
+        REG_DMA3DAD = (u32)dst;
+        REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_FIXED | DMA_DST_INC | n);
+        dst += n;
+        words -= n;
+    }
+}
+
+IWRAM_CODE static void DmaCopy32(u32* dst, const u32* src, u32 words)
+{
+    while(words > 0) {
+        const u32 n = words < MEMOPS_DMA_CHUNK_WORDS ? words : MEMOPS_DMA_CHUNK_WORDS;
+        REG_DMA3CNT = 0;
+        REG_DMA3SAD = (u32)src;
+        REG_DMA3DAD = (u32)dst;
+        REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | n);
+        dst += n;
+        src += n;
+        words -= n;
+    }
+}
+
+IWRAM_CODE void MemFill32_With(MemBackend backend, void* dst, u32 value, u32 bytes)
+{
+    u32* p = (u32*)dst;
+    u32 words = bytes >> 2;
+    switch(backend) {
+        case MEM_BACKEND_DMA:
+            DmaFill32(p, value, words);
+            return;
+        case MEM_BACKEND_FASTSET:
+            if(words >= 8) {
+                const u32 source = value;
+                CpuFastSet(&source, p, FILL | (words & ~7u));
+                p += words & ~7u;
+                words &= 7;
+            }
+            break;
+        case MEM_BACKEND_STMIA:
+            if(words >= 8) {
+                ArmFill32(p, value, words >> 3);
+                p += words & ~7u;
+                words &= 7;
+            }
+            break;
+        default:
+            break;
+    }
+    CpuFill32(p, value, words);
+}
+
+IWRAM_CODE void MemCopy32_With(MemBackend backend, void* dst, const void* src, u32 bytes)
+{
+    u32* d = (u32*)dst;
+    const u32* s = (const u32*)src;
+    u32 words = bytes >> 2;
+    switch(backend) {
+        case MEM_BACKEND_DMA:
+            DmaCopy32(d, s, words);
+            return;
+        case MEM_BACKEND_FASTSET:
+            if(words >= 8) {
+                CpuFastSet(s, d, words & ~7u);
+                d += words & ~7u;
+                s += words & ~7u;
+                words &= 7;
+            }
+            break;
+        case MEM_BACKEND_STMIA:
+            if(words >= 8) {
+                ArmCopy32(d, s, words >> 3);
+                d += words & ~7u;
+                s += words & ~7u;
+                words &= 7;
+            }
+            break;
+        default:
+            break;
+    }
+    CpuCopy32(d, s, words);
+}
+
+IWRAM_CODE void MemFill32(void* dst, u32 value, u32 bytes)
+{
+    MemFill32_With(bytes < 32 ? MEM_BACKEND_CPU : MEM_BACKEND_STMIA, dst, value, bytes);
+}
+
+IWRAM_CODE void MemCopy32(void* dst, const void* src, u32 bytes)
+{
+    MemBackend backend = MEM_BACKEND_STMIA;
+    if(bytes < 32) {
+        backend = MEM_BACKEND_CPU;
+    } else if(bytes >= MEMOPS_DMA_COPY_MIN) {
+        backend = MEM_BACKEND_DMA;
+    }
+    MemCopy32_With(backend, dst, src, bytes);
+}
+
+IWRAM_CODE void VramFill(void* dst, u16 value, u32 bytes)
+{
+    volatile u16* p = (volatile u16*)dst;
+    if(((u32)p & 2) && bytes >= 2) {
+        *p++ = value;
+        bytes -= 2;
+    }
+    const u32 middle = bytes & ~3u;
+    MemFill32((void*)p, value | ((u32)value << 16), middle);
+    p += middle >> 1;
+    if(bytes & 2) {
+        *p = value;
+    }
+}
+
+IWRAM_CODE void VramCopy(void* dst, const void* src, u32 bytes)
+{
+    volatile u16* d = (volatile u16*)dst;
+    const u16* s = (const u16*)src;
+
+    // 对 4 取余不同：无法同时 32 位对齐，逐半字
+    if(((u32)d ^ (u32)s) & 2) {
+        u32 halfwords = bytes >> 1;
+        if(halfwords < 16) {
+            for(u32 i = 0; i < halfwords; i++) {
+                d[i] = s[i];
+            }
+            return;
+        }
+        while(halfwords > 0) {
+            const u32 n = halfwords < MEMOPS_DMA_CHUNK_WORDS ? halfwords : MEMOPS_DMA_CHUNK_WORDS;
+            REG_DMA3CNT = 0;
+            REG_DMA3SAD = (u32)s;
+            REG_DMA3DAD = (u32)d;
+            REG_DMA3CNT = (u32)(DMA_ENABLE | DMA16 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | n);
+            d += n;
+            s += n;
+            halfwords -= n;
+        }
+        return;
+    }
+
+    if(((u32)d & 2) && bytes >= 2) {
+        *d++ = *s++;
+        bytes -= 2;
+    }
+    const u32 middle = bytes & ~3u;
+    MemCopy32((void*)d, s, middle);
+    d += middle >> 1;
+    s += middle >> 1;
+    if(bytes & 2) {
+        *d = *s;
+    }
+}
+
+const char* MemBackend_Name(MemBackend backend)
+{
+    if((unsigned)backend >= MEM_BACKEND_COUNT) {
+        return "?";
+    }
+    return g_MemBackendNames[backend];
+}
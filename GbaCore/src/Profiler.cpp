@@ -0,0 +1,116 @@
+/*------------------------------------------------------------------------
+名称：性能统计
+说明：周期计数器、计时区段与计数器的注册、按帧汇总与日志报告
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：区段与计数器首次使用时挂入链表，无需手工注册
+------------------------------------------------------------------------*/
+
+#include "Profiler.h"
+#include "DebugLog.h"
+
+static ProfileZone* g_ProfileZones = 0;
+static ProfileCounter* g_ProfileCounters = 0;
+static u32 g_ProfileReportFrames = 60;
+static u32 g_ProfileWindowFrames = 0;
+
+void Profiler_Init()
+{
+    REG_TM2CNT_H = 0;
+    REG_TM3CNT_H = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM3CNT_L = 0;
+
+    // Timer3 先启动为级联模式，再启动 Timer2（预分频 1）
+    REG_TM3CNT_H = (u16)(TIMER_COUNT | TIMER_START);
+    REG_TM2CNT_H = (u16)(TIMER_START);
+
+    DebugLog_Init();
+}
+
+void Profiler_ZoneBegin(ProfileZone* zone)
+{
+    if(!zone->registered) {
+        zone->registered = true;
+        zone->next = g_ProfileZones;
+        g_ProfileZones = zone;
+    }
+    zone->start = Profiler_Cycles();
+}
+
+void Profiler_ZoneEnd(ProfileZone* zone)
+{
+    zone->frameCycles += Profiler_Cycles() - zone->start;
+    zone->calls++;
+}
+
+void Profiler_CounterAdd(ProfileCounter* counter, u32 value)
+{
+    if(!counter->registered) {
+        counter->registered = true;
+        counter->next = g_ProfileCounters;
+        g_ProfileCounters = counter;
+    }
+    counter->frameValue += value;
+}
+
+void Profiler_SetReportInterval(u32 frames)
+{
+    g_ProfileReportFrames = (frames == 0) ? 1 : frames;
+    g_ProfileWindowFrames = 0;
+}
+
+/// <summary>
+/// 输出统计窗口汇总：每区段平均/峰值周期与占帧百分比，每计数器总数与峰值。
+/// </summary>
+static void ReportWindow()
+{
+    const u32 frames = g_ProfileWindowFrames;
+
+    DebugLog_Printf(DEBUGLOG_INFO, "[prof] window %lu frames", (unsigned long)frames);
+
+    for(ProfileZone* zone = g_ProfileZones; zone != 0; zone = zone->next) {
+        const u32 avg = zone->windowCycles / frames;
+        // 百分比保留一位小数：avg * 1000 / 280896
+        const u32 permille = (avg * 1000) / g_CyclesPerFrame;
+        DebugLog_Printf(DEBUGLOG_INFO, "[prof] %-16s avg %6lu max %6lu cyc  %2lu.%lu%%  calls %lu",
+                        zone->name, (unsigned long)avg, (unsigned long)zone->windowMax,
+                        (unsigned long)(permille / 10), (unsigned long)(permille % 10), (unsigned long)zone->calls);
+        zone->windowCycles = 0;
+        zone->windowMax = 0;
+        zone->calls = 0;
+    }
+
+    for(ProfileCounter* counter = g_ProfileCounters; counter != 0; counter = counter->next) {
+        DebugLog_Printf(DEBUGLOG_INFO, "[prof] %-16s total %6lu max/frame %lu",
+                        counter->name, (unsigned long)counter->windowValue, (unsigned long)counter->windowMax);
+        counter->windowValue = 0;
+        counter->windowMax = 0;
+    }
+}
+
+void Profiler_EndFrame()
+{
+    for(ProfileZone* zone = g_ProfileZones; zone != 0; zone = zone->next) {
+        zone->windowCycles += zone->frameCycles;
+        if(zone->frameCycles > zone->windowMax) {
+            zone->windowMax = zone->frameCycles;
+        }
+        zone->frameCycles = 0;
+    }
+
+    for(ProfileCounter* counter = g_ProfileCounters; counter != 0; counter = counter->next) {
+        counter->windowValue += counter->frameValue;
+        if(counter->frameValue > counter->windowMax) {
+            counter->windowMax = counter->frameValue;
+        }
+        counter->frameValue = 0;
+    }
+
+    g_ProfileWindowFrames++;
+    if(g_ProfileWindowFrames >= g_ProfileReportFrames) {
+        ReportWindow();
+        g_ProfileWindowFrames = 0;
+    }
+}
@@ -0,0 +1,115 @@
+/*------------------------------------------------------------------------
+名称：卡带等待周期配置
+说明：WAITCNT 档位表、启动校验与回退（与 BIOS 档位下读到的 ROM 数据比对）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：校验函数放在 IWRAM 执行，避免在试探档位下从 ROM 取指
+------------------------------------------------------------------------*/
+
+#include "WaitState.h"
+
+static const u16 g_WaitCntValues[WAITSTATE_COUNT] = {
+    0x0000,
+    WAITCNT_SRAM_8 | WAITCNT_WS0_N4 | WAITCNT_WS0_S2 | WAITCNT_WS2_N8 | WAITCNT_PREFETCH,
+    WAITCNT_SRAM_8 | WAITCNT_WS0_N3 | WAITCNT_WS0_S1 | WAITCNT_WS2_N8 | WAITCNT_PREFETCH,
+    WAITCNT_SRAM_8 | WAITCNT_WS0_N2 | WAITCNT_WS0_S1 | WAITCNT_WS2_N8 | WAITCNT_PREFETCH,
+};
+
+static const char* const g_WaitStateNames[WAITSTATE_COUNT] = {
+    "bios 4/2",
+    "safe 4/2+pf",
+    "fast 3/1+pf",
+    "turbo 2/1+pf",
+};
+
+static WaitStateProfile g_WaitStateCurrent = WAITSTATE_BIOS;
+
+// ROM 头（0xA0..0xBF：标题、游戏码、补码校验等），任何卡带都存在
+static const volatile u32* const g_RomHeader = (const volatile u32*)0x080000A0;
+static const u32 g_RomHeaderWords = 8;
+
+u16 WaitState_GetValue(WaitStateProfile profile)
+{
+    if((unsigned)profile >= WAITSTATE_COUNT) {
+        return g_WaitCntValues[WAITSTATE_SAFE];
+    }
+    return g_WaitCntValues[profile];
+}
+
+const char* WaitState_GetName(WaitStateProfile profile)
+{
+    if((unsigned)profile >= WAITSTATE_COUNT) {
+        return "?";
+    }
+    return g_WaitStateNames[profile];
+}
+
+void WaitState_Apply(WaitStateProfile profile)
+{
+    REG_WAITCNT = WaitState_GetValue(profile);
+    g_WaitStateCurrent = profile;
+}
+
+WaitStateProfile WaitState_Current()
+{
+    return g_WaitStateCurrent;
+}
+
+/// <summary>
+/// 对 ROM 数据做 32 位累加与异或混合校验（连续读取，覆盖 S 周期路径）。
+/// </summary>
+IWRAM_CODE static u32 ChecksumRom(const volatile u32* src, u32 words)
+{
+    u32 acc = 0x12345678;
+    for(u32 i = 0; i < words; i++) {
+        acc = (acc << 5 | acc >> 27) ^ src[i];
+    }
+    return acc;
+}
+
+/// <summary>
+/// 在指定 WAITCNT 下校验 ROM 读取；全程在 IWRAM 执行，失败时先恢复 BIOS 档位再返回 ROM 代码。
+/// </summary>
+IWRAM_CODE static bool VerifyWaitCnt(u16 waitcnt, const volatile u32* probe, u32 words, u32 headerRef, u32 probeRef)
+{
+    REG_WAITCNT = waitcnt;
+
+    // 多读几遍，让预取缓冲与 N/S 周期切换都被覆盖到
+    for(int pass = 0; pass < 4; pass++) {
+        bool ok = (ChecksumRom(g_RomHeader, g_RomHeaderWords) == headerRef);
+        if(ok && words != 0) {
+            ok = (ChecksumRom(probe, words) == probeRef);
+        }
+        if(!ok) {
+            REG_WAITCNT = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+WaitStateProfile WaitState_Init(WaitStateProfile preferred, const void* probe, u32 probeBytes)
+{
+    const u16 oldIme = REG_IME;
+    REG_IME = 0;
+
+    const volatile u32* probeWords = (const volatile u32*)probe;
+    const u32 words = (probe != 0) ? (probeBytes >> 2) : 0;
+
+    // 参考值在 BIOS 默认档位下计算
+    REG_WAITCNT = g_WaitCntValues[WAITSTATE_BIOS];
+    const u32 headerRef = ChecksumRom(g_RomHeader, g_RomHeaderWords);
+    const u32 probeRef = (words != 0) ? ChecksumRom(probeWords, words) : 0;
+
+    WaitStateProfile result = WAITSTATE_SAFE;
+    if((unsigned)preferred < WAITSTATE_COUNT && VerifyWaitCnt(g_WaitCntValues[preferred], probeWords, words, headerRef, probeRef)) {
+        result = preferred;
+    } else if(!VerifyWaitCnt(g_WaitCntValues[WAITSTATE_SAFE], probeWords, words, headerRef, probeRef)) {
+        result = WAITSTATE_BIOS;
+    }
+
+    WaitState_Apply(result);
+    REG_IME = oldIme;
+    return result;
+}
@@ -0,0 +1,55 @@
+"""按地址段统计 ELF 的 ROM / IWRAM / EWRAM 占用（供 Makefile 在链接后调用）。
+
+用法：python3 mem_report.py <size 命令> <elf> <gba> <配置名>
+"""
+
+import subprocess
+import sys
+from pathlib import Path
+
+ROM_LIMIT = 32 * 1024 * 1024
+IWRAM_LIMIT = 32 * 1024
+EWRAM_LIMIT = 256 * 1024
+
+
+def _section_sizes(size_cmd: str, elf: str) -> list[tuple[str, int, int]]:
+    out = subprocess.run([size_cmd, "-A", "-d", elf], check=True, capture_output=True, text=True).stdout
+    sections: list[tuple[str, int, int]] = []
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) != 3 or not parts[1].isdigit() or not parts[2].isdigit():
+            continue
+        sections.append((parts[0], int(parts[1]), int(parts[2])))
+    return sections
+
+
+def main() -> int:
+    if len(sys.argv) != 5:
+        print(__doc__, file=sys.stderr)
+        return 2
+
+    size_cmd, elf, gba, profile = sys.argv[1:5]
+
+    iwram = 0
+    ewram = 0
+    for _name, size, addr in _section_sizes(size_cmd, elf):
+        region = addr >> 24
+        if region == 0x03:
+            iwram += size
+        elif region == 0x02:
+            ewram += size
+
+    # ROM 以最终 .gba 文件为准（已包含 .data/.iwram 的装载镜像）
+    rom = Path(gba).stat().st_size
+
+    print(
+        f"[size] {Path(gba).name} ({profile}): "
+        f"ROM {rom} B ({rom * 100 / ROM_LIMIT:.2f}%) | "
+        f"IWRAM {iwram} / {IWRAM_LIMIT} B ({iwram * 100 / IWRAM_LIMIT:.1f}%, 不含栈) | "
+        f"EWRAM {ewram} / {EWRAM_LIMIT} B ({ewram * 100 / EWRAM_LIMIT:.1f}%)"
+    )
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,34 @@
+# ------------------------------------------------------------------------
+# ZhFont.mk：ZhFont 扩展模块构建片段
+# 说明：由各工程 Makefile include，提供字库静态库路径、扩展源文件列表、头文件路径与编译规则
+# 作者：Lion
+# 日期：2026-10-19
+# 备注：需在定义 OBJDIR 之后 include；扩展模块目标文件输出到 $(OBJDIR)/zhfont
+#       扩展模块的 VRAM 填充使用 GbaCore 的 MemOps，工程需同时 include GbaCore.mk
+#       点阵数据（HZK12/ASC12）仍由预编译的 zhfont.a 提供
+# ------------------------------------------------------------------------
+
+# 本片段所在目录（以 / 结尾）
+ZHFONT_DIR := $(dir $(lastword $(MAKEFILE_LIST)))
+
+# 预编译字库静态库（Mode 3 绘制接口与点阵数据）
+FONTLIB := $(ZHFONT_DIR)zhfont.a
+
+# 扩展模块源文件列表（位于 ZhFont/src）
+ZHFONT_SOURCES := ZhFontGlyph.cpp ZhFontGbMap.cpp ZhFontCache.cpp ZhFontTile.cpp ZhFontText.cpp ZhFontLayout.cpp ZhFontType.cpp ZhFontBlit.cpp ZhFontFace.cpp ZhFontSurface.cpp
+# 对应的目标文件路径
+ZHFONT_OBJECTS := $(addprefix $(OBJDIR)/zhfont/,$(ZHFONT_SOURCES:.cpp=.o))
+# 字符串表编译器（生成预编码文本与子集字库）
+ZHFONT_TEXT_TOOL := $(ZHFONT_DIR)tool/zhtext.py
+# 字体编译器（生成多字号可变宽字体 ZhFace，依赖 zhtext.py 读取点阵）
+ZHFONT_FONT_TOOL := $(ZHFONT_DIR)tool/zhfontc.py
+# 头文件搜索路径
+ZHFONT_INCLUDES := -I$(ZHFONT_DIR)
+
+# 规则：编译扩展模块源文件到 obj/zhfont
+$(OBJDIR)/zhfont/%.o: $(ZHFONT_DIR)src/%.cpp
+	@mkdir -p $(dir $@)
+	$(CXX) $(CXXFLAGS) -c $< -o $@
+
+# 字形贴图：绘制函数全部位于 IWRAM，以 ARM 模式 + 热点优化编译
+$(OBJDIR)/zhfont/ZhFontBlit.o: CXXFLAGS += $(ARM_CFLAGS) $(HOT_CFLAGS)
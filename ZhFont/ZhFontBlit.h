@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 位图字形贴图
+说明：把已解码字形按 4 像素一组查表展开成 32 位写入掩码写入位图帧缓冲（默认 Mode 3），支持裁剪矩形与单遍阴影/描边
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：热点函数位于 IWRAM 并以 ARM 模式编译；每行只处理含像素的 4 像素组，整字对（2 像素）全覆盖时直接写，否则读改写
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ZhFontCache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 目标像素格式：16bpp BGR555（Mode 3 / Mode 5）/ 8bpp 调色板索引（Mode 4） */
+#define ZHBLIT_FORMAT_16BPP 0
+#define ZHBLIT_FORMAT_8BPP 1
+
+/** 效果：无 / 右下 1 像素阴影 / 8 邻域 1 像素描边 */
+#define ZHBLIT_PLAIN 0
+#define ZHBLIT_SHADOW 1
+#define ZHBLIT_OUTLINE 2
+
+/**
+ * @brief 绘制样式
+ */
+typedef struct ZhBlitStyle
+{
+    u16 color;              /**< 文字颜色（16bpp 为 BGR555，8bpp 为调色板索引） */
+    u16 effectColor;        /**< 阴影 / 描边颜色 */
+    u8 effect;              /**< ZHBLIT_* */
+    u8 reserved[3];
+} ZhBlitStyle;
+
+/**
+ * @brief 设置绘制目标（裁剪恢复为整个目标）
+ * @param base 帧缓冲地址（32 位对齐，每行字节数须为 4 的倍数）
+ * @param width 宽度（像素，即行距）
+ * @param height 高度（像素）
+ * @param format ZHBLIT_FORMAT_*
+ */
+void ZhBlit_SetTarget(u32 base, int width, int height, int format);
+
+/**
+ * @brief 恢复默认目标：Mode 3 帧缓冲（240x160 16bpp）
+ */
+void ZhBlit_ResetTarget(void);
+
+/**
+ * @brief 设置裁剪矩形 [x0, x1) x [y0, y1)（自动限制在目标内；默认整个目标）
+ */
+void ZhBlit_SetClip(int x0, int y0, int x1, int y1);
+
+/**
+ * @brief 恢复为整个目标的裁剪
+ */
+void ZhBlit_ResetClip(void);
+
+/**
+ * @brief 绘制一个已解码字形（左上角像素坐标，可部分或完全在裁剪矩形外）
+ * @return 前进宽度（像素）
+ */
+int ZhBlit_Glyph(const ZhGlyph* glyph, int x, int y, const ZhBlitStyle* style);
+
+/**
+ * @brief 绘制 UTF-8 文本（字形经缓存取得；遇到 \n 或字符串结束停止）
+ * @return 结束位置 X（像素）
+ */
+int ZhBlit_Utf8(const char* utf8, int x, int y, const ZhBlitStyle* style);
+
+#ifdef __cplusplus
+}
+#endif
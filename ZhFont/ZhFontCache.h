@@ -0,0 +1,93 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 字形缓存
+说明：按码点缓存已解码的字形（点阵行、前进宽度、非空行范围），LRU 淘汰，统计命中/未命中
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：缓存位于 EWRAM；命中时跳过 UTF-8→GB2312 映射与 ROM 点阵读取
+      按 Unicode 查找时使用 ZhFace_Select 选中的字体（未选中为内置 12 像素字库），键中带字体标记，切换字体不必清空缓存
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ZhFontGlyph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 缓存容量（字形数） */
+#define ZHCACHE_ENTRIES 128
+
+/** 已解码字形的最大行数（内置字库 12 行，ZhFontFace 字体最大 16 行） */
+#define ZHGLYPH_MAX_ROWS 16
+
+/**
+ * @brief 已解码的字形（40 字节）
+ */
+typedef struct ZhGlyph
+{
+    u16 rows[ZHGLYPH_MAX_ROWS];     /**< 点阵行，最高位为最左像素（top 之前、bottom 之后为 0） */
+    u16 code;                       /**< 字形码（见 ZhFontGlyph.h） */
+    u8 advance;                     /**< 前进宽度（像素） */
+    u8 top;                         /**< 第一个非空行 */
+    u8 bottom;                      /**< 最后一个非空行 + 1（top == bottom 表示空白字形） */
+    u8 reserved;
+} ZhGlyph;
+
+/**
+ * @brief 缓存统计
+ */
+typedef struct ZhCacheStats
+{
+    u32 hits;
+    u32 misses;
+    u32 evictions;
+} ZhCacheStats;
+
+/**
+ * @brief 按 Unicode 码点取字形（当前字体；内置字库未命中时映射到 GB2312 并从字库读取）
+ * @return 字形；指针在下一次未命中之前有效
+ */
+const ZhGlyph* ZhCache_LookupUnicode(u32 codepoint);
+
+/**
+ * @brief 按字形码（ASCII 或 GB2312）取字形（总是内置 12 像素字库）
+ * @return 字形；指针在下一次未命中之前有效
+ */
+const ZhGlyph* ZhCache_LookupCode(u16 code);
+
+/**
+ * @brief 从 UTF-8 字符串读取一个字符并取得字形
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @return 字形；字符串结束返回 0
+ */
+const ZhGlyph* ZhCache_NextUtf8(const char** text);
+
+/**
+ * @brief 从 GB2312 字符串读取一个字符并取得字形
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @return 字形；字符串结束返回 0
+ */
+const ZhGlyph* ZhCache_NextGb2312(const char** text);
+
+/**
+ * @brief 清空缓存（不清统计）
+ */
+void ZhCache_Flush(void);
+
+/**
+ * @brief 读取统计
+ */
+void ZhCache_GetStats(ZhCacheStats* out);
+
+/**
+ * @brief 清零统计
+ */
+void ZhCache_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,113 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 可变宽字体
+说明：由 tool/zhfontc.py 在构建期生成的多字号紧凑字体：逐字前进宽度与包围盒、按码点排序的索引、按位紧排的点阵
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：字体以 ZhFace 句柄引用；ZhFace_Select 选中后，字形缓存、排版与 UTF-8 绘制接口都使用该字体，选 0 恢复内置 12 像素字库
+      点阵只保存包围盒内的像素（每行 width 位，行间不补齐，每字从字节边界开始）；每 16 字记录一次点阵起始
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ZhFontBlit.h"
+#include "ZhFontCache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 每多少个字形记录一次点阵起始偏移 */
+#define ZHFACE_BLOCK_GLYPHS 16
+/** 可同时带标记驻留在字形缓存中的字体数（超出时清空缓存重新分配标记） */
+#define ZHFACE_TAGS 15
+
+/**
+ * @brief 单字度量（4 字节）
+ */
+typedef struct ZhFaceMetric
+{
+    u8 advance;             /**< 前进宽度（像素） */
+    u8 origin;              /**< 包围盒左上角：(x << 4) | y，相对字形单元左上角 */
+    u8 width;               /**< 包围盒宽度（0 表示空白字形，无点阵） */
+    u8 height;              /**< 包围盒高度 */
+} ZhFaceMetric;
+
+/**
+ * @brief 字体句柄
+ */
+typedef struct ZhFace
+{
+    const u16* codes;               /**< 升序排列的 Unicode 码点（仅 BMP） */
+    const ZhFaceMetric* metrics;    /**< 与 codes 一一对应 */
+    const u32* blocks;              /**< 第 i * ZHFACE_BLOCK_GLYPHS 个字形的点阵起始（字节） */
+    const u8* bitmap;               /**< 紧排点阵 */
+    u16 count;                      /**< 字形数 */
+    u8 size;                        /**< 字号：字形单元高度（像素，不超过 ZHGLYPH_MAX_ROWS） */
+    u8 missingAdvance;              /**< 缺字的前进宽度（不绘制） */
+} ZhFace;
+
+/**
+ * @brief 按码点查找字形（二分查找）
+ * @return 字形序号；没有该字返回 -1
+ */
+int ZhFace_Find(const ZhFace* face, u32 codepoint);
+
+/**
+ * @brief 码点的前进宽度（face 为 0 时按内置字库：ASCII 6 像素，其它 12 像素）
+ */
+int ZhFace_Advance(const ZhFace* face, u32 codepoint);
+
+/**
+ * @brief 把码点对应的字形解码为 ZhGlyph（缺字为空白字形，按 missingAdvance 前进）
+ * @note out->code 为码点（ASCII 与字形码一致，可用于判断 '\n'）
+ */
+void ZhFace_DecodeGlyph(const ZhFace* face, u32 codepoint, ZhGlyph* out);
+
+/**
+ * @brief 从 UTF-8 字符串读取一个字符并解码到调用方提供的字形（不经缓存）
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @return 为 0 表示字符串结束
+ */
+int ZhFace_NextUtf8(const ZhFace* face, const char** text, ZhGlyph* out);
+
+/**
+ * @brief 计算 UTF-8 文本宽度（到 \n 或字符串结束；face 为 0 时同 ZhFont_MeasureUtf8）
+ * @return 像素宽度
+ */
+int ZhFace_MeasureUtf8(const ZhFace* face, const char* utf8);
+
+/**
+ * @brief 在 Mode 3 帧缓冲绘制一行 UTF-8 文本（直接解码，不经缓存；遇到 \n 或字符串结束停止）
+ * @return 结束位置 X（像素）
+ */
+int ZhFace_DrawUtf8Mode3(const ZhFace* face, const char* utf8, int x, int y, const ZhBlitStyle* style);
+
+/**
+ * @brief 选中字体（0 为内置 12 像素字库），供字形缓存、排版与 UTF-8 绘制接口使用
+ * @return 之前选中的字体（临时切换后交给 ZhFace_Restore 恢复）
+ * @note 缓存标记用完（同时用过 ZHFACE_TAGS 种以上字体）时会清空字形缓存，之前取得的 ZhGlyph 指针全部失效
+ */
+const ZhFace* ZhFace_Select(const ZhFace* face);
+
+/**
+ * @brief 恢复 ZhFace_Select 返回的之前字体；从不清空字形缓存，恢复后之前取得的 ZhGlyph 指针仍然有效
+ * @note 只应传入最近一次 ZhFace_Select 的返回值；传入其它字体且标记已用完时退回内置字库
+ */
+void ZhFace_Restore(const ZhFace* face);
+
+/**
+ * @brief 当前选中的字体（0 为内置字库）
+ */
+const ZhFace* ZhFace_Current(void);
+
+/**
+ * @brief 当前字体的缓存标记（内置字库为 0，其它为 1 ~ ZHFACE_TAGS）
+ */
+u32 ZhFace_CurrentTag(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 字形访问
+说明：UTF-8 / GB2312 解码为字形码（含点阵指针与前进宽度），以及 Unicode→GB2312 常数时间映射，供各绘制后端共用
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：字形码约定：ASCII 为原值（< 0x80），GB2312 为 (区 << 8) | 位，无字形为 ZHFONT_CODE_MISSING
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 字库中找不到的字符（不绘制，按全角前进） */
+#define ZHFONT_CODE_MISSING 0xFFFF
+
+/** 字形高度（像素） */
+#define ZHFONT_GLYPH_HEIGHT 12
+/** 半角（ASCII）与全角前进宽度（像素） */
+#define ZHFONT_ADVANCE_HALF 6
+#define ZHFONT_ADVANCE_FULL 12
+
+/** 点阵格式（即每行字节数）：无点阵、ASC12（1 字节/行）、HZK12（2 字节/行，大端） */
+#define ZHFONT_FORMAT_NONE 0
+#define ZHFONT_FORMAT_ASC12 1
+#define ZHFONT_FORMAT_HZK12 2
+
+/**
+ * @brief 解码结果：字形码、ROM 点阵指针与前进宽度
+ */
+typedef struct ZhGlyphRef
+{
+    const u8* bitmap;   /**< 12 行点阵（最高位为最左像素）；没有可绘制点阵时为 0 */
+    u16 code;           /**< 字形码 */
+    u8 advance;         /**< 前进宽度（像素） */
+    u8 format;          /**< ZHFONT_FORMAT_* */
+} ZhGlyphRef;
+
+/**
+ * @brief 从 UTF-8 字符串读取一个 Unicode 码点（非法序列返回 0xFFFD）
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @return 码点；字符串结束返回 0
+ */
+u32 ZhFont_NextUtf8Codepoint(const char** text);
+
+/**
+ * @brief 从 UTF-8 字符串读取一个字符并转换为字形码
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @return 字形码；字符串结束返回 0
+ */
+u16 ZhFont_NextUtf8Code(const char** text);
+
+/**
+ * @brief 从 GB2312 字符串读取一个字符并转换为字形码
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @return 字形码；字符串结束返回 0
+ */
+u16 ZhFont_NextGb2312Code(const char** text);
+
+/**
+ * @brief 从 UTF-8 字符串解码一个字符：字形码、点阵指针与前进宽度一次取得
+ * @param text 字符串指针，读取后前进到下一个字符
+ * @param out 解码结果
+ * @return 字形码；字符串结束返回 0
+ */
+u16 ZhFont_DecodeUtf8(const char** text, ZhGlyphRef* out);
+
+/**
+ * @brief 从 GB2312 字符串解码一个字符（同 ZhFont_DecodeUtf8）
+ */
+u16 ZhFont_DecodeGb2312(const char** text, ZhGlyphRef* out);
+
+/**
+ * @brief 由字形码取得点阵指针与前进宽度
+ */
+void ZhFont_GetGlyphRef(u16 code, ZhGlyphRef* out);
+
+/**
+ * @brief 计算 UTF-8 文本宽度（到 \n 或字符串结束；只看半角/全角，不做码表映射）
+ * @return 像素宽度
+ */
+int ZhFont_MeasureUtf8(const char* utf8);
+
+/**
+ * @brief 计算 GB2312 文本宽度（到 \n 或字符串结束）
+ * @return 像素宽度
+ */
+int ZhFont_MeasureGb2312(const char* gb2312);
+
+/**
+ * @brief Unicode 码点转 GB2312（两级页表，常数时间）
+ * @param codepoint Unicode 码点
+ * @return GB2312 双字节码；无映射返回 0
+ */
+u16 ZhFont_UnicodeToGb2312(u32 codepoint);
+
+/**
+ * @brief 字形前进宽度（ASCII 6 像素，其它 12 像素）
+ */
+static inline int ZhFont_GlyphAdvance(u16 code)
+{
+    return code < 0x80 ? ZHFONT_ADVANCE_HALF : ZHFONT_ADVANCE_FULL;
+}
+
+/**
+ * @brief 取得字形的 12 行点阵，每行 16 位、最高位为最左像素
+ * @param code 字形码
+ * @param rows 输出 12 行
+ * @return 为 0 表示没有可绘制的点阵（空格、控制字符、缺字）
+ */
+int ZhFont_GetGlyphRows(u16 code, u16 rows[ZHFONT_GLYPH_HEIGHT]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,116 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 文本排版
+说明：按文本框宽度与每页行数把 UTF-8 文本折行、分页，得到行表与页表；排版结果缓存，翻页时不再测量
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：字宽取自 ZhFace_Select 选中的字体（未选中时同 ZhFont：ASCII 6 像素，其它 12 像素）；\n 换行，\f 换页
+      避头尾：，。？等不出现在行首，（《“等不出现在行尾；连续的 ASCII 字母数字按单词整体折行，空格处断行时空格不计入行宽
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 单次排版的最大行数与页数（超出部分截断，truncated 置 1） */
+#define ZHLAYOUT_MAX_LINES 32
+#define ZHLAYOUT_MAX_PAGES 16
+/** 排版缓存容量 */
+#define ZHLAYOUT_CACHE_ENTRIES 4
+
+/**
+ * @brief 一行：在原文中的字节范围与像素宽度
+ */
+typedef struct ZhLayoutLine
+{
+    u16 offset;             /**< 行首字节偏移 */
+    u16 length;             /**< 字节数（不含换行符与行尾断行空格） */
+    u16 width;              /**< 像素宽度 */
+    u16 reserved;
+} ZhLayoutLine;
+
+/**
+ * @brief 排版结果
+ */
+typedef struct ZhLayout
+{
+    const char* text;                               /**< 原文（UTF-8，需在排版结果使用期间保持有效） */
+    const struct ZhFace* face;                      /**< 排版时的字体（0 为内置字库） */
+    u16 boxWidth;                                   /**< 文本框宽度（像素） */
+    u8 linesPerPage;                                /**< 每页行数 */
+    u8 truncated;                                   /**< 为 1 表示超出行数 / 页数上限被截断 */
+    u16 lineCount;                                  /**< 行数 */
+    u16 pageCount;                                  /**< 页数 */
+    u8 pageFirstLine[ZHLAYOUT_MAX_PAGES + 1];       /**< 各页首行，pageFirstLine[pageCount] == lineCount */
+    ZhLayoutLine lines[ZHLAYOUT_MAX_LINES];
+} ZhLayout;
+
+/**
+ * @brief 排版缓存统计
+ */
+typedef struct ZhLayoutStats
+{
+    u32 hits;               /**< ZhLayout_Get 命中 */
+    u32 builds;             /**< 实际排版次数 */
+    u32 bytesMeasured;      /**< 排版时扫描的字节数 */
+} ZhLayoutStats;
+
+/**
+ * @brief 按当前字体排版到调用方提供的结果（不经缓存）
+ * @param layout 结果
+ * @param utf8 UTF-8 文本
+ * @param boxWidth 文本框宽度（像素，至少一个全角字宽）
+ * @param linesPerPage 每页行数（至少 1）
+ */
+void ZhLayout_Build(ZhLayout* layout, const char* utf8, int boxWidth, int linesPerPage);
+
+/**
+ * @brief 取得排版结果：以（文本指针、当前字体、宽度、每页行数）为键查缓存，未命中时排版并替换最久未用的条目
+ * @return 排版结果；指针在之后 ZHLAYOUT_CACHE_ENTRIES - 1 次未命中之内有效
+ * @note 以指针为键：同一缓冲区改写内容后需调用 ZhLayout_Flush
+ */
+const ZhLayout* ZhLayout_Get(const char* utf8, int boxWidth, int linesPerPage);
+
+/**
+ * @brief 清空排版缓存
+ */
+void ZhLayout_Flush(void);
+
+/**
+ * @brief 读取统计
+ */
+void ZhLayout_GetStats(ZhLayoutStats* out);
+
+/**
+ * @brief 清零统计
+ */
+void ZhLayout_ResetStats(void);
+
+/**
+ * @brief 第 page 页的行数
+ */
+static inline int ZhLayout_PageLineCount(const ZhLayout* layout, int page)
+{
+    if(page < 0 || page >= layout->pageCount) {
+        return 0;
+    }
+    return layout->pageFirstLine[page + 1] - layout->pageFirstLine[page];
+}
+
+/**
+ * @brief 字符是否不能出现在行首（，。？！）」等）
+ */
+int ZhLayout_IsNoLineStart(u32 codepoint);
+
+/**
+ * @brief 字符是否不能出现在行尾（（《「“等）
+ */
+int ZhLayout_IsNoLineEnd(u32 codepoint);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 双缓冲文本画面
+说明：Mode 4（240x160 8bpp 调色板）/ Mode 5（160x128 16bpp）翻页画面：绘制总在后台页，VBlank 中翻页，不撕裂
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：每帧只画变化的部分：画面函数自动记录脏矩形；翻页后把这些矩形从新的前台页复制到新的后台页，
+      两页保持一致，下一帧继续增量绘制，不必整屏重画
+      整页与矩形清除用 GbaCore 的 MemFill32 / VramFill，翻页同步按行用 DMA3
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ZhFontBlit.h"
+#include "ZhFontText.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 脏矩形列表容量（超出时合并到增长最小的矩形） */
+#define ZHSURFACE_MAX_DIRTY 8
+
+/**
+ * @brief 矩形（像素）
+ */
+typedef struct ZhSurfaceRect
+{
+    s16 x;
+    s16 y;
+    s16 w;
+    s16 h;
+} ZhSurfaceRect;
+
+/**
+ * @brief 双缓冲画面
+ */
+typedef struct ZhSurface
+{
+    u32 pages[2];           /**< 两页帧缓冲地址（页 0 / 页 1，对应 DISPCNT 的 BACKBUFFER 位） */
+    u16 width;              /**< 宽度（像素） */
+    u16 height;             /**< 高度（像素） */
+    u8 mode;                /**< 4 或 5 */
+    u8 format;              /**< ZHBLIT_FORMAT_* */
+    u8 dirtyCount;          /**< 本帧脏矩形数 */
+    u8 reserved;
+    s16 clipX0;             /**< 文字裁剪矩形 [clipX0, clipX1) x [clipY0, clipY1) */
+    s16 clipY0;
+    s16 clipX1;
+    s16 clipY1;
+    ZhSurfaceRect dirty[ZHSURFACE_MAX_DIRTY];
+    u32 bytesSynced;        /**< 累计翻页同步复制的字节数 */
+} ZhSurface;
+
+/**
+ * @brief 初始化：设置显示模式（mode | BG2_ON，显示页 0），两页都清为 0，此后绘制到页 1
+ * @param mode 4 或 5
+ */
+void ZhSurface_Init(ZhSurface* surface, int mode);
+
+/**
+ * @brief 后台页地址（当前绘制目标）
+ */
+u32 ZhSurface_BackBuffer(const ZhSurface* surface);
+
+/**
+ * @brief 用 color 清除整个后台页（MemFill32 填充；Mode 4 为调色板索引，Mode 5 为 BGR555），整页记为脏
+ */
+void ZhSurface_Clear(ZhSurface* surface, u16 color);
+
+/**
+ * @brief 用 color 清除后台页的矩形（按行 VramFill 填充），记为脏
+ */
+void ZhSurface_ClearRect(ZhSurface* surface, int x, int y, int w, int h, u16 color);
+
+/**
+ * @brief 设置文字裁剪矩形（默认整个画面；清除函数不受影响）
+ */
+void ZhSurface_SetClip(ZhSurface* surface, int x0, int y0, int x1, int y1);
+
+/**
+ * @brief 在后台页绘制一行 UTF-8 文本（字形经缓存，使用当前字体），文字及效果范围记为脏
+ * @return 结束位置 X（像素）
+ */
+int ZhSurface_DrawUtf8(ZhSurface* surface, const char* utf8, int x, int y, const ZhBlitStyle* style);
+
+/**
+ * @brief 在后台页绘制预编码字符串的一行，记为脏
+ * @return 结束位置 X（像素）
+ */
+int ZhSurface_DrawTextLine(ZhSurface* surface, const ZhText* text, int line, int x, int y, const ZhBlitStyle* style);
+
+/**
+ * @brief 把自行绘制到后台页的矩形记为脏
+ */
+void ZhSurface_MarkDirty(ZhSurface* surface, int x, int y, int w, int h);
+
+/**
+ * @brief 翻页并同步：在 VBlank 中调用（主循环 VBlankIntrWait 之后），显示刚画好的后台页，
+ *        再把本帧脏矩形复制到新的后台页；没有脏矩形时不翻页
+ * @return 为 0 表示本帧没有变化
+ */
+int ZhSurface_Flip(ZhSurface* surface);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,83 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 预编码文本
+说明：构建期由 tool/zhtext.py 把 UTF-8 字符串表编译成字形索引流（含行宽与换行位置）与子集字库，运行时直接绘制
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：运行时不做 UTF-8 解码、GB2312 映射与 HZK12 偏移计算；只引用子集字库时链接器会剔除 zhfont.a 的整套点阵
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ZhFontCache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 子集字库：只含字符串表用到的字形，按字形索引排列（已解码，格式同缓存条目）
+ */
+typedef struct ZhTextFont
+{
+    const ZhGlyph* glyphs;  /**< 字形数组 */
+    u16 count;              /**< 字形数 */
+    u16 reserved;
+} ZhTextFont;
+
+/**
+ * @brief 一行：在字形索引流中的范围与像素宽度
+ */
+typedef struct ZhTextLine
+{
+    u16 first;              /**< 首个字形在 glyphs 中的下标 */
+    u16 count;              /**< 字形数 */
+    u16 width;              /**< 像素宽度 */
+    u16 reserved;
+} ZhTextLine;
+
+/**
+ * @brief 预编码字符串
+ */
+typedef struct ZhText
+{
+    const ZhTextFont* font; /**< 所用子集字库 */
+    const u16* glyphs;      /**< 字形索引流（不含换行符） */
+    const ZhTextLine* lines;/**< 各行 */
+    u16 glyphCount;         /**< 字形总数 */
+    u16 lineCount;          /**< 行数 */
+    u16 width;              /**< 最宽一行的像素宽度 */
+    u16 reserved;
+} ZhText;
+
+/**
+ * @brief 取字符串中第 index 个字形
+ */
+static inline const ZhGlyph* ZhText_Glyph(const ZhText* text, int index)
+{
+    return &text->font->glyphs[text->glyphs[index]];
+}
+
+/**
+ * @brief 在 Mode 3 帧缓冲绘制一个已解码字形（按 ZhBlit_SetClip 的裁剪矩形，默认整屏）
+ * @return 前进宽度
+ */
+int ZhText_DrawGlyphMode3(const ZhGlyph* glyph, int x, int y, u16 color);
+
+/**
+ * @brief 在 Mode 3 帧缓冲绘制预编码字符串的一行
+ * @return 绘制结束位置的 X
+ */
+int ZhText_DrawLineMode3(const ZhText* text, int line, int x, int y, u16 color);
+
+/**
+ * @brief 在 Mode 3 帧缓冲绘制预编码字符串的全部行
+ * @param lineHeight 行距（像素）
+ */
+void ZhText_DrawMode3(const ZhText* text, int x, int y, int lineHeight, u16 color);
+
+#ifdef __cplusplus
+}
+#endif
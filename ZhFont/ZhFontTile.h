@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 图块模式文本
+说明：把 12x12 字形栅格化进预留的 4bpp 图块区域（文本画布），再通过 BG 地图或一组 OBJ 显示
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：适用于 Mode 0/1/2；每个字只改写它覆盖的图块行（12x12 全角字最多 6 个图块 x 12 行 x 4 字节）
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 画布图块按行排列：第 ty 行第 tx 列为 firstTile + ty * cols + tx（用于 BG 地图） */
+#define ZHTILE_LAYOUT_ROWS 0
+/** 画布由 64x32 的 OBJ 拼成（1D 映射）：每个 OBJ 连续 32 个图块，cols 为 8 的倍数，rows 为 4 的倍数 */
+#define ZHTILE_LAYOUT_OBJ64X32 1
+
+/**
+ * @brief 文本画布
+ */
+typedef struct ZhTileCanvas
+{
+    volatile u32* tiles;    /**< 首个图块在 VRAM 中的地址 */
+    u16 firstTile;          /**< 首个图块编号（写入 BG 地图 / OBJ attr2） */
+    u8 cols;                /**< 宽度（图块） */
+    u8 rows;                /**< 高度（图块） */
+    u8 layout;              /**< ZHTILE_LAYOUT_* */
+    u8 fg;                  /**< 文字颜色索引（1~15，调色板组内） */
+    u8 bg;                  /**< 背景颜色索引（0 为透明） */
+    u8 reserved;
+    u32 bytesWritten;       /**< 累计写入 VRAM 的字节数（统计用） */
+} ZhTileCanvas;
+
+/**
+ * @brief 初始化文本画布（不清空 VRAM）
+ * @param canvas 画布
+ * @param charBase 图块所在字符块地址（BG：0x06000000 + n * 0x4000；OBJ：0x06010000）
+ * @param firstTile 首个图块编号（相对 charBase，4bpp 图块 32 字节）
+ * @param cols 宽度（图块）
+ * @param rows 高度（图块）
+ * @param layout ZHTILE_LAYOUT_*
+ */
+void ZhTile_Init(ZhTileCanvas* canvas, u32 charBase, int firstTile, int cols, int rows, int layout);
+
+/**
+ * @brief 设置文字与背景颜色索引
+ */
+void ZhTile_SetColors(ZhTileCanvas* canvas, int fg, int bg);
+
+/**
+ * @brief 用背景色填满整个画布
+ */
+void ZhTile_Clear(ZhTileCanvas* canvas);
+
+/**
+ * @brief 用背景色填充画布内的矩形（像素坐标，自动裁剪）
+ */
+void ZhTile_ClearRect(ZhTileCanvas* canvas, int x, int y, int w, int h);
+
+/**
+ * @brief 绘制一个字形（左上角像素坐标，超出画布的部分被裁剪）
+ * @param code 字形码（见 ZhFontGlyph.h）
+ * @return 前进宽度（像素）
+ */
+int ZhTile_DrawGlyph(ZhTileCanvas* canvas, u16 code, int x, int y);
+
+struct ZhGlyph;
+
+/**
+ * @brief 绘制已解码的字形（来自字形缓存或子集字库）
+ * @return 前进宽度（像素）
+ */
+int ZhTile_DrawDecodedGlyph(ZhTileCanvas* canvas, const struct ZhGlyph* glyph, int x, int y);
+
+/**
+ * @brief 绘制 GB2312 文本（遇到 \n 或字符串结束停止）
+ * @return 结束位置 X（像素）
+ */
+int ZhTile_DrawGb2312(ZhTileCanvas* canvas, const char* gb2312, int x, int y);
+
+/**
+ * @brief 绘制 UTF-8 文本（遇到 \n 或字符串结束停止）
+ * @return 结束位置 X（像素）
+ */
+int ZhTile_DrawUtf8(ZhTileCanvas* canvas, const char* utf8, int x, int y);
+
+/**
+ * @brief 绘制 UTF-8 文本中的 bytes 个字节（不因 \n 停止，供排版结果按行绘制）
+ * @return 结束位置 X（像素）
+ */
+int ZhTile_DrawUtf8Span(ZhTileCanvas* canvas, const char* utf8, int bytes, int x, int y);
+
+struct ZhText;
+struct ZhLayout;
+
+/**
+ * @brief 绘制预编码字符串（见 ZhFontText.h）的一行
+ * @return 结束位置 X（像素）
+ */
+int ZhTile_DrawTextLine(ZhTileCanvas* canvas, const struct ZhText* text, int line, int x, int y);
+
+/**
+ * @brief 绘制预编码字符串的全部行
+ * @param lineHeight 行距（像素）
+ */
+void ZhTile_DrawText(ZhTileCanvas* canvas, const struct ZhText* text, int x, int y, int lineHeight);
+
+/**
+ * @brief 绘制排版结果（见 ZhFontLayout.h）的第 page 页
+ * @param lineHeight 行距（像素）
+ */
+void ZhTile_DrawLayoutPage(ZhTileCanvas* canvas, const struct ZhLayout* layout, int page, int x, int y, int lineHeight);
+
+/**
+ * @brief 把 ZHTILE_LAYOUT_ROWS 画布写入 BG 文本地图（32x32 屏幕块）
+ * @param map 屏幕块地址
+ * @param mapX 画布左上角所在的地图列
+ * @param mapY 画布左上角所在的地图行
+ * @param paletteBank 16 色调色板组（0~15）
+ */
+void ZhTile_MapToBg(const ZhTileCanvas* canvas, volatile u16* map, int mapX, int mapY, int paletteBank);
+
+/**
+ * @brief 为 ZHTILE_LAYOUT_OBJ64X32 画布生成 OBJ 属性（16 色、64x32）
+ * @param oam OBJ 属性数组（每项 4 个 u16：attr0/attr1/attr2/填充，填充不改写）
+ * @param x 画布左上角屏幕 X
+ * @param y 画布左上角屏幕 Y
+ * @param paletteBank OBJ 16 色调色板组（0~15）
+ * @param priority 优先级（0~3）
+ * @return 使用的 OBJ 数量
+ */
+int ZhTile_WriteObjAttrs(const ZhTileCanvas* canvas, u16* oam, int x, int y, int paletteBank, int priority);
+
+#ifdef __cplusplus
+}
+#endif
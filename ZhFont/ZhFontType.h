@@ -0,0 +1,120 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 打字机
+说明：逐帧推进的文本显示：Begin 开始后由主循环每帧调用一次 Step，每步最多绘制 K 个字，支持跳过与翻页
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：不等待 VBlank、不阻塞主循环；替代 zhfont.a 的阻塞接口 ZhFont_DrawUtf8Text_Typing
+      文本来源可以是 UTF-8 字符串（经 ZhFontLayout 折行分页）或预编码字符串 ZhText（按构建期的行拆页）
+      绘制目标可以是 Mode 3 帧缓冲或图块文本画布
+------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <gba.h>
+
+#include "ZhFontBlit.h"
+#include "ZhFontText.h"
+#include "ZhFontTile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** 打字机状态 */
+#define ZHTYPE_IDLE 0       /**< 未开始 */
+#define ZHTYPE_TYPING 1     /**< 正在逐字显示当前页 */
+#define ZHTYPE_PAGE_END 2   /**< 当前页已显示完，后面还有页（等待 ZhType_NextPage） */
+#define ZHTYPE_DONE 3       /**< 全部显示完 */
+
+/**
+ * @brief 文本框：位置与尺寸（像素，相对画布或屏幕）、行距、每页行数与颜色
+ */
+typedef struct ZhTypeBox
+{
+    ZhTileCanvas* canvas;   /**< 图块画布；为 0 时绘制到 Mode 3 帧缓冲 */
+    const struct ZhFace* face;  /**< UTF-8 文本使用的字体（0 为内置 12 像素字库；预编码文本忽略） */
+    s16 x;                  /**< 左上角 X */
+    s16 y;                  /**< 左上角 Y */
+    u16 width;              /**< 宽度（UTF-8 文本按此折行） */
+    u16 height;             /**< 高度（翻页时清除的区域） */
+    u8 lineHeight;          /**< 行距 */
+    u8 linesPerPage;        /**< 每页行数 */
+    u8 clearOnPage;         /**< 为 1 时每页开始前用背景色清除文本框 */
+    u8 effect;              /**< Mode 3 效果 ZHBLIT_*（画布忽略） */
+    u16 color;              /**< Mode 3 文字颜色（画布使用 canvas->fg） */
+    u16 background;         /**< Mode 3 背景颜色（画布使用 canvas->bg） */
+    u16 effectColor;        /**< Mode 3 阴影 / 描边颜色 */
+} ZhTypeBox;
+
+struct ZhTypeSource;
+
+/**
+ * @brief 打字机
+ */
+typedef struct ZhTypewriter
+{
+    ZhTypeBox box;
+    const struct ZhTypeSource* source;  /**< 来源操作（由 Begin / BeginText 选定，未用到的来源不会被链接） */
+    const char* utf8;       /**< UTF-8 来源（排版结果每次经 ZhLayout_Get 取得，不持有缓存指针） */
+    const ZhText* text;     /**< 预编码来源 */
+    const char* cursor;     /**< UTF-8：当前行下一个字节 */
+    const char* lineEnd;    /**< UTF-8：当前行结束 */
+    u16 index;              /**< 预编码：当前行下一个字形 */
+    u16 indexEnd;           /**< 预编码：当前行结束 */
+    u16 page;               /**< 当前页 */
+    u16 line;               /**< 当前行（全文行号） */
+    u16 pageFirstLine;      /**< 当前页首行 */
+    u16 pageLineEnd;        /**< 当前页结束行（不含） */
+    s16 penX;               /**< 下一个字的 X */
+    u8 glyphsPerStep;       /**< 每步最多绘制字数（K） */
+    u8 framesPerStep;       /**< 每隔几帧推进一步 */
+    u8 frameCount;
+    u8 state;               /**< ZHTYPE_* */
+    u16 revealed;           /**< 已显示字数（全文累计） */
+} ZhTypewriter;
+
+/**
+ * @brief 开始显示 UTF-8 文本（按 box->width 与 box->linesPerPage 排版，第一页）
+ * @param utf8 文本，需在显示期间保持有效
+ */
+void ZhType_Begin(ZhTypewriter* tw, const char* utf8, const ZhTypeBox* box);
+
+/**
+ * @brief 开始显示预编码字符串（每 box->linesPerPage 行一页）
+ */
+void ZhType_BeginText(ZhTypewriter* tw, const ZhText* text, const ZhTypeBox* box);
+
+/**
+ * @brief 设置速度：每 framesPerStep 帧推进一步，每步最多 glyphsPerStep 个字（默认每帧 1 字）
+ */
+void ZhType_SetSpeed(ZhTypewriter* tw, int glyphsPerStep, int framesPerStep);
+
+/**
+ * @brief 每帧调用一次：按速度绘制下一批字
+ * @return ZHTYPE_*
+ */
+int ZhType_Step(ZhTypewriter* tw);
+
+/**
+ * @brief 立即显示完当前页（例如按键跳过）
+ */
+void ZhType_Skip(ZhTypewriter* tw);
+
+/**
+ * @brief 当前页显示完后翻到下一页
+ * @return 为 0 表示没有下一页（或当前页尚未显示完）
+ */
+int ZhType_NextPage(ZhTypewriter* tw);
+
+/**
+ * @brief 当前状态
+ */
+static inline int ZhType_State(const ZhTypewriter* tw)
+{
+    return tw->state;
+}
+
+#ifdef __cplusplus
+}
+#endif
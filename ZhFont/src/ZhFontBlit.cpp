@@ -0,0 +1,220 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 位图字形贴图
+说明：按行合成文字 / 效果两个掩码，4 像素一组查表展开成 32 位写入（16bpp 两个字，8bpp 一个字）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：行掩码 bit31 对应 32 位对齐的列 base（字形左侧留 1~4 列给描边），先与裁剪掩码相与再展开
+      阴影 = 上一行右移 1 位且不与文字重叠；描边 = 上中下三行左右膨胀 1 位后去掉文字本身，均在同一遍内写入
+      本文件以 ARM 模式编译，绘制函数与查找表位于 IWRAM
+------------------------------------------------------------------------*/
+
+#include "ZhFontBlit.h"
+
+#define ZHBLIT_SCREEN_WIDTH 240
+#define ZHBLIT_SCREEN_HEIGHT 160
+
+// 4 像素组（最高位为最左像素）→ 16bpp 两个 32 位掩码（低半字为左侧像素）；非 const 初始化数据，由启动代码复制到 IWRAM
+static u32 g_ZhBlitNibble[16][2] = {
+    { 0x00000000, 0x00000000 }, { 0x00000000, 0xFFFF0000 }, { 0x00000000, 0x0000FFFF }, { 0x00000000, 0xFFFFFFFF },
+    { 0xFFFF0000, 0x00000000 }, { 0xFFFF0000, 0xFFFF0000 }, { 0xFFFF0000, 0x0000FFFF }, { 0xFFFF0000, 0xFFFFFFFF },
+    { 0x0000FFFF, 0x00000000 }, { 0x0000FFFF, 0xFFFF0000 }, { 0x0000FFFF, 0x0000FFFF }, { 0x0000FFFF, 0xFFFFFFFF },
+    { 0xFFFFFFFF, 0x00000000 }, { 0xFFFFFFFF, 0xFFFF0000 }, { 0xFFFFFFFF, 0x0000FFFF }, { 0xFFFFFFFF, 0xFFFFFFFF },
+};
+
+// 4 像素组 → 8bpp 一个 32 位掩码（最低字节为最左像素）
+static u32 g_ZhBlitNibble8[16] = {
+    0x00000000, 0xFF000000, 0x00FF0000, 0xFFFF0000, 0x0000FF00, 0xFF00FF00, 0x00FFFF00, 0xFFFFFF00,
+    0x000000FF, 0xFF0000FF, 0x00FF00FF, 0xFFFF00FF, 0x0000FFFF, 0xFF00FFFF, 0x00FFFFFF, 0xFFFFFFFF,
+};
+
+// 绘制目标（默认 Mode 3 帧缓冲）
+static u32 g_ZhBlitBase = VRAM;
+static int g_ZhBlitWidth = ZHBLIT_SCREEN_WIDTH;
+static int g_ZhBlitHeight = ZHBLIT_SCREEN_HEIGHT;
+static int g_ZhBlitFormat = ZHBLIT_FORMAT_16BPP;
+
+static int g_ZhBlitClipX0 = 0;
+static int g_ZhBlitClipY0 = 0;
+static int g_ZhBlitClipX1 = ZHBLIT_SCREEN_WIDTH;
+static int g_ZhBlitClipY1 = ZHBLIT_SCREEN_HEIGHT;
+
+IWRAM_CODE void ZhBlit_SetTarget(u32 base, int width, int height, int format)
+{
+    g_ZhBlitBase = base;
+    g_ZhBlitWidth = width;
+    g_ZhBlitHeight = height;
+    g_ZhBlitFormat = format;
+    ZhBlit_ResetClip();
+}
+
+IWRAM_CODE void ZhBlit_ResetTarget(void)
+{
+    ZhBlit_SetTarget(VRAM, ZHBLIT_SCREEN_WIDTH, ZHBLIT_SCREEN_HEIGHT, ZHBLIT_FORMAT_16BPP);
+}
+
+IWRAM_CODE void ZhBlit_SetClip(int x0, int y0, int x1, int y1)
+{
+    g_ZhBlitClipX0 = x0 < 0 ? 0 : x0;
+    g_ZhBlitClipY0 = y0 < 0 ? 0 : y0;
+    g_ZhBlitClipX1 = x1 > g_ZhBlitWidth ? g_ZhBlitWidth : x1;
+    g_ZhBlitClipY1 = y1 > g_ZhBlitHeight ? g_ZhBlitHeight : y1;
+}
+
+IWRAM_CODE void ZhBlit_ResetClip(void)
+{
+    ZhBlit_SetClip(0, 0, g_ZhBlitWidth, g_ZhBlitHeight);
+}
+
+/// <summary>
+/// 字形第 r 行在行掩码坐标中的位（行外为 0）。
+/// </summary>
+static inline u32 RowBits(const ZhGlyph* glyph, int r, int shift)
+{
+    if(r < glyph->top || r >= glyph->bottom) {
+        return 0;
+    }
+    return (u32)glyph->rows[r] << (15 - shift);
+}
+
+/// <summary>
+/// 16bpp 写出一行：fg 用文字色，fx 用效果色（两者不重叠）。
+/// </summary>
+IWRAM_CODE static void WriteRow16(volatile u32* dst, u32 fg, u32 fx, u32 color32, u32 effect32)
+{
+    while((fg | fx) != 0) {
+        const u32* mf = g_ZhBlitNibble[fg >> 28];
+        const u32* me = g_ZhBlitNibble[fx >> 28];
+        for(int j = 0; j < 2; j++) {
+            const u32 m = mf[j] | me[j];
+            if(m != 0) {
+                u32 v = (color32 & mf[j]) | (effect32 & me[j]);
+                if(m != 0xFFFFFFFFu) {
+                    v |= dst[j] & ~m;
+                }
+                dst[j] = v;
+            }
+        }
+        dst += 2;
+        fg <<= 4;
+        fx <<= 4;
+    }
+}
+
+/// <summary>
+/// 8bpp 写出一行：每 4 像素一个 32 位字。
+/// </summary>
+IWRAM_CODE static void WriteRow8(volatile u32* dst, u32 fg, u32 fx, u32 color32, u32 effect32)
+{
+    while((fg | fx) != 0) {
+        const u32 mf = g_ZhBlitNibble8[fg >> 28];
+        const u32 me = g_ZhBlitNibble8[fx >> 28];
+        const u32 m = mf | me;
+        if(m != 0) {
+            u32 v = (color32 & mf) | (effect32 & me);
+            if(m != 0xFFFFFFFFu) {
+                v |= *dst & ~m;
+            }
+            *dst = v;
+        }
+        dst++;
+        fg <<= 4;
+        fx <<= 4;
+    }
+}
+
+IWRAM_CODE int ZhBlit_Glyph(const ZhGlyph* glyph, int x, int y, const ZhBlitStyle* style)
+{
+    const int advance = glyph->advance;
+    if(glyph->top == glyph->bottom) {
+        return advance;
+    }
+
+    const int effect = style->effect;
+    const int pad = effect == ZHBLIT_PLAIN ? 0 : 1;
+    const bool bpp8 = g_ZhBlitFormat == ZHBLIT_FORMAT_8BPP;
+
+    // 行掩码左端：x - 1 向下对齐到一个 32 位字（16bpp 2 像素，8bpp 4 像素）
+    const int align = bpp8 ? 3 : 1;
+    const int base = (x - 1) & ~align;
+    const int shift = (x - 1) & align;
+
+    // 水平裁剪掩码
+    int lo = g_ZhBlitClipX0 - base;
+    int hi = g_ZhBlitClipX1 - base;
+    if(lo < 0) lo = 0;
+    if(hi > 32) hi = 32;
+    if(lo >= hi) {
+        return advance;
+    }
+    const u32 clip = (0xFFFFFFFFu >> lo) & ~(hi >= 32 ? 0u : (0xFFFFFFFFu >> hi));
+
+    // 输出行范围（字形坐标）：阴影向下多 1 行，描边上下各多 1 行
+    int r0 = glyph->top - (effect == ZHBLIT_OUTLINE ? 1 : 0);
+    int r1 = glyph->bottom + pad;
+    if(y + r0 < g_ZhBlitClipY0) r0 = g_ZhBlitClipY0 - y;
+    if(y + r1 > g_ZhBlitClipY1) r1 = g_ZhBlitClipY1 - y;
+    if(r0 >= r1) {
+        return advance;
+    }
+
+    u32 color32;
+    u32 effect32;
+    int rowBytes;
+    int baseBytes;
+    if(bpp8) {
+        color32 = (style->color & 0xFF) * 0x01010101u;
+        effect32 = (style->effectColor & 0xFF) * 0x01010101u;
+        rowBytes = g_ZhBlitWidth;
+        baseBytes = base;
+    } else {
+        color32 = style->color | ((u32)style->color << 16);
+        effect32 = style->effectColor | ((u32)style->effectColor << 16);
+        rowBytes = g_ZhBlitWidth * 2;
+        baseBytes = base * 2;
+    }
+    const u32 fb = g_ZhBlitBase + baseBytes;
+
+    // 滚动保存上一行 / 当前行 / 下一行
+    u32 prev = RowBits(glyph, r0 - 1, shift);
+    u32 cur = RowBits(glyph, r0, shift);
+    for(int r = r0; r < r1; r++) {
+        const u32 next = RowBits(glyph, r + 1, shift);
+
+        u32 fx = 0;
+        if(effect == ZHBLIT_SHADOW) {
+            fx = (prev >> 1) & ~cur;
+        } else if(effect == ZHBLIT_OUTLINE) {
+            const u32 v = prev | cur | next;
+            fx = (v | (v << 1) | (v >> 1)) & ~cur;
+        }
+
+        const u32 fg = cur & clip;
+        fx &= clip;
+        if((fg | fx) != 0) {
+            volatile u32* dst = (volatile u32*)(fb + (y + r) * rowBytes);
+            if(bpp8) {
+                WriteRow8(dst, fg, fx, color32, effect32);
+            } else {
+                WriteRow16(dst, fg, fx, color32, effect32);
+            }
+        }
+
+        prev = cur;
+        cur = next;
+    }
+    return advance;
+}
+
+IWRAM_CODE int ZhBlit_Utf8(const char* utf8, int x, int y, const ZhBlitStyle* style)
+{
+    const char* p = utf8;
+    while(x < g_ZhBlitClipX1) {
+        const ZhGlyph* glyph = ZhCache_NextUtf8(&p);
+        if(glyph == 0 || glyph->code == '\n') {
+            break;
+        }
+        x += ZhBlit_Glyph(glyph, x, y, style);
+    }
+    return x;
+}
@@ -0,0 +1,222 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 字形缓存
+说明：散列桶 + 双向 LRU 链表，查找、命中提前、淘汰均为 O(1)
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：键：Unicode 码点 | (字体标记 << 24)，内置字库标记为 0；按字形码查找的 GB2312 字符用 0x80000000 | 字形码（ASCII 两种方式键相同）
+------------------------------------------------------------------------*/
+
+#include "ZhFontCache.h"
+#include "ZhFontFace.h"
+
+#define ZHCACHE_NONE 0xFF
+#define ZHCACHE_BUCKETS 64
+#define ZHCACHE_KEY_CODE 0x80000000u
+#define ZHCACHE_KEY_FACE_SHIFT 24
+
+EWRAM_BSS static ZhGlyph g_ZhCacheGlyphs[ZHCACHE_ENTRIES];
+static u32 g_ZhCacheKeys[ZHCACHE_ENTRIES];
+
+// 桶内单链表与 LRU 双向链表（头为最近使用）
+static u8 g_ZhCacheBucketHead[ZHCACHE_BUCKETS];
+static u8 g_ZhCacheBucketNext[ZHCACHE_ENTRIES];
+static u8 g_ZhCacheLruPrev[ZHCACHE_ENTRIES];
+static u8 g_ZhCacheLruNext[ZHCACHE_ENTRIES];
+static u8 g_ZhCacheLruHead = ZHCACHE_NONE;
+static u8 g_ZhCacheLruTail = ZHCACHE_NONE;
+static int g_ZhCacheUsed = 0;
+static bool g_ZhCacheReady = false;
+
+static ZhCacheStats g_ZhCacheStats;
+
+static inline int Bucket(u32 key)
+{
+    return (int)((key ^ (key >> 6) ^ (key >> ZHCACHE_KEY_FACE_SHIFT) ^ (key >> 31)) & (ZHCACHE_BUCKETS - 1));
+}
+
+static void LruUnlink(int e)
+{
+    const u8 prev = g_ZhCacheLruPrev[e];
+    const u8 next = g_ZhCacheLruNext[e];
+    if(prev != ZHCACHE_NONE) {
+        g_ZhCacheLruNext[prev] = next;
+    } else {
+        g_ZhCacheLruHead = next;
+    }
+    if(next != ZHCACHE_NONE) {
+        g_ZhCacheLruPrev[next] = prev;
+    } else {
+        g_ZhCacheLruTail = prev;
+    }
+}
+
+static void LruPushFront(int e)
+{
+    g_ZhCacheLruPrev[e] = ZHCACHE_NONE;
+    g_ZhCacheLruNext[e] = g_ZhCacheLruHead;
+    if(g_ZhCacheLruHead != ZHCACHE_NONE) {
+        g_ZhCacheLruPrev[g_ZhCacheLruHead] = (u8)e;
+    } else {
+        g_ZhCacheLruTail = (u8)e;
+    }
+    g_ZhCacheLruHead = (u8)e;
+}
+
+static void BucketRemove(int e)
+{
+    u8* link = &g_ZhCacheBucketHead[Bucket(g_ZhCacheKeys[e])];
+    while(*link != ZHCACHE_NONE) {
+        if(*link == e) {
+            *link = g_ZhCacheBucketNext[e];
+            return;
+        }
+        link = &g_ZhCacheBucketNext[*link];
+    }
+}
+
+/// <summary>
+/// 解码字形并统计非空行范围。
+/// </summary>
+static void FillGlyph(ZhGlyph* glyph, u16 code)
+{
+    glyph->code = code;
+    glyph->advance = (u8)ZhFont_GlyphAdvance(code);
+    glyph->reserved = 0;
+    for(int r = ZHFONT_GLYPH_HEIGHT; r < ZHGLYPH_MAX_ROWS; r++) {
+        glyph->rows[r] = 0;
+    }
+
+    if(!ZhFont_GetGlyphRows(code, glyph->rows)) {
+        for(int r = 0; r < ZHFONT_GLYPH_HEIGHT; r++) {
+            glyph->rows[r] = 0;
+        }
+        glyph->top = 0;
+        glyph->bottom = 0;
+        return;
+    }
+
+    int top = 0;
+    int bottom = ZHFONT_GLYPH_HEIGHT;
+    while(top < bottom && glyph->rows[top] == 0) {
+        top++;
+    }
+    while(bottom > top && glyph->rows[bottom - 1] == 0) {
+        bottom--;
+    }
+    glyph->top = (u8)top;
+    glyph->bottom = (u8)bottom;
+}
+
+/// <summary>
+/// 查找键；未命中时取一个空闲或最久未用的条目，由调用方填充。
+/// </summary>
+/// <returns>条目号；missed 为 true 表示需要填充</returns>
+static int Acquire(u32 key, bool* missed)
+{
+    if(!g_ZhCacheReady) {
+        ZhCache_Flush();
+    }
+
+    const int bucket = Bucket(key);
+    for(u8 e = g_ZhCacheBucketHead[bucket]; e != ZHCACHE_NONE; e = g_ZhCacheBucketNext[e]) {
+        if(g_ZhCacheKeys[e] == key) {
+            if(g_ZhCacheLruHead != e) {
+                LruUnlink(e);
+                LruPushFront(e);
+            }
+            g_ZhCacheStats.hits++;
+            *missed = false;
+            return e;
+        }
+    }
+
+    int e;
+    if(g_ZhCacheUsed < ZHCACHE_ENTRIES) {
+        e = g_ZhCacheUsed++;
+    } else {
+        e = g_ZhCacheLruTail;
+        LruUnlink(e);
+        BucketRemove(e);
+        g_ZhCacheStats.evictions++;
+    }
+
+    g_ZhCacheKeys[e] = key;
+    g_ZhCacheBucketNext[e] = g_ZhCacheBucketHead[bucket];
+    g_ZhCacheBucketHead[bucket] = (u8)e;
+    LruPushFront(e);
+
+    g_ZhCacheStats.misses++;
+    *missed = true;
+    return e;
+}
+
+const ZhGlyph* ZhCache_LookupUnicode(u32 codepoint)
+{
+    const u32 tag = ZhFace_CurrentTag();
+    bool missed;
+    const int e = Acquire(codepoint | (tag << ZHCACHE_KEY_FACE_SHIFT), &missed);
+    if(missed && tag != 0) {
+        ZhFace_DecodeGlyph(ZhFace_Current(), codepoint, &g_ZhCacheGlyphs[e]);
+    } else if(missed) {
+        u16 code = (u16)codepoint;
+        if(codepoint >= 0x80) {
+            const u16 gb = ZhFont_UnicodeToGb2312(codepoint);
+            code = gb ? gb : ZHFONT_CODE_MISSING;
+        }
+        FillGlyph(&g_ZhCacheGlyphs[e], code);
+    }
+    return &g_ZhCacheGlyphs[e];
+}
+
+const ZhGlyph* ZhCache_LookupCode(u16 code)
+{
+    const u32 key = code < 0x80 ? code : (ZHCACHE_KEY_CODE | code);
+    bool missed;
+    const int e = Acquire(key, &missed);
+    if(missed) {
+        FillGlyph(&g_ZhCacheGlyphs[e], code);
+    }
+    return &g_ZhCacheGlyphs[e];
+}
+
+const ZhGlyph* ZhCache_NextUtf8(const char** text)
+{
+    const u32 cp = ZhFont_NextUtf8Codepoint(text);
+    if(cp == 0) {
+        return 0;
+    }
+    return ZhCache_LookupUnicode(cp);
+}
+
+const ZhGlyph* ZhCache_NextGb2312(const char** text)
+{
+    const u16 code = ZhFont_NextGb2312Code(text);
+    if(code == 0) {
+        return 0;
+    }
+    return ZhCache_LookupCode(code);
+}
+
+void ZhCache_Flush(void)
+{
+    for(int b = 0; b < ZHCACHE_BUCKETS; b++) {
+        g_ZhCacheBucketHead[b] = ZHCACHE_NONE;
+    }
+    g_ZhCacheLruHead = ZHCACHE_NONE;
+    g_ZhCacheLruTail = ZHCACHE_NONE;
+    g_ZhCacheUsed = 0;
+    g_ZhCacheReady = true;
+}
+
+void ZhCache_GetStats(ZhCacheStats* out)
+{
+    *out = g_ZhCacheStats;
+}
+
+void ZhCache_ResetStats(void)
+{
+    g_ZhCacheStats.hits = 0;
+    g_ZhCacheStats.misses = 0;
+    g_ZhCacheStats.evictions = 0;
+}
@@ -0,0 +1,211 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 可变宽字体
+说明：字形查找（二分）、紧排点阵解码为 ZhGlyph、测宽与当前字体选择
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：点阵偏移 = 所在 16 字块的起始 + 块内前面各字的 ceil(width * height / 8)，索引每字只需 2 字节码点 + 4 字节度量
+------------------------------------------------------------------------*/
+
+#include "ZhFontFace.h"
+
+static const ZhFace* g_ZhFaceCurrent = 0;
+static u32 g_ZhFaceCurrentTag = 0;
+
+// 已分配缓存标记的字体：标记 = 下标 + 1
+static const ZhFace* g_ZhFaceTagged[ZHFACE_TAGS];
+static int g_ZhFaceTaggedCount = 0;
+
+static inline int GlyphBytes(const ZhFaceMetric* m)
+{
+    return (m->width * m->height + 7) >> 3;
+}
+
+int ZhFace_Find(const ZhFace* face, u32 codepoint)
+{
+    if(codepoint > 0xFFFF) {
+        return -1;
+    }
+    int lo = 0;
+    int hi = face->count - 1;
+    while(lo <= hi) {
+        const int mid = (lo + hi) >> 1;
+        const u32 code = face->codes[mid];
+        if(code == codepoint) {
+            return mid;
+        }
+        if(code < codepoint) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return -1;
+}
+
+int ZhFace_Advance(const ZhFace* face, u32 codepoint)
+{
+    if(face == 0) {
+        return codepoint < 0x80 ? ZHFONT_ADVANCE_HALF : ZHFONT_ADVANCE_FULL;
+    }
+    const int index = ZhFace_Find(face, codepoint);
+    return index >= 0 ? face->metrics[index].advance : face->missingAdvance;
+}
+
+void ZhFace_DecodeGlyph(const ZhFace* face, u32 codepoint, ZhGlyph* out)
+{
+    for(int r = 0; r < ZHGLYPH_MAX_ROWS; r++) {
+        out->rows[r] = 0;
+    }
+    out->code = (u16)(codepoint <= 0xFFFF ? codepoint : ZHFONT_CODE_MISSING);
+    out->top = 0;
+    out->bottom = 0;
+    out->reserved = 0;
+
+    const int index = ZhFace_Find(face, codepoint);
+    if(index < 0) {
+        out->advance = face->missingAdvance;
+        return;
+    }
+
+    const ZhFaceMetric* m = &face->metrics[index];
+    out->advance = m->advance;
+    if(m->width == 0) {
+        return;
+    }
+
+    // 块起始 + 块内前面各字的点阵字节数
+    const int block = index / ZHFACE_BLOCK_GLYPHS;
+    u32 offset = face->blocks[block];
+    for(int i = block * ZHFACE_BLOCK_GLYPHS; i < index; i++) {
+        offset += (u32)GlyphBytes(&face->metrics[i]);
+    }
+
+    const int x = m->origin >> 4;
+    const int y = m->origin & 15;
+    const int w = m->width;
+    const int h = m->height;
+    const u32 rowMask = (1u << w) - 1;
+    const u8* src = face->bitmap + offset;
+
+    // 位流按行读出 w 位，对齐到字形单元的 x 列
+    u32 acc = 0;
+    int bits = 0;
+    for(int r = 0; r < h; r++) {
+        while(bits < w) {
+            acc = (acc << 8) | *src++;
+            bits += 8;
+        }
+        bits -= w;
+        out->rows[y + r] = (u16)(((acc >> bits) & rowMask) << (16 - x - w));
+    }
+    out->top = (u8)y;
+    out->bottom = (u8)(y + h);
+}
+
+int ZhFace_NextUtf8(const ZhFace* face, const char** text, ZhGlyph* out)
+{
+    const u32 cp = ZhFont_NextUtf8Codepoint(text);
+    if(cp == 0) {
+        return 0;
+    }
+    ZhFace_DecodeGlyph(face, cp, out);
+    return 1;
+}
+
+int ZhFace_MeasureUtf8(const ZhFace* face, const char* utf8)
+{
+    if(face == 0) {
+        return ZhFont_MeasureUtf8(utf8);
+    }
+    const char* p = utf8;
+    int width = 0;
+    for(;;) {
+        const u32 cp = ZhFont_NextUtf8Codepoint(&p);
+        if(cp == 0 || cp == '\n') {
+            break;
+        }
+        width += ZhFace_Advance(face, cp);
+    }
+    return width;
+}
+
+int ZhFace_DrawUtf8Mode3(const ZhFace* face, const char* utf8, int x, int y, const ZhBlitStyle* style)
+{
+    const char* p = utf8;
+    ZhGlyph glyph;
+    while(ZhFace_NextUtf8(face, &p, &glyph) && glyph.code != '\n') {
+        x += ZhBlit_Glyph(&glyph, x, y, style);
+    }
+    return x;
+}
+
+static int TagOf(const ZhFace* face)
+{
+    for(int i = 0; i < g_ZhFaceTaggedCount; i++) {
+        if(g_ZhFaceTagged[i] == face) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+const ZhFace* ZhFace_Select(const ZhFace* face)
+{
+    const ZhFace* previous = g_ZhFaceCurrent;
+    g_ZhFaceCurrent = face;
+    if(face == 0) {
+        g_ZhFaceCurrentTag = 0;
+        return previous;
+    }
+
+    const int tag = TagOf(face);
+    if(tag != 0) {
+        g_ZhFaceCurrentTag = (u32)tag;
+        return previous;
+    }
+
+    // 标记用完：缓存中的旧标记字形全部作废；之前的字体先重新分配标记，保证随后的 ZhFace_Restore 找得到而不必再清空
+    if(g_ZhFaceTaggedCount >= ZHFACE_TAGS) {
+        ZhCache_Flush();
+        g_ZhFaceTaggedCount = 0;
+        if(previous != 0 && previous != face) {
+            g_ZhFaceTagged[g_ZhFaceTaggedCount++] = previous;
+        }
+    }
+    g_ZhFaceTagged[g_ZhFaceTaggedCount++] = face;
+    g_ZhFaceCurrentTag = (u32)g_ZhFaceTaggedCount;
+    return previous;
+}
+
+void ZhFace_Restore(const ZhFace* face)
+{
+    g_ZhFaceCurrent = face;
+    if(face == 0) {
+        g_ZhFaceCurrentTag = 0;
+        return;
+    }
+
+    int tag = TagOf(face);
+    if(tag == 0) {
+        // 只有传入的不是最近一次 ZhFace_Select 的返回值时才会走到这里：有空位就分配，绝不清空缓存
+        if(g_ZhFaceTaggedCount >= ZHFACE_TAGS) {
+            g_ZhFaceCurrent = 0;
+            g_ZhFaceCurrentTag = 0;
+            return;
+        }
+        g_ZhFaceTagged[g_ZhFaceTaggedCount++] = face;
+        tag = g_ZhFaceTaggedCount;
+    }
+    g_ZhFaceCurrentTag = (u32)tag;
+}
+
+const ZhFace* ZhFace_Current(void)
+{
+    return g_ZhFaceCurrent;
+}
+
+u32 ZhFace_CurrentTag(void)
+{
+    return g_ZhFaceCurrentTag;
+}
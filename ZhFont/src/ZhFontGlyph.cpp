@@ -0,0 +1,214 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 字形访问
+说明：UTF-8 解码、Unicode→GB2312 页表映射与 HZK12 / ASC12 点阵定位
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：点阵数据来自 zhfont.a 导出的 g_zhfont_hzk12_* / g_zhfont_asc12_* 符号
+------------------------------------------------------------------------*/
+
+#include "ZhFontGlyph.h"
+
+extern "C" {
+extern const u8 g_zhfont_hzk12_start[];
+extern const u8 g_zhfont_hzk12_end[];
+extern const u8 g_zhfont_asc12_start[];
+extern const u8 g_zhfont_asc12_end[];
+}
+
+extern const u8 g_zhfont_gbmap_page_index[];
+extern const u16 g_zhfont_gbmap_pages[];
+
+// HZK12：每区 94 字，每字 24 字节（12 行 x 2 字节，大端）
+static const int g_Hzk12BytesPerGlyph = 24;
+// ASC12：从 0x20 开始，每字 12 字节（12 行 x 1 字节）
+static const int g_Asc12BytesPerGlyph = 12;
+
+u32 ZhFont_NextUtf8Codepoint(const char** text)
+{
+    const u8* s = (const u8*)*text;
+    const u32 c0 = s[0];
+    if(c0 == 0) {
+        return 0;
+    }
+
+    // 根据首字节确定长度；截断或非法序列按单字节跳过
+    int length = 1;
+    u32 cp = c0;
+    if(c0 >= 0xF0) {
+        length = 4;
+        cp = c0 & 0x07;
+    } else if(c0 >= 0xE0) {
+        length = 3;
+        cp = c0 & 0x0F;
+    } else if(c0 >= 0xC0) {
+        length = 2;
+        cp = c0 & 0x1F;
+    } else if(c0 >= 0x80) {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    for(int i = 1; i < length; i++) {
+        const u32 c = s[i];
+        if((c & 0xC0) != 0x80) {
+            *text += i;
+            return 0xFFFD;
+        }
+        cp = (cp << 6) | (c & 0x3F);
+    }
+    *text += length;
+    return cp;
+}
+
+static inline u16 LookupGb2312(u32 codepoint)
+{
+    if(codepoint > 0xFFFF) {
+        return 0;
+    }
+    const u32 page = g_zhfont_gbmap_page_index[codepoint >> 8];
+    if(page == 0xFF) {
+        return 0;
+    }
+    return g_zhfont_gbmap_pages[(page << 8) | (codepoint & 0xFF)];
+}
+
+u16 ZhFont_UnicodeToGb2312(u32 codepoint)
+{
+    return LookupGb2312(codepoint);
+}
+
+u16 ZhFont_NextUtf8Code(const char** text)
+{
+    const u32 cp = ZhFont_NextUtf8Codepoint(text);
+    if(cp < 0x80) {
+        return (u16)cp;
+    }
+    const u16 gb = LookupGb2312(cp);
+    return gb ? gb : ZHFONT_CODE_MISSING;
+}
+
+u16 ZhFont_NextGb2312Code(const char** text)
+{
+    const u8* s = (const u8*)*text;
+    if(s[0] < 0x80) {
+        if(s[0] != 0) {
+            *text += 1;
+        }
+        return s[0];
+    }
+    if(s[1] == 0) {
+        *text += 1;
+        return ZHFONT_CODE_MISSING;
+    }
+    *text += 2;
+    return (u16)((s[0] << 8) | s[1]);
+}
+
+void ZhFont_GetGlyphRef(u16 code, ZhGlyphRef* out)
+{
+    out->code = code;
+    out->bitmap = 0;
+    out->format = ZHFONT_FORMAT_NONE;
+
+    if(code < 0x80) {
+        out->advance = ZHFONT_ADVANCE_HALF;
+        if(code > 0x20 && code < 0x7F) {
+            out->bitmap = g_zhfont_asc12_start + (code - 0x20) * g_Asc12BytesPerGlyph;
+            out->format = ZHFONT_FORMAT_ASC12;
+        }
+        return;
+    }
+
+    out->advance = ZHFONT_ADVANCE_FULL;
+    const int hi = code >> 8;
+    const int lo = code & 0xFF;
+    if(code == ZHFONT_CODE_MISSING || hi < 0xA1 || lo < 0xA1 || lo > 0xFE) {
+        return;
+    }
+    const u8* src = g_zhfont_hzk12_start + ((hi - 0xA1) * 94 + (lo - 0xA1)) * g_Hzk12BytesPerGlyph;
+    if(src + g_Hzk12BytesPerGlyph <= g_zhfont_hzk12_end) {
+        out->bitmap = src;
+        out->format = ZHFONT_FORMAT_HZK12;
+    }
+}
+
+u16 ZhFont_DecodeUtf8(const char** text, ZhGlyphRef* out)
+{
+    const u16 code = ZhFont_NextUtf8Code(text);
+    ZhFont_GetGlyphRef(code, out);
+    return code;
+}
+
+u16 ZhFont_DecodeGb2312(const char** text, ZhGlyphRef* out)
+{
+    const u16 code = ZhFont_NextGb2312Code(text);
+    ZhFont_GetGlyphRef(code, out);
+    return code;
+}
+
+int ZhFont_MeasureUtf8(const char* utf8)
+{
+    // 宽度只取决于是否为 ASCII：按首字节跳过整个序列即可，不解码码点
+    const u8* s = (const u8*)utf8;
+    int width = 0;
+    for(;;) {
+        const u32 c = *s;
+        if(c == 0 || c == '\n') {
+            break;
+        }
+        if(c < 0x80) {
+            width += ZHFONT_ADVANCE_HALF;
+            s++;
+            continue;
+        }
+        width += ZHFONT_ADVANCE_FULL;
+        const int length = c >= 0xF0 ? 4 : (c >= 0xE0 ? 3 : (c >= 0xC0 ? 2 : 1));
+        s++;
+        for(int i = 1; i < length && (*s & 0xC0) == 0x80; i++) {
+            s++;
+        }
+    }
+    return width;
+}
+
+int ZhFont_MeasureGb2312(const char* gb2312)
+{
+    const u8* s = (const u8*)gb2312;
+    int width = 0;
+    for(;;) {
+        const u32 c = *s;
+        if(c == 0 || c == '\n') {
+            break;
+        }
+        if(c < 0x80) {
+            width += ZHFONT_ADVANCE_HALF;
+            s++;
+        } else {
+            width += ZHFONT_ADVANCE_FULL;
+            s += (s[1] != 0) ? 2 : 1;
+        }
+    }
+    return width;
+}
+
+int ZhFont_GetGlyphRows(u16 code, u16 rows[ZHFONT_GLYPH_HEIGHT])
+{
+    ZhGlyphRef ref;
+    ZhFont_GetGlyphRef(code, &ref);
+    if(ref.bitmap == 0) {
+        return 0;
+    }
+
+    const u8* src = ref.bitmap;
+    if(ref.format == ZHFONT_FORMAT_ASC12) {
+        for(int r = 0; r < ZHFONT_GLYPH_HEIGHT; r++) {
+            rows[r] = (u16)(src[r] << 8);
+        }
+    } else {
+        for(int r = 0; r < ZHFONT_GLYPH_HEIGHT; r++) {
+            rows[r] = (u16)((src[r * 2] << 8) | src[r * 2 + 1]);
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,251 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 文本排版
+说明：贪心折行 + 避头尾 + 分页，结果缓存（键为文本指针、字体、宽度、每页行数，LRU 替换）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：逐字记录最近的断行机会；超宽时回退到该处断行，行宽按已累计宽度相减得到，不重新测量
+------------------------------------------------------------------------*/
+
+#include "ZhFontLayout.h"
+#include "ZhFontFace.h"
+#include "ZhFontGlyph.h"
+
+// 不能出现在行首的字符
+static const u16 g_ZhLayoutNoStart[] = {
+    ',', '.', ';', ':', '?', '!', ')', ']', '}', '%',
+    0x3001, 0x3002, 0xFF0C, 0xFF0E, 0xFF1B, 0xFF1A, 0xFF1F, 0xFF01, 0xFF09, 0xFF05,
+    0x300B, 0x3009, 0x300D, 0x300F, 0x3011, 0x3015, 0x201D, 0x2019, 0x2026, 0x2014, 0x00B7,
+};
+
+// 不能出现在行尾的字符
+static const u16 g_ZhLayoutNoEnd[] = {
+    '(', '[', '{',
+    0xFF08, 0x300A, 0x3008, 0x300C, 0x300E, 0x3010, 0x3014, 0x201C, 0x2018,
+};
+
+EWRAM_BSS static ZhLayout g_ZhLayoutCache[ZHLAYOUT_CACHE_ENTRIES];
+static u32 g_ZhLayoutCacheStamp[ZHLAYOUT_CACHE_ENTRIES];
+static u32 g_ZhLayoutClock = 0;
+
+static ZhLayoutStats g_ZhLayoutStats;
+
+static int Contains(const u16* table, int count, u32 codepoint)
+{
+    for(int i = 0; i < count; i++) {
+        if(table[i] == codepoint) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int ZhLayout_IsNoLineStart(u32 codepoint)
+{
+    return Contains(g_ZhLayoutNoStart, sizeof(g_ZhLayoutNoStart) / sizeof(g_ZhLayoutNoStart[0]), codepoint);
+}
+
+int ZhLayout_IsNoLineEnd(u32 codepoint)
+{
+    return Contains(g_ZhLayoutNoEnd, sizeof(g_ZhLayoutNoEnd) / sizeof(g_ZhLayoutNoEnd[0]), codepoint);
+}
+
+static inline bool IsWordChar(u32 c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '\'' || c == '-';
+}
+
+/// <summary>
+/// 字符 cp 之前（紧跟 prev 之后）能否断行。
+/// </summary>
+static bool CanBreakBefore(u32 prev, u32 cp)
+{
+    if(prev == 0 || prev == ' ') {
+        return false;
+    }
+    if(ZhLayout_IsNoLineStart(cp) || ZhLayout_IsNoLineEnd(prev)) {
+        return false;
+    }
+    return !(IsWordChar(prev) && IsWordChar(cp));
+}
+
+/// <summary>
+/// 追加一行（本页已满或 newPage 时先开新页）；超出上限时置截断标记。
+/// </summary>
+/// <returns>false 表示已满</returns>
+static bool EmitLine(ZhLayout* layout, int offset, int end, int width, bool newPage)
+{
+    if(layout->lineCount >= ZHLAYOUT_MAX_LINES) {
+        layout->truncated = 1;
+        return false;
+    }
+
+    // 新页：首页或本页已满
+    const int pageLines = layout->lineCount - layout->pageFirstLine[layout->pageCount];
+    if(layout->lineCount == 0 || newPage || pageLines >= layout->linesPerPage) {
+        if(layout->lineCount != 0) {
+            if(layout->pageCount >= ZHLAYOUT_MAX_PAGES) {
+                layout->truncated = 1;
+                return false;
+            }
+            layout->pageCount++;
+        }
+        layout->pageFirstLine[layout->pageCount] = (u8)layout->lineCount;
+    }
+
+    ZhLayoutLine* line = &layout->lines[layout->lineCount++];
+    line->offset = (u16)offset;
+    line->length = (u16)(end - offset);
+    line->width = (u16)width;
+    line->reserved = 0;
+    return true;
+}
+
+/// <summary>
+/// 文本框至少容纳一个全角字、一行；ZhLayout_Get 查缓存前也按同样规则修正，否则修正过的参数永远不命中。
+/// </summary>
+static inline void ClampBox(int* boxWidth, int* linesPerPage)
+{
+    if(*boxWidth < ZHFONT_ADVANCE_FULL) *boxWidth = ZHFONT_ADVANCE_FULL;
+    if(*linesPerPage < 1) *linesPerPage = 1;
+}
+
+void ZhLayout_Build(ZhLayout* layout, const char* utf8, int boxWidth, int linesPerPage)
+{
+    ClampBox(&boxWidth, &linesPerPage);
+
+    const ZhFace* face = ZhFace_Current();
+    layout->text = utf8;
+    layout->face = face;
+    layout->boxWidth = (u16)boxWidth;
+    layout->linesPerPage = (u8)linesPerPage;
+    layout->truncated = 0;
+    layout->lineCount = 0;
+    layout->pageCount = 0;
+    layout->pageFirstLine[0] = 0;
+
+    const char* cursor = utf8;
+    int start = 0;
+    int width = 0;
+    u32 prev = 0;
+
+    // 最近的断行机会：行在 brkEnd 结束，下一行从 brkNext 开始；brkWidth 为断点前宽度，brkSkip 为被吞掉的空格宽度
+    int brkEnd = -1;
+    int brkNext = 0;
+    int brkWidth = 0;
+    int brkSkip = 0;
+
+    bool pageBreak = false;
+    bool full = false;
+    while(!full) {
+        const int pos = (int)(cursor - utf8);
+        const u32 cp = ZhFont_NextUtf8Codepoint(&cursor);
+        if(cp == 0) {
+            break;
+        }
+
+        if(cp == '\n' || cp == '\f') {
+            full = !EmitLine(layout, start, pos, width, pageBreak);
+            pageBreak = (cp == '\f');
+            start = (int)(cursor - utf8);
+            width = 0;
+            prev = 0;
+            brkEnd = -1;
+            continue;
+        }
+
+        const int advance = ZhFace_Advance(face, cp);
+        if(cp == ' ' && pos > start) {
+            brkEnd = pos;
+            brkNext = pos + 1;
+            brkWidth = width;
+            brkSkip = advance;
+        } else if(CanBreakBefore(prev, cp)) {
+            brkEnd = pos;
+            brkNext = pos;
+            brkWidth = width;
+            brkSkip = 0;
+        }
+
+        if(width + advance > boxWidth && pos > start) {
+            if(brkEnd > start) {
+                full = !EmitLine(layout, start, brkEnd, brkWidth, pageBreak);
+                width -= brkWidth + brkSkip;
+                start = brkNext;
+            }
+            if(!full && start <= pos && width + advance > boxWidth && pos > start) {
+                // 没有可断处，或回退后仍放不下（超长单词、整行标点）：就地断开
+                full = !EmitLine(layout, start, pos, width, pageBreak);
+                width = 0;
+                start = pos;
+            }
+            pageBreak = false;
+            brkEnd = -1;
+
+            if(start > pos) {
+                // 断在当前空格上，空格被吞掉
+                width = 0;
+                prev = 0;
+                continue;
+            }
+        }
+
+        width += advance;
+        prev = cp;
+    }
+
+    const int end = (int)(cursor - utf8);
+    if(!full && (start < end || layout->lineCount == 0)) {
+        EmitLine(layout, start, end, width, pageBreak);
+    }
+    if(layout->lineCount > 0) {
+        layout->pageCount++;
+    }
+    layout->pageFirstLine[layout->pageCount] = (u8)layout->lineCount;
+
+    g_ZhLayoutStats.builds++;
+    g_ZhLayoutStats.bytesMeasured += (u32)end;
+}
+
+const ZhLayout* ZhLayout_Get(const char* utf8, int boxWidth, int linesPerPage)
+{
+    g_ZhLayoutClock++;
+    ClampBox(&boxWidth, &linesPerPage);
+
+    const ZhFace* face = ZhFace_Current();
+    int victim = 0;
+    for(int i = 0; i < ZHLAYOUT_CACHE_ENTRIES; i++) {
+        ZhLayout* layout = &g_ZhLayoutCache[i];
+        if(g_ZhLayoutCacheStamp[i] != 0 && layout->text == utf8 && layout->face == face && layout->boxWidth == boxWidth && layout->linesPerPage == linesPerPage) {
+            g_ZhLayoutCacheStamp[i] = g_ZhLayoutClock;
+            g_ZhLayoutStats.hits++;
+            return layout;
+        }
+        if(g_ZhLayoutCacheStamp[i] < g_ZhLayoutCacheStamp[victim]) {
+            victim = i;
+        }
+    }
+
+    ZhLayout_Build(&g_ZhLayoutCache[victim], utf8, boxWidth, linesPerPage);
+    g_ZhLayoutCacheStamp[victim] = g_ZhLayoutClock;
+    return &g_ZhLayoutCache[victim];
+}
+
+void ZhLayout_Flush(void)
+{
+    for(int i = 0; i < ZHLAYOUT_CACHE_ENTRIES; i++) {
+        g_ZhLayoutCacheStamp[i] = 0;
+    }
+}
+
+void ZhLayout_GetStats(ZhLayoutStats* out)
+{
+    *out = g_ZhLayoutStats;
+}
+
+void ZhLayout_ResetStats(void)
+{
+    g_ZhLayoutStats.hits = 0;
+    g_ZhLayoutStats.builds = 0;
+    g_ZhLayoutStats.bytesMeasured = 0;
+}
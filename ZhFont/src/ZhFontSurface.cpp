@@ -0,0 +1,301 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 双缓冲文本画面
+说明：Mode 4 / Mode 5 翻页画面的清除、文字绘制、脏矩形记录与翻页同步
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：脏矩形相交或相邻时合并；翻页同步按 32 位对齐扩展矩形左右边界（多复制的像素两页本来相同），整行宽的矩形一次 DMA 复制
+      文字绘制时把 ZhBlit 目标临时切到后台页，结束后恢复为 Mode 3 整屏
+------------------------------------------------------------------------*/
+
+#include "ZhFontSurface.h"
+#include "ZhFontCache.h"
+#include "MemOps.h"
+
+#define ZHSURFACE_PAGE0 0x06000000
+#define ZHSURFACE_PAGE1 0x0600A000
+
+static inline int RowBytes(const ZhSurface* surface)
+{
+    return surface->format == ZHBLIT_FORMAT_8BPP ? surface->width : surface->width * 2;
+}
+
+static inline int Area(const ZhSurfaceRect* r)
+{
+    return r->w * r->h;
+}
+
+static inline bool Touches(const ZhSurfaceRect* a, const ZhSurfaceRect* b)
+{
+    return a->x <= b->x + b->w && b->x <= a->x + a->w && a->y <= b->y + b->h && b->y <= a->y + a->h;
+}
+
+static ZhSurfaceRect Union(const ZhSurfaceRect* a, const ZhSurfaceRect* b)
+{
+    const int x0 = a->x < b->x ? a->x : b->x;
+    const int y0 = a->y < b->y ? a->y : b->y;
+    const int x1 = a->x + a->w > b->x + b->w ? a->x + a->w : b->x + b->w;
+    const int y1 = a->y + a->h > b->y + b->h ? a->y + a->h : b->y + b->h;
+    ZhSurfaceRect r = { (s16)x0, (s16)y0, (s16)(x1 - x0), (s16)(y1 - y0) };
+    return r;
+}
+
+/// <summary>
+/// 把 [x0, x1) x [y0, y1) 限制在 [0, w) x [0, h) 内。
+/// </summary>
+/// <returns>为 false 表示为空</returns>
+static bool ClipRect(int* x0, int* y0, int* x1, int* y1, int minX, int minY, int maxX, int maxY)
+{
+    if(*x0 < minX) *x0 = minX;
+    if(*y0 < minY) *y0 = minY;
+    if(*x1 > maxX) *x1 = maxX;
+    if(*y1 > maxY) *y1 = maxY;
+    return *x0 < *x1 && *y0 < *y1;
+}
+
+/// <summary>
+/// 加入脏矩形：与已有矩形相交或相邻时合并，列表满时并入增长最小的矩形。
+/// </summary>
+static void AddDirty(ZhSurface* surface, int x0, int y0, int x1, int y1)
+{
+    if(!ClipRect(&x0, &y0, &x1, &y1, 0, 0, surface->width, surface->height)) {
+        return;
+    }
+
+    ZhSurfaceRect r = { (s16)x0, (s16)y0, (s16)(x1 - x0), (s16)(y1 - y0) };
+    bool merged = true;
+    while(merged) {
+        merged = false;
+        for(int i = 0; i < surface->dirtyCount; i++) {
+            if(Touches(&surface->dirty[i], &r)) {
+                r = Union(&surface->dirty[i], &r);
+                surface->dirty[i] = surface->dirty[--surface->dirtyCount];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if(surface->dirtyCount < ZHSURFACE_MAX_DIRTY) {
+        surface->dirty[surface->dirtyCount++] = r;
+        return;
+    }
+
+    int best = 0;
+    int bestGrowth = 0x7FFFFFFF;
+    for(int i = 0; i < surface->dirtyCount; i++) {
+        const ZhSurfaceRect u = Union(&surface->dirty[i], &r);
+        const int growth = Area(&u) - Area(&surface->dirty[i]);
+        if(growth < bestGrowth) {
+            best = i;
+            bestGrowth = growth;
+        }
+    }
+    surface->dirty[best] = Union(&surface->dirty[best], &r);
+}
+
+void ZhSurface_Init(ZhSurface* surface, int mode)
+{
+    surface->pages[0] = ZHSURFACE_PAGE0;
+    surface->pages[1] = ZHSURFACE_PAGE1;
+    surface->mode = (u8)mode;
+    surface->reserved = 0;
+    surface->dirtyCount = 0;
+    surface->bytesSynced = 0;
+    if(mode == 5) {
+        surface->width = 160;
+        surface->height = 128;
+        surface->format = ZHBLIT_FORMAT_16BPP;
+    } else {
+        surface->mode = 4;
+        surface->width = 240;
+        surface->height = 160;
+        surface->format = ZHBLIT_FORMAT_8BPP;
+    }
+    ZhSurface_SetClip(surface, 0, 0, surface->width, surface->height);
+
+    SetMode(surface->mode | BG2_ON);
+
+    const u32 bytes = (u32)(RowBytes(surface) * surface->height);
+    MemFill32((void*)surface->pages[0], 0, bytes);
+    MemFill32((void*)surface->pages[1], 0, bytes);
+}
+
+u32 ZhSurface_BackBuffer(const ZhSurface* surface)
+{
+    return (REG_DISPCNT & BACKBUFFER) ? surface->pages[0] : surface->pages[1];
+}
+
+void ZhSurface_Clear(ZhSurface* surface, u16 color)
+{
+    const u32 fill = surface->format == ZHBLIT_FORMAT_8BPP ? (color & 0xFF) * 0x01010101u : color | ((u32)color << 16);
+    MemFill32((void*)ZhSurface_BackBuffer(surface), fill, (u32)(RowBytes(surface) * surface->height));
+
+    surface->dirtyCount = 0;
+    AddDirty(surface, 0, 0, surface->width, surface->height);
+}
+
+void ZhSurface_ClearRect(ZhSurface* surface, int x, int y, int w, int h, u16 color)
+{
+    int x0 = x;
+    int y0 = y;
+    int x1 = x + w;
+    int y1 = y + h;
+    if(!ClipRect(&x0, &y0, &x1, &y1, 0, 0, surface->width, surface->height)) {
+        return;
+    }
+
+    const u32 back = ZhSurface_BackBuffer(surface);
+    const int rowBytes = RowBytes(surface);
+    for(int py = y0; py < y1; py++) {
+        volatile u16* row = (volatile u16*)(back + py * rowBytes);
+        if(surface->format == ZHBLIT_FORMAT_16BPP) {
+            VramFill((void*)(row + x0), color, (u32)(x1 - x0) * 2);
+            continue;
+        }
+
+        // 8bpp：VRAM 不能按字节写，奇数边界的像素读改写所在半字
+        const u8 index = (u8)color;
+        int hx0 = x0 >> 1;
+        int hx1 = x1 >> 1;
+        if(x0 & 1) {
+            row[hx0] = (u16)((row[hx0] & 0x00FF) | (index << 8));
+            hx0++;
+        }
+        if(x1 & 1) {
+            row[hx1] = (u16)((row[hx1] & 0xFF00) | index);
+        }
+        if(hx1 > hx0) {
+            VramFill((void*)(row + hx0), (u16)(index | (index << 8)), (u32)(hx1 - hx0) * 2);
+        }
+    }
+
+    AddDirty(surface, x0, y0, x1, y1);
+}
+
+void ZhSurface_SetClip(ZhSurface* surface, int x0, int y0, int x1, int y1)
+{
+    ClipRect(&x0, &y0, &x1, &y1, 0, 0, surface->width, surface->height);
+    surface->clipX0 = (s16)x0;
+    surface->clipY0 = (s16)y0;
+    surface->clipX1 = (s16)x1;
+    surface->clipY1 = (s16)y1;
+}
+
+/// <summary>
+/// 把 ZhBlit 目标切到后台页并套用画面裁剪。
+/// </summary>
+static void BeginDraw(const ZhSurface* surface)
+{
+    ZhBlit_SetTarget(ZhSurface_BackBuffer(surface), surface->width, surface->height, surface->format);
+    ZhBlit_SetClip(surface->clipX0, surface->clipY0, surface->clipX1, surface->clipY1);
+}
+
+/// <summary>
+/// 恢复 ZhBlit 目标，并把文字范围（含 1 像素效果边）在裁剪矩形内的部分记为脏。
+/// </summary>
+static void EndDraw(ZhSurface* surface, int x0, int x1, int y, int top, int bottom)
+{
+    ZhBlit_ResetTarget();
+    if(top >= bottom) {
+        return;
+    }
+    int rx0 = x0 - 1;
+    int ry0 = y + top - 1;
+    int rx1 = x1 + 1;
+    int ry1 = y + bottom + 1;
+    if(ClipRect(&rx0, &ry0, &rx1, &ry1, surface->clipX0, surface->clipY0, surface->clipX1, surface->clipY1)) {
+        AddDirty(surface, rx0, ry0, rx1, ry1);
+    }
+}
+
+int ZhSurface_DrawUtf8(ZhSurface* surface, const char* utf8, int x, int y, const ZhBlitStyle* style)
+{
+    BeginDraw(surface);
+    const int start = x;
+    int top = ZHGLYPH_MAX_ROWS;
+    int bottom = 0;
+    const char* p = utf8;
+    while(x < surface->clipX1) {
+        const ZhGlyph* glyph = ZhCache_NextUtf8(&p);
+        if(glyph == 0 || glyph->code == '\n') {
+            break;
+        }
+        if(glyph->top < glyph->bottom) {
+            if(glyph->top < top) top = glyph->top;
+            if(glyph->bottom > bottom) bottom = glyph->bottom;
+        }
+        x += ZhBlit_Glyph(glyph, x, y, style);
+    }
+    EndDraw(surface, start, x, y, top, bottom);
+    return x;
+}
+
+int ZhSurface_DrawTextLine(ZhSurface* surface, const ZhText* text, int line, int x, int y, const ZhBlitStyle* style)
+{
+    if(line < 0 || line >= text->lineCount) {
+        return x;
+    }
+    BeginDraw(surface);
+    const int start = x;
+    int top = ZHGLYPH_MAX_ROWS;
+    int bottom = 0;
+    const ZhTextLine* l = &text->lines[line];
+    const int end = l->first + l->count;
+    for(int i = l->first; i < end && x < surface->clipX1; i++) {
+        const ZhGlyph* glyph = ZhText_Glyph(text, i);
+        if(glyph->top < glyph->bottom) {
+            if(glyph->top < top) top = glyph->top;
+            if(glyph->bottom > bottom) bottom = glyph->bottom;
+        }
+        x += ZhBlit_Glyph(glyph, x, y, style);
+    }
+    EndDraw(surface, start, x, y, top, bottom);
+    return x;
+}
+
+void ZhSurface_MarkDirty(ZhSurface* surface, int x, int y, int w, int h)
+{
+    AddDirty(surface, x, y, x + w, y + h);
+}
+
+int ZhSurface_Flip(ZhSurface* surface)
+{
+    if(surface->dirtyCount == 0) {
+        return 0;
+    }
+
+    REG_DISPCNT ^= BACKBUFFER;
+
+    // 新的前台页是刚画好的一页，把本帧的变化复制到新的后台页
+    const u32 front = (REG_DISPCNT & BACKBUFFER) ? surface->pages[1] : surface->pages[0];
+    const u32 back = ZhSurface_BackBuffer(surface);
+    const int rowBytes = RowBytes(surface);
+    const int shift = surface->format == ZHBLIT_FORMAT_8BPP ? 0 : 1;
+
+    for(int i = 0; i < surface->dirtyCount; i++) {
+        const ZhSurfaceRect* r = &surface->dirty[i];
+        const int bx0 = (r->x << shift) & ~3;
+        const int bx1 = (((r->x + r->w) << shift) + 3) & ~3;
+        const u32 offset = (u32)(r->y * rowBytes + bx0);
+
+        int rows = r->h;
+        int words = (bx1 - bx0) >> 2;
+        if(bx0 == 0 && bx1 == rowBytes) {
+            // 整行宽：各行连续，一次复制
+            words *= rows;
+            rows = 1;
+        }
+        for(int row = 0; row < rows; row++) {
+            const u32 rowOffset = offset + (u32)(row * rowBytes);
+            REG_DMA3CNT = 0;
+            REG_DMA3SAD = front + rowOffset;
+            REG_DMA3DAD = back + rowOffset;
+            REG_DMA3CNT = (u32)(DMA_ENABLE | DMA32 | DMA_IMMEDIATE | DMA_SRC_INC | DMA_DST_INC | words);
+        }
+        surface->bytesSynced += (u32)(rows * words * 4);
+    }
+
+    surface->dirtyCount = 0;
+    return 1;
+}
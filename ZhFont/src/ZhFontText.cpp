@@ -0,0 +1,42 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 预编码文本
+说明：预编码字符串（字形索引流 + 子集字库）在 Mode 3 帧缓冲上的绘制
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：单字绘制经 ZhFontBlit（按 32 位写入，遵守其裁剪矩形）；图块画布版本见 ZhFontTile.cpp
+------------------------------------------------------------------------*/
+
+#include "ZhFontText.h"
+#include "ZhFontBlit.h"
+
+#define ZHTEXT_SCREEN_WIDTH 240
+
+int ZhText_DrawGlyphMode3(const ZhGlyph* glyph, int x, int y, u16 color)
+{
+    ZhBlitStyle style;
+    style.color = color;
+    style.effectColor = 0;
+    style.effect = ZHBLIT_PLAIN;
+    return ZhBlit_Glyph(glyph, x, y, &style);
+}
+
+int ZhText_DrawLineMode3(const ZhText* text, int line, int x, int y, u16 color)
+{
+    if(line < 0 || line >= text->lineCount) {
+        return x;
+    }
+    const ZhTextLine* l = &text->lines[line];
+    const int end = l->first + l->count;
+    for(int i = l->first; i < end && x < ZHTEXT_SCREEN_WIDTH; i++) {
+        x += ZhText_DrawGlyphMode3(ZhText_Glyph(text, i), x, y, color);
+    }
+    return x;
+}
+
+void ZhText_DrawMode3(const ZhText* text, int x, int y, int lineHeight, u16 color)
+{
+    for(int line = 0; line < text->lineCount; line++) {
+        ZhText_DrawLineMode3(text, line, x, y + line * lineHeight, color);
+    }
+}
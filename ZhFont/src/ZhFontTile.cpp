@@ -0,0 +1,281 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 图块模式文本
+说明：4bpp 文本画布的字形栅格化、清除与 BG / OBJ 映射
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：4bpp 图块一行 8 像素正好是一个 u32（低半字节为最左像素），字形行按 8 像素一组查表展开成掩码后读改写
+      字形经 ZhFontCache 取得（预编码文本直接取子集字库），只处理非空行
+------------------------------------------------------------------------*/
+
+#include "ZhFontTile.h"
+#include "ZhFontCache.h"
+#include "ZhFontText.h"
+#include "ZhFontLayout.h"
+
+// 8 位点阵（最高位为最左像素）→ 4bpp 行掩码
+static u32 g_ZhTileExpand[256];
+static bool g_ZhTileExpandReady = false;
+
+static void BuildExpandTable()
+{
+    for(int bits = 0; bits < 256; bits++) {
+        u32 mask = 0;
+        for(int i = 0; i < 8; i++) {
+            if(bits & (0x80 >> i)) {
+                mask |= 0xFu << (i * 4);
+            }
+        }
+        g_ZhTileExpand[bits] = mask;
+    }
+    g_ZhTileExpandReady = true;
+}
+
+/// <summary>
+/// 画布中 (tx, ty) 图块的首行地址。
+/// </summary>
+static inline volatile u32* TileAddress(const ZhTileCanvas* canvas, int tx, int ty)
+{
+    int index;
+    if(canvas->layout == ZHTILE_LAYOUT_OBJ64X32) {
+        index = (((ty >> 2) * (canvas->cols >> 3) + (tx >> 3)) << 5) + ((ty & 3) << 3) + (tx & 7);
+    } else {
+        index = ty * canvas->cols + tx;
+    }
+    return canvas->tiles + index * 8;
+}
+
+void ZhTile_Init(ZhTileCanvas* canvas, u32 charBase, int firstTile, int cols, int rows, int layout)
+{
+    if(!g_ZhTileExpandReady) {
+        BuildExpandTable();
+    }
+
+    canvas->tiles = (volatile u32*)(charBase + (u32)firstTile * 32);
+    canvas->firstTile = (u16)firstTile;
+    canvas->cols = (u8)cols;
+    canvas->rows = (u8)rows;
+    canvas->layout = (u8)layout;
+    canvas->fg = 1;
+    canvas->bg = 0;
+    canvas->reserved = 0;
+    canvas->bytesWritten = 0;
+}
+
+void ZhTile_SetColors(ZhTileCanvas* canvas, int fg, int bg)
+{
+    canvas->fg = (u8)(fg & 15);
+    canvas->bg = (u8)(bg & 15);
+}
+
+void ZhTile_Clear(ZhTileCanvas* canvas)
+{
+    const u32 fill = canvas->bg * 0x11111111u;
+    const int words = canvas->cols * canvas->rows * 8;
+    volatile u32* dst = canvas->tiles;
+    for(int i = 0; i < words; i++) {
+        dst[i] = fill;
+    }
+    canvas->bytesWritten += (u32)words * 4;
+}
+
+void ZhTile_ClearRect(ZhTileCanvas* canvas, int x, int y, int w, int h)
+{
+    int x0 = x;
+    int y0 = y;
+    int x1 = x + w;
+    int y1 = y + h;
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 > canvas->cols * 8) x1 = canvas->cols * 8;
+    if(y1 > canvas->rows * 8) y1 = canvas->rows * 8;
+    if(x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    const u32 fill = canvas->bg * 0x11111111u;
+    for(int tx = x0 >> 3; tx <= (x1 - 1) >> 3; tx++) {
+        // 该图块列内被覆盖的像素区间 [a, b)
+        const int a = (tx << 3) < x0 ? (x0 & 7) : 0;
+        const int b = ((tx << 3) + 8) > x1 ? (x1 & 7) : 8;
+        const u32 mask = (0xFFFFFFFFu >> ((8 - (b - a)) * 4)) << (a * 4);
+
+        for(int py = y0; py < y1; py++) {
+            volatile u32* row = TileAddress(canvas, tx, py >> 3) + (py & 7);
+            *row = (*row & ~mask) | (fill & mask);
+        }
+        canvas->bytesWritten += (u32)(y1 - y0) * 4;
+    }
+}
+
+/// <summary>
+/// 把已解码的字形写入画布。
+/// </summary>
+static void DrawCachedGlyph(ZhTileCanvas* canvas, const ZhGlyph* glyph, int x, int y)
+{
+    const int advance = glyph->advance;
+    const int width = canvas->cols * 8;
+    const int height = canvas->rows * 8;
+    if(glyph->top == glyph->bottom || x >= width || y >= height || x + advance <= 0 || y + glyph->bottom <= 0) {
+        return;
+    }
+
+    const u32 fill = canvas->fg * 0x11111111u;
+    const int tx0 = x >> 3;
+    const int shift = x & 7;
+    const int columns = ((x + advance - 1) >> 3) - tx0 + 1;
+    u32 written = 0;
+
+    for(int r = glyph->top; r < glyph->bottom; r++) {
+        const int py = y + r;
+        if(py < 0 || py >= height) {
+            continue;
+        }
+
+        // 最高位对齐到 tx0 图块的最左像素
+        const u32 bits = ((u32)glyph->rows[r] << 16) >> shift;
+        if(bits == 0) {
+            continue;
+        }
+
+        for(int k = 0; k < columns; k++) {
+            const int tx = tx0 + k;
+            const u32 byte = (bits >> (24 - k * 8)) & 0xFF;
+            if(byte == 0 || tx < 0 || tx >= canvas->cols) {
+                continue;
+            }
+            const u32 mask = g_ZhTileExpand[byte];
+            volatile u32* row = TileAddress(canvas, tx, py >> 3) + (py & 7);
+            *row = (*row & ~mask) | (fill & mask);
+            written += 4;
+        }
+    }
+
+    canvas->bytesWritten += written;
+}
+
+int ZhTile_DrawGlyph(ZhTileCanvas* canvas, u16 code, int x, int y)
+{
+    const ZhGlyph* glyph = ZhCache_LookupCode(code);
+    DrawCachedGlyph(canvas, glyph, x, y);
+    return glyph->advance;
+}
+
+int ZhTile_DrawDecodedGlyph(ZhTileCanvas* canvas, const ZhGlyph* glyph, int x, int y)
+{
+    DrawCachedGlyph(canvas, glyph, x, y);
+    return glyph->advance;
+}
+
+int ZhTile_DrawGb2312(ZhTileCanvas* canvas, const char* gb2312, int x, int y)
+{
+    const char* p = gb2312;
+    const int width = canvas->cols * 8;
+    while(x < width) {
+        const ZhGlyph* glyph = ZhCache_NextGb2312(&p);
+        if(glyph == 0 || glyph->code == '\n') {
+            break;
+        }
+        DrawCachedGlyph(canvas, glyph, x, y);
+        x += glyph->advance;
+    }
+    return x;
+}
+
+int ZhTile_DrawUtf8(ZhTileCanvas* canvas, const char* utf8, int x, int y)
+{
+    const char* p = utf8;
+    const int width = canvas->cols * 8;
+    while(x < width) {
+        const ZhGlyph* glyph = ZhCache_NextUtf8(&p);
+        if(glyph == 0 || glyph->code == '\n') {
+            break;
+        }
+        DrawCachedGlyph(canvas, glyph, x, y);
+        x += glyph->advance;
+    }
+    return x;
+}
+
+int ZhTile_DrawUtf8Span(ZhTileCanvas* canvas, const char* utf8, int bytes, int x, int y)
+{
+    const char* p = utf8;
+    const char* end = utf8 + bytes;
+    const int width = canvas->cols * 8;
+    while(p < end && x < width) {
+        const ZhGlyph* glyph = ZhCache_NextUtf8(&p);
+        if(glyph == 0) {
+            break;
+        }
+        DrawCachedGlyph(canvas, glyph, x, y);
+        x += glyph->advance;
+    }
+    return x;
+}
+
+int ZhTile_DrawTextLine(ZhTileCanvas* canvas, const ZhText* text, int line, int x, int y)
+{
+    if(line < 0 || line >= text->lineCount) {
+        return x;
+    }
+    const ZhTextLine* l = &text->lines[line];
+    const int width = canvas->cols * 8;
+    const int end = l->first + l->count;
+    for(int i = l->first; i < end && x < width; i++) {
+        const ZhGlyph* glyph = ZhText_Glyph(text, i);
+        DrawCachedGlyph(canvas, glyph, x, y);
+        x += glyph->advance;
+    }
+    return x;
+}
+
+void ZhTile_DrawText(ZhTileCanvas* canvas, const ZhText* text, int x, int y, int lineHeight)
+{
+    for(int line = 0; line < text->lineCount; line++) {
+        ZhTile_DrawTextLine(canvas, text, line, x, y + line * lineHeight);
+    }
+}
+
+void ZhTile_DrawLayoutPage(ZhTileCanvas* canvas, const ZhLayout* layout, int page, int x, int y, int lineHeight)
+{
+    if(page < 0 || page >= layout->pageCount) {
+        return;
+    }
+    for(int i = layout->pageFirstLine[page]; i < layout->pageFirstLine[page + 1]; i++) {
+        const ZhLayoutLine* line = &layout->lines[i];
+        ZhTile_DrawUtf8Span(canvas, layout->text + line->offset, line->length, x, y);
+        y += lineHeight;
+    }
+}
+
+void ZhTile_MapToBg(const ZhTileCanvas* canvas, volatile u16* map, int mapX, int mapY, int paletteBank)
+{
+    const u16 bank = (u16)((paletteBank & 15) << 12);
+    for(int ty = 0; ty < canvas->rows; ty++) {
+        volatile u16* dst = map + (mapY + ty) * 32 + mapX;
+        const int base = canvas->firstTile + ty * canvas->cols;
+        for(int tx = 0; tx < canvas->cols; tx++) {
+            dst[tx] = (u16)(((base + tx) & 0x03FF) | bank);
+        }
+    }
+}
+
+int ZhTile_WriteObjAttrs(const ZhTileCanvas* canvas, u16* oam, int x, int y, int paletteBank, int priority)
+{
+    const int objCols = canvas->cols >> 3;
+    const int objRows = canvas->rows >> 2;
+    const u16 attr2Flags = (u16)(((paletteBank & 15) << 12) | ((priority & 3) << 10));
+
+    int count = 0;
+    for(int oy = 0; oy < objRows; oy++) {
+        for(int ox = 0; ox < objCols; ox++) {
+            u16* attr = oam + count * 4;
+            // 横长形状 + 尺寸 3 = 64x32，16 色
+            attr[0] = (u16)(((y + oy * 32) & 0xFF) | 0x4000);
+            attr[1] = (u16)(((x + ox * 64) & 0x1FF) | 0xC000);
+            attr[2] = (u16)(((canvas->firstTile + count * 32) & 0x03FF) | attr2Flags);
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,268 @@
+/*------------------------------------------------------------------------
+名称：ZhFont 打字机
+说明：逐帧推进的文本显示，UTF-8 与预编码两种来源，Mode 3 与图块画布两种目标
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：来源通过操作表接入：只用预编码文本的工程不会链接排版、映射表与 HZK12
+------------------------------------------------------------------------*/
+
+#include "ZhFontType.h"
+#include "ZhFontCache.h"
+#include "ZhFontFace.h"
+#include "ZhFontLayout.h"
+#include "MemOps.h"
+
+/**
+ * @brief 来源操作
+ */
+struct ZhTypeSource
+{
+    /** 第 page 页的行范围 [first, end)；页不存在时返回 false */
+    bool (*pageRange)(const ZhTypewriter* tw, int page, int* first, int* end);
+    /** 把游标放到第 tw->line 行开头 */
+    void (*openLine)(ZhTypewriter* tw);
+    /** 取当前行下一个字形（调用前保证未到行末） */
+    const ZhGlyph* (*nextGlyph)(ZhTypewriter* tw);
+};
+
+// ------------------------------------------------------------------------
+// UTF-8 来源：ZhFontLayout 折行分页，字形经缓存取得；期间临时选中文本框的字体
+// ------------------------------------------------------------------------
+
+static const ZhLayout* Utf8Layout(const ZhTypewriter* tw)
+{
+    const ZhFace* previous = ZhFace_Select(tw->box.face);
+    const ZhLayout* layout = ZhLayout_Get(tw->utf8, tw->box.width, tw->box.linesPerPage);
+    ZhFace_Restore(previous);
+    return layout;
+}
+
+static bool Utf8PageRange(const ZhTypewriter* tw, int page, int* first, int* end)
+{
+    const ZhLayout* layout = Utf8Layout(tw);
+    if(page >= layout->pageCount) {
+        return false;
+    }
+    *first = layout->pageFirstLine[page];
+    *end = layout->pageFirstLine[page + 1];
+    return true;
+}
+
+static void Utf8OpenLine(ZhTypewriter* tw)
+{
+    const ZhLayoutLine* line = &Utf8Layout(tw)->lines[tw->line];
+    tw->cursor = tw->utf8 + line->offset;
+    tw->lineEnd = tw->cursor + line->length;
+}
+
+static const ZhGlyph* Utf8NextGlyph(ZhTypewriter* tw)
+{
+    const ZhFace* previous = ZhFace_Select(tw->box.face);
+    const ZhGlyph* glyph = ZhCache_NextUtf8(&tw->cursor);
+    ZhFace_Restore(previous);
+    if(glyph == 0) {
+        tw->cursor = tw->lineEnd;
+    }
+    return glyph;
+}
+
+static const ZhTypeSource g_ZhTypeUtf8Source = { Utf8PageRange, Utf8OpenLine, Utf8NextGlyph };
+
+// ------------------------------------------------------------------------
+// 预编码来源：构建期的行，每 linesPerPage 行一页
+// ------------------------------------------------------------------------
+
+static bool TextPageRange(const ZhTypewriter* tw, int page, int* first, int* end)
+{
+    const int lines = tw->text->lineCount;
+    const int start = page * tw->box.linesPerPage;
+    if(start >= lines) {
+        return false;
+    }
+    *first = start;
+    *end = start + tw->box.linesPerPage < lines ? start + tw->box.linesPerPage : lines;
+    return true;
+}
+
+static void TextOpenLine(ZhTypewriter* tw)
+{
+    const ZhTextLine* line = &tw->text->lines[tw->line];
+    tw->index = line->first;
+    tw->indexEnd = (u16)(line->first + line->count);
+}
+
+static const ZhGlyph* TextNextGlyph(ZhTypewriter* tw)
+{
+    return ZhText_Glyph(tw->text, tw->index++);
+}
+
+static const ZhTypeSource g_ZhTypeTextSource = { TextPageRange, TextOpenLine, TextNextGlyph };
+
+// ------------------------------------------------------------------------
+
+static inline bool AtLineEnd(const ZhTypewriter* tw)
+{
+    return tw->text != 0 ? tw->index >= tw->indexEnd : tw->cursor >= tw->lineEnd;
+}
+
+/// <summary>
+/// 用背景色清除文本框。
+/// </summary>
+static void ClearBox(const ZhTypeBox* box)
+{
+    if(box->canvas != 0) {
+        ZhTile_ClearRect(box->canvas, box->x, box->y, box->width, box->height);
+        return;
+    }
+
+    int x0 = box->x;
+    int y0 = box->y;
+    int x1 = box->x + box->width;
+    int y1 = box->y + box->height;
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 > 240) x1 = 240;
+    if(y1 > 160) y1 = 160;
+
+    if(x0 >= x1) {
+        return;
+    }
+
+    // 每行一次 VramFill（首尾半字由它处理）
+    u16* fb = (u16*)VRAM;
+    for(int y = y0; y < y1; y++) {
+        VramFill(fb + y * 240 + x0, box->background, (u32)(x1 - x0) * 2);
+    }
+}
+
+/// <summary>
+/// 打开第 page 页：定位首行，必要时清除文本框。
+/// </summary>
+static void OpenPage(ZhTypewriter* tw, int page)
+{
+    int first;
+    int end;
+    if(!tw->source->pageRange(tw, page, &first, &end)) {
+        tw->state = ZHTYPE_DONE;
+        return;
+    }
+
+    tw->page = (u16)page;
+    tw->pageFirstLine = (u16)first;
+    tw->pageLineEnd = (u16)end;
+    tw->line = (u16)first;
+    tw->penX = tw->box.x;
+    tw->frameCount = 0;
+    tw->state = ZHTYPE_TYPING;
+    tw->source->openLine(tw);
+
+    if(tw->box.clearOnPage) {
+        ClearBox(&tw->box);
+    }
+}
+
+/// <summary>
+/// 最多绘制 budget 个字；到页末时切换到 PAGE_END / DONE。
+/// </summary>
+static void Advance(ZhTypewriter* tw, int budget)
+{
+    while(tw->state == ZHTYPE_TYPING) {
+        // 先处理行末（不占预算），这样最后一个字画完的同一帧就能进入页末状态
+        while(AtLineEnd(tw)) {
+            if(tw->line + 1 >= tw->pageLineEnd) {
+                int first;
+                int end;
+                tw->state = tw->source->pageRange(tw, tw->page + 1, &first, &end) ? ZHTYPE_PAGE_END : ZHTYPE_DONE;
+                return;
+            }
+            tw->line++;
+            tw->penX = tw->box.x;
+            tw->source->openLine(tw);
+        }
+
+        if(budget <= 0) {
+            return;
+        }
+
+        const ZhGlyph* glyph = tw->source->nextGlyph(tw);
+        if(glyph == 0) {
+            continue;
+        }
+        const int y = tw->box.y + (tw->line - tw->pageFirstLine) * tw->box.lineHeight;
+        if(tw->box.canvas != 0) {
+            ZhTile_DrawDecodedGlyph(tw->box.canvas, glyph, tw->penX, y);
+        } else {
+            ZhBlitStyle style;
+            style.color = tw->box.color;
+            style.effectColor = tw->box.effectColor;
+            style.effect = tw->box.effect;
+            ZhBlit_Glyph(glyph, tw->penX, y, &style);
+        }
+        tw->penX = (s16)(tw->penX + glyph->advance);
+        tw->revealed++;
+        budget--;
+    }
+}
+
+static void Begin(ZhTypewriter* tw, const ZhTypeSource* source, const ZhTypeBox* box)
+{
+    tw->box = *box;
+    if(tw->box.linesPerPage == 0) {
+        tw->box.linesPerPage = 1;
+    }
+    tw->source = source;
+    tw->revealed = 0;
+    if(tw->glyphsPerStep == 0 || tw->framesPerStep == 0) {
+        tw->glyphsPerStep = 1;
+        tw->framesPerStep = 1;
+    }
+    OpenPage(tw, 0);
+}
+
+void ZhType_Begin(ZhTypewriter* tw, const char* utf8, const ZhTypeBox* box)
+{
+    tw->utf8 = utf8;
+    tw->text = 0;
+    Begin(tw, &g_ZhTypeUtf8Source, box);
+}
+
+void ZhType_BeginText(ZhTypewriter* tw, const ZhText* text, const ZhTypeBox* box)
+{
+    tw->utf8 = 0;
+    tw->text = text;
+    Begin(tw, &g_ZhTypeTextSource, box);
+}
+
+void ZhType_SetSpeed(ZhTypewriter* tw, int glyphsPerStep, int framesPerStep)
+{
+    tw->glyphsPerStep = (u8)(glyphsPerStep < 1 ? 1 : glyphsPerStep);
+    tw->framesPerStep = (u8)(framesPerStep < 1 ? 1 : framesPerStep);
+}
+
+int ZhType_Step(ZhTypewriter* tw)
+{
+    if(tw->state != ZHTYPE_TYPING) {
+        return tw->state;
+    }
+    if(++tw->frameCount < tw->framesPerStep) {
+        return tw->state;
+    }
+    tw->frameCount = 0;
+    Advance(tw, tw->glyphsPerStep);
+    return tw->state;
+}
+
+void ZhType_Skip(ZhTypewriter* tw)
+{
+    Advance(tw, 0x7FFF);
+}
+
+int ZhType_NextPage(ZhTypewriter* tw)
+{
+    if(tw->state != ZHTYPE_PAGE_END) {
+        return 0;
+    }
+    OpenPage(tw, tw->page + 1);
+    return tw->state == ZHTYPE_TYPING;
+}
@@ -0,0 +1,82 @@
+"""生成 Unicode→GB2312 映射表源文件 src/ZhFontGbMap.cpp。
+
+两级页表：高字节查页号（0xFF 为空页），页内按低字节直接取 GB2312 码（0 为无映射），查找为常数时间。
+码表覆盖 HZK12 的全部区位（区 0xA1~0xF7，位 0xA1~0xFE），仅收录 BMP 内码点。
+
+用法：python3 tool/gen_gb2312_map.py
+"""
+
+from pathlib import Path
+
+
+HEADER = """/*------------------------------------------------------------------------
+名称：Unicode→GB2312 映射表
+说明：由 tool/gen_gb2312_map.py 自动生成，按 Unicode 高字节分页的两级页表
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+
+#include <gba.h>
+"""
+
+
+def _collect() -> list[tuple[int, int]]:
+    pairs: dict[int, int] = {}
+    for hi in range(0xA1, 0xF8):
+        for lo in range(0xA1, 0xFF):
+            try:
+                ch = bytes((hi, lo)).decode("gb2312")
+            except UnicodeDecodeError:
+                continue
+            cp = ord(ch)
+            if cp > 0xFFFF or cp < 0x80:
+                continue
+            pairs.setdefault(cp, (hi << 8) | lo)
+    return sorted(pairs.items())
+
+
+def _fmt_array(ctype: str, name: str, values: list[int], digits: int, per_line: int) -> str:
+    lines = [f"extern const {ctype} {name}[] __attribute__((aligned(4))) = {{"]
+    for i in range(0, len(values), per_line):
+        chunk = values[i : i + per_line]
+        lines.append("    " + ", ".join(f"0x{v:0{digits}X}" for v in chunk) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main() -> None:
+    root = Path(__file__).resolve().parent.parent
+    pairs = _collect()
+
+    page_of_high = [0xFF] * 256
+    pages: list[int] = []
+    for cp, gb in pairs:
+        high = cp >> 8
+        if page_of_high[high] == 0xFF:
+            page_of_high[high] = len(pages) // 256
+            pages.extend([0] * 256)
+        pages[page_of_high[high] * 256 + (cp & 0xFF)] = gb
+    page_count = len(pages) // 256
+    if page_count >= 0xFF:
+        raise SystemExit("[gbmap] too many pages")
+
+    parts = [
+        HEADER,
+        f"extern const int g_zhfont_gbmap_count = {len(pairs)};",
+        f"extern const int g_zhfont_gbmap_page_count = {page_count};",
+        "",
+        _fmt_array("u8", "g_zhfont_gbmap_page_index", page_of_high, 2, 16),
+        "",
+        _fmt_array("u16", "g_zhfont_gbmap_pages", pages, 4, 16),
+        "",
+    ]
+
+    out = root / "src" / "ZhFontGbMap.cpp"
+    out.write_text("\n".join(parts), encoding="utf-8")
+    print(f"[gbmap] {len(pairs)} entries in {page_count} pages ({page_count * 512 + 256} bytes) -> {out}")
+
+
+if __name__ == "__main__":
+    main()
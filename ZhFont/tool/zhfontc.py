@@ -0,0 +1,323 @@
+"""字体编译器：把点阵源字体编译成多字号、可变宽、紧排的 ZhFace 字体。
+
+输入为字符集文件（UTF-8 文本，文件中出现的字符即为要编译的字符；# 开头的行为注释），
+也可以用 --table 直接读取 zhtext.py 的字符串表（只取值，不取键名）。
+
+对每个字号生成一个 ZhFace（见 ZhFontFace.h）：
+- 索引：升序排列的 Unicode 码点（2 字节/字）+ 度量（前进宽度、包围盒，4 字节/字）+ 每 16 字一个点阵起始偏移
+- 点阵：只保存包围盒内的像素，每行 width 位、行间不补齐，每字从字节边界开始
+
+点阵来源：
+- 默认取 zhfont.a 的 HZK12 / ASC12（与 zhtext.py 相同的读取与映射规则），12 像素原样使用，更小的字号按源像素中心 OR 池化（保留 1 像素笔画），更大的字号按面积覆盖率重采样；
+- --bdf 字号=文件 可为某个字号指定 BDF 点阵字体（例如 8 / 16 像素的原生点阵），BDF 中没有的字仍回退到重采样。
+
+宽度规则：汉字与全角符号前进宽度等于字号；ASCII 按包围盒宽度 + 1 像素间距（数字等宽，便于 HUD 数值不跳动），
+空格为字号的 1/3；不在字库中的字符不收录，运行时按 missingAdvance（字号）前进。
+
+用法：python3 tool/zhfontc.py chars.txt out/generated_font --name Hud --sizes 8,12,16 [--ascii] [--table] [--bdf 16=unifont.bdf] [--font zhfont.a]
+"""
+
+import argparse
+import math
+from pathlib import Path
+
+from zhtext import CODE_MISSING, GLYPH_HEIGHT, _code_of, _glyph_rows, _load_font, _parse_table
+
+
+HEADER = """/*------------------------------------------------------------------------
+名称：{title}
+说明：由 ZhFont/tool/zhfontc.py 从 {source} 自动生成：{faces}
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+"""
+
+BLOCK_GLYPHS = 16
+MAX_SIZE = 16
+SOURCE_CELL = GLYPH_HEIGHT
+
+
+# ------------------------------------------------------------------------
+# 点阵来源
+# ------------------------------------------------------------------------
+
+class Bitmap:
+    """单字点阵：cell_w x size 的像素网格（行列表，每行为 0/1 列表）与前进宽度。"""
+
+    def __init__(self, pixels: list[list[int]], advance: int):
+        self.pixels = pixels
+        self.advance = advance
+
+
+def _source_pixels(code: int, hzk: bytes, asc: bytes) -> list[list[int]] | None:
+    """zhfont.a 中的 12 行点阵（ASCII 6 列，汉字 12 列）；无点阵返回 None。"""
+    if code == CODE_MISSING:
+        return None
+    rows = _glyph_rows(code, hzk, asc)
+    width = 6 if code < 0x80 else 12
+    return [[(r >> (15 - c)) & 1 for c in range(width)] for r in rows]
+
+
+def _resample(src: list[list[int]], size: int, threshold: float) -> list[list[int]]:
+    """把 12 行点阵缩放到 size 行（宽度等比例）。
+
+    缩小时按源像素中心归入目标像素（OR 池化）：每个源像素恰好落进一个目标像素，1 像素笔画不会丢失也不会变粗；
+    面积覆盖率在缩小时会把 1 像素笔画摊薄到阈值以下（8 像素的 A 变成 F）。
+    放大时按面积覆盖率，覆盖率不低于 threshold 的像素置位。
+    """
+    if size == SOURCE_CELL:
+        return [row[:] for row in src]
+    src_w = len(src[0])
+    scale = SOURCE_CELL / size
+    dst_w = max(1, round(src_w / scale))
+    out = [[0] * dst_w for _ in range(size)]
+    if size < SOURCE_CELL:
+        for sy in range(SOURCE_CELL):
+            y = min(size - 1, int((sy + 0.5) / scale))
+            for sx in range(src_w):
+                if src[sy][sx]:
+                    out[y][min(dst_w - 1, int((sx + 0.5) / scale))] = 1
+        return out
+    for i in range(size):
+        y0, y1 = i * scale, (i + 1) * scale
+        for j in range(dst_w):
+            x0, x1 = j * scale, (j + 1) * scale
+            covered = 0.0
+            for sy in range(int(y0), min(SOURCE_CELL, math.ceil(y1))):
+                hy = min(y1, sy + 1) - max(y0, sy)
+                for sx in range(int(x0), min(src_w, math.ceil(x1))):
+                    if src[sy][sx]:
+                        covered += hy * (min(x1, sx + 1) - max(x0, sx))
+            out[i][j] = 1 if covered >= threshold * scale * scale else 0
+    return out
+
+
+def _parse_bdf(path: Path, size: int) -> dict[int, Bitmap]:
+    """读取 BDF 字体中的 BMP 字符，按 FONT_ASCENT 放到 size 行的字形单元中。"""
+    glyphs: dict[int, Bitmap] = {}
+    ascent = size
+    lines = path.read_text(encoding="latin-1").splitlines()
+    i = 0
+    while i < len(lines):
+        parts = lines[i].split()
+        if parts and parts[0] == "FONT_ASCENT":
+            ascent = int(parts[1])
+        if parts and parts[0] == "STARTCHAR":
+            code = -1
+            advance = 0
+            bbx = (0, 0, 0, 0)
+            bitmap: list[int] = []
+            i += 1
+            while i < len(lines) and lines[i].split()[:1] != ["ENDCHAR"]:
+                p = lines[i].split()
+                if p[0] == "ENCODING":
+                    code = int(p[-1])
+                elif p[0] == "DWIDTH":
+                    advance = int(p[1])
+                elif p[0] == "BBX":
+                    bbx = tuple(int(v) for v in p[1:5])
+                elif p[0] == "BITMAP":
+                    i += 1
+                    while i < len(lines) and lines[i].split()[:1] != ["ENDCHAR"]:
+                        bitmap.append(int(lines[i].strip(), 16))
+                        i += 1
+                    break
+                i += 1
+            w, h, xoff, yoff = bbx
+            if 0 < code <= 0xFFFF:
+                row_bits = ((w + 7) // 8) * 8
+                cell_w = max(advance, xoff + w, 1)
+                pixels = [[0] * cell_w for _ in range(size)]
+                top = ascent - (yoff + h)
+                for r, value in enumerate(bitmap[:h]):
+                    y = top + r
+                    if not 0 <= y < size:
+                        continue
+                    for c in range(w):
+                        if (value >> (row_bits - 1 - c)) & 1 and 0 <= xoff + c < cell_w:
+                            pixels[y][xoff + c] = 1
+                glyphs[code] = Bitmap(pixels, advance)
+        i += 1
+    return glyphs
+
+
+# ------------------------------------------------------------------------
+# 字形
+# ------------------------------------------------------------------------
+
+def _bbox(pixels: list[list[int]]) -> tuple[int, int, int, int] | None:
+    """(x, y, w, h)；空白返回 None。"""
+    ys = [y for y, row in enumerate(pixels) if any(row)]
+    xs = [x for row in pixels for x, v in enumerate(row) if v]
+    if not ys:
+        return None
+    x0, y0 = min(xs), min(ys)
+    return x0, y0, max(xs) - x0 + 1, max(ys) - y0 + 1
+
+
+def _pack(pixels: list[list[int]], box: tuple[int, int, int, int]) -> bytes:
+    x, y, w, h = box
+    bits = [pixels[y + r][x + c] for r in range(h) for c in range(w)]
+    bits += [0] * (-len(bits) % 8)
+    return bytes(int("".join(map(str, bits[i : i + 8])), 2) for i in range(0, len(bits), 8))
+
+
+def _build_face(chars: list[str], size: int, hzk: bytes, asc: bytes, bdf: dict[int, Bitmap], threshold: float):
+    """返回 [(码点, advance, (x, y, w, h) 或 None, 点阵字节)]，按码点升序。"""
+    entries = []
+    digit_width = 0
+    for ch in chars:
+        cp = ord(ch)
+        if cp in bdf:
+            glyph = bdf[cp]
+            pixels, advance = glyph.pixels, glyph.advance
+        else:
+            src = _source_pixels(_code_of(ch), hzk, asc)
+            if src is None:
+                continue
+            pixels = _resample(src, size, threshold)
+            advance = size if cp >= 0x80 else 0
+        pixels = [row[:MAX_SIZE] for row in pixels]
+        box = _bbox(pixels)
+
+        if cp < 0x80 and cp not in bdf:
+            if box is None:
+                advance = max(1, round(size / 3)) if ch == " " else 0
+            else:
+                # 比例宽度：去掉左侧空白，右侧留 1 像素
+                pixels = [row[box[0] :] + [0] * box[0] for row in pixels]
+                box = (0, box[1], box[2], box[3])
+                advance = box[2] + 1
+                if ch.isdigit():
+                    digit_width = max(digit_width, box[2])
+        entries.append([cp, advance, box, pixels])
+
+    # 数字等宽：按最宽的数字居中
+    for e in entries:
+        if chr(e[0]).isdigit() and e[0] < 0x80 and e[2] is not None and e[0] not in bdf:
+            x, y, w, h = e[2]
+            shift = (digit_width - w) // 2
+            e[3] = [[0] * shift + row[: MAX_SIZE - shift] for row in e[3]]
+            e[2] = (shift, y, w, h)
+            e[1] = digit_width + 1
+
+    out = []
+    for cp, advance, box, pixels in sorted(entries):
+        if advance == 0 and box is None:
+            continue
+        if box is not None and (box[0] > 15 or box[1] > 15 or box[0] + box[2] > MAX_SIZE or box[1] + box[3] > MAX_SIZE):
+            raise SystemExit(f"[zhfontc] U+{cp:04X} does not fit a {MAX_SIZE}x{MAX_SIZE} cell")
+        out.append((cp, min(advance, 255), box, _pack(pixels, box) if box else b""))
+    return out
+
+
+def _fmt_bytes(values: bytes, per_line: int = 16) -> list[str]:
+    return ["    " + ", ".join(f"0x{v:02X}" for v in values[i : i + per_line]) + "," for i in range(0, len(values), per_line)]
+
+
+def _read_chars(paths: list[Path], table: bool, ascii_set: bool) -> list[str]:
+    text = ""
+    for path in paths:
+        if table:
+            text += "".join(value for _, value in _parse_table(path))
+        else:
+            text += "".join(line for line in path.read_text(encoding="utf-8").splitlines() if not line.startswith("#"))
+    if ascii_set:
+        text += "".join(chr(c) for c in range(0x20, 0x7F))
+    return sorted({ch for ch in text + " " if ch.isprintable()})
+
+
+def main() -> None:
+    root = Path(__file__).resolve().parent.parent
+    parser = argparse.ArgumentParser(description="ZhFont 字体编译器")
+    parser.add_argument("chars", type=Path, nargs="+", help="字符集文件（UTF-8）")
+    parser.add_argument("out", type=Path, help="输出路径（不含扩展名），生成 .h 与 .cpp")
+    parser.add_argument("--name", required=True, help="符号名前缀，例如 Hud → g_HudFace8 / g_HudFace12")
+    parser.add_argument("--sizes", default="12", help="字号列表（像素，逗号分隔，不超过 16）")
+    parser.add_argument("--ascii", action="store_true", help="额外收录全部可打印 ASCII")
+    parser.add_argument("--table", action="store_true", help="输入为 zhtext.py 字符串表，只取值")
+    parser.add_argument("--bdf", action="append", default=[], metavar="SIZE=FILE", help="为某个字号指定 BDF 点阵来源")
+    parser.add_argument("--threshold", type=float, default=0.4, help="放大重采样的覆盖率阈值（缩小不使用）")
+    parser.add_argument("--font", type=Path, default=root / "zhfont.a", help="提供 12 像素点阵的 zhfont.a")
+    args = parser.parse_args()
+
+    name = args.name
+    sizes = [int(s) for s in args.sizes.split(",") if s.strip()]
+    if not sizes or any(not 4 <= s <= MAX_SIZE for s in sizes):
+        raise SystemExit(f"[zhfontc] sizes must be 4..{MAX_SIZE}")
+    bdf_paths: dict[int, Path] = {}
+    for spec in args.bdf:
+        size, sep, path = spec.partition("=")
+        if not sep:
+            raise SystemExit(f"[zhfontc] --bdf expects SIZE=FILE, got '{spec}'")
+        bdf_paths[int(size)] = Path(path)
+
+    chars = _read_chars(args.chars, args.table, args.ascii)
+    hzk, asc = _load_font(args.font)
+    source = ", ".join(p.name for p in args.chars)
+
+    h_lines = [HEADER.format(title=f"{name} 字体", source=source, faces=", ".join(f"{s} 像素" for s in sizes)), "#pragma once", "", '#include "ZhFontFace.h"', ""]
+    c_lines = [HEADER.format(title=f"{name} 字体", source=source, faces=", ".join(f"{s} 像素" for s in sizes)), f'#include "{args.out.name}.h"', ""]
+    report = []
+
+    for size in sizes:
+        bdf = _parse_bdf(bdf_paths[size], size) if size in bdf_paths else {}
+        glyphs = _build_face(chars, size, hzk, asc, bdf, args.threshold)
+        if len(glyphs) > 0xFFFF:
+            raise SystemExit("[zhfontc] too many glyphs")
+        sym = f"g_{name}Face{size}"
+
+        bitmap = b"".join(g[3] for g in glyphs)
+        blocks = []
+        offset = 0
+        for i, g in enumerate(glyphs):
+            if i % BLOCK_GLYPHS == 0:
+                blocks.append(offset)
+            offset += len(g[3])
+        count = max(len(glyphs), 1)
+
+        c_lines.append(f"// {size} 像素：{len(glyphs)} 字，点阵 {len(bitmap)} 字节")
+        c_lines.append(f"static const u16 {sym}Codes[{count}] = {{")
+        for i in range(0, len(glyphs), 12):
+            c_lines.append("    " + ", ".join(f"0x{g[0]:04X}" for g in glyphs[i : i + 12]) + ",")
+        if not glyphs:
+            c_lines.append("    0,")
+        c_lines.append("};")
+        c_lines.append(f"static const ZhFaceMetric {sym}Metrics[{count}] = {{")
+        for cp, advance, box, _ in glyphs:
+            x, y, w, h = box if box else (0, 0, 0, 0)
+            label = chr(cp) if chr(cp).strip() and chr(cp) != "\\" else f"U+{cp:04X}"
+            c_lines.append(f"    {{ {advance}, 0x{(x << 4) | y:02X}, {w}, {h} }},  // {label}")
+        if not glyphs:
+            c_lines.append("    { 0, 0, 0, 0 },")
+        c_lines.append("};")
+        c_lines.append(f"static const u32 {sym}Blocks[{max(len(blocks), 1)}] = {{")
+        c_lines.append("    " + ", ".join(str(b) for b in blocks or [0]) + ",")
+        c_lines.append("};")
+        c_lines.append(f"static const u8 {sym}Bitmap[{max(len(bitmap), 1)}] = {{")
+        c_lines += _fmt_bytes(bitmap) or ["    0,"]
+        c_lines.append("};")
+        c_lines.append(f"extern const ZhFace {sym} = {{ {sym}Codes, {sym}Metrics, {sym}Blocks, {sym}Bitmap, {len(glyphs)}, {size}, {size} }};")
+        c_lines.append("")
+        h_lines.append(f"/// <summary>")
+        h_lines.append(f"/// {size} 像素字体（{len(glyphs)} 字）。")
+        h_lines.append(f"/// </summary>")
+        h_lines.append(f"extern const ZhFace {sym};")
+        h_lines.append("")
+
+        index = len(glyphs) * 6 + len(blocks) * 4
+        fixed = len(glyphs) * size * 2
+        report.append(f"{size}px {len(glyphs)} glyphs: {len(bitmap)} bytes bitmap + {index} bytes index (fixed 16-bit rows: {fixed} bytes)")
+
+    args.out.parent.mkdir(parents=True, exist_ok=True)
+    args.out.with_suffix(".h").write_text("\n".join(h_lines), encoding="utf-8")
+    args.out.with_suffix(".cpp").write_text("\n".join(c_lines), encoding="utf-8")
+    for line in report:
+        print(f"[zhfontc] {line}")
+    print(f"[zhfontc] -> {args.out}.h/.cpp")
+
+
+if __name__ == "__main__":
+    main()
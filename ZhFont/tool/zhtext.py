@@ -0,0 +1,308 @@
+"""字符串表编译器：把 UTF-8 文本预编码成字形索引流，并生成只含用到字形的子集字库。
+
+输入为字符串表文本文件（UTF-8），每行一条：
+
+    # 注释
+    welcome = 欢迎来到GBA世界，现在你将开始你的冒险。
+    two_lines = 第一行\\n第二行
+
+键名由字母、数字、下划线组成；值中 \\n 为换行，\\\\ 为反斜杠。
+
+输出 <out>.h / <out>.cpp：
+- 子集字库 g_<Name>Font：按字形码排序的已解码字形（ZhGlyph：16 位点阵行、前进宽度、非空行范围）
+- 每条字符串一个 ZhText（字形索引流 + 各行起点/字数/像素宽度），以及 <NAME>_TEXT_<KEY> 枚举与 g_<Name>Texts 表
+
+点阵取自 zhfont.a（解析 ar 归档与 ELF 符号 g_zhfont_hzk12_* / g_zhfont_asc12_*），映射规则与 ZhFontGlyph.cpp 一致：
+ASCII 原值，GB2312 可映射字符为 (区 << 8) | 位，其余为缺字（不绘制，按全角前进）。
+
+用法：python3 tool/zhtext.py strings.txt out/generated_text --name Demo [--wrap 像素宽度] [--font zhfont.a]
+"""
+
+import argparse
+import re
+import struct
+from pathlib import Path
+
+
+HEADER = """/*------------------------------------------------------------------------
+名称：{title}
+说明：由 ZhFont/tool/zhtext.py 从 {source} 自动生成：预编码字符串与子集字库（{glyphs} 个字形）
+作者：Lion
+邮箱：chengbin@3578.cn
+日期：2026-10-19
+备注：请勿手工修改
+------------------------------------------------------------------------*/
+"""
+
+GLYPH_HEIGHT = 12
+ADVANCE_HALF = 6
+ADVANCE_FULL = 12
+CODE_MISSING = 0xFFFF
+
+# 行首禁则：不允许出现在行首的标点（自动折行时连同前一字移到下一行）
+NO_LINE_START = set("，。、；：？！）》」』】〕〉”’…—·,.;:?!)]}%")
+
+
+# ------------------------------------------------------------------------
+# zhfont.a 点阵读取
+# ------------------------------------------------------------------------
+
+def _ar_members(data: bytes):
+    if not data.startswith(b"!<arch>\n"):
+        raise SystemExit("[zhtext] not an ar archive")
+    pos = 8
+    while pos + 60 <= len(data):
+        header = data[pos : pos + 60]
+        size = int(header[48:58].decode().strip())
+        yield data[pos + 60 : pos + 60 + size]
+        pos += 60 + size + (size & 1)
+
+
+def _elf_symbols(obj: bytes) -> dict[str, bytes]:
+    """返回 ELF32 小端目标文件中每个已定义数据符号到其所在节从符号起始处开始的字节。"""
+    if obj[:4] != b"\x7fELF" or obj[4] != 1 or obj[5] != 1:
+        return {}
+    shoff = struct.unpack_from("<I", obj, 0x20)[0]
+    shentsize, shnum = struct.unpack_from("<HH", obj, 0x2E)
+    sections = [struct.unpack_from("<IIIIIIIIII", obj, shoff + i * shentsize) for i in range(shnum)]
+
+    out: dict[str, bytes] = {}
+    for sh in sections:
+        if sh[1] != 2:  # SHT_SYMTAB
+            continue
+        strtab = sections[sh[6]]
+        for off in range(sh[4], sh[4] + sh[5], 16):
+            name_off, value, _size, _info, _other, shndx = struct.unpack_from("<IIIBBH", obj, off)
+            if shndx == 0 or shndx >= shnum:
+                continue
+            start = strtab[4] + name_off
+            name = obj[start : obj.index(b"\0", start)].decode()
+            target = sections[shndx]
+            if target[1] == 8:  # SHT_NOBITS
+                continue
+            out[name] = obj[target[4] + value : target[4] + target[5]]
+    return out
+
+
+def _load_font(path: Path) -> tuple[bytes, bytes]:
+    for member in _ar_members(path.read_bytes()):
+        syms = _elf_symbols(member)
+        if "g_zhfont_hzk12_start" in syms and "g_zhfont_asc12_start" in syms:
+            hzk = syms["g_zhfont_hzk12_start"]
+            asc = syms["g_zhfont_asc12_start"]
+            hzk_len = len(hzk) - len(syms.get("g_zhfont_hzk12_end", b""))
+            asc_len = len(asc) - len(syms.get("g_zhfont_asc12_end", b""))
+            return hzk[:hzk_len], asc[:asc_len]
+    raise SystemExit(f"[zhtext] font symbols not found in {path}")
+
+
+# ------------------------------------------------------------------------
+# 字形
+# ------------------------------------------------------------------------
+
+def _code_of(ch: str) -> int:
+    cp = ord(ch)
+    if cp < 0x80:
+        return cp
+    if cp > 0xFFFF:
+        return CODE_MISSING
+    try:
+        gb = ch.encode("gb2312")
+    except UnicodeEncodeError:
+        return CODE_MISSING
+    return (gb[0] << 8) | gb[1] if len(gb) == 2 else CODE_MISSING
+
+
+def _advance(code: int) -> int:
+    return ADVANCE_HALF if code < 0x80 else ADVANCE_FULL
+
+
+def _glyph_rows(code: int, hzk: bytes, asc: bytes) -> list[int]:
+    rows = [0] * GLYPH_HEIGHT
+    if code < 0x80:
+        if 0x20 < code < 0x7F:
+            src = (code - 0x20) * GLYPH_HEIGHT
+            if src + GLYPH_HEIGHT <= len(asc):
+                rows = [asc[src + r] << 8 for r in range(GLYPH_HEIGHT)]
+        return rows
+    hi, lo = code >> 8, code & 0xFF
+    if code == CODE_MISSING or hi < 0xA1 or lo < 0xA1 or lo > 0xFE:
+        return rows
+    src = ((hi - 0xA1) * 94 + (lo - 0xA1)) * 24
+    if src + 24 <= len(hzk):
+        rows = [(hzk[src + r * 2] << 8) | hzk[src + r * 2 + 1] for r in range(GLYPH_HEIGHT)]
+    return rows
+
+
+def _row_range(rows: list[int]) -> tuple[int, int]:
+    top, bottom = 0, GLYPH_HEIGHT
+    while top < bottom and rows[top] == 0:
+        top += 1
+    while bottom > top and rows[bottom - 1] == 0:
+        bottom -= 1
+    return top, bottom
+
+
+# ------------------------------------------------------------------------
+# 字符串表
+# ------------------------------------------------------------------------
+
+def _parse_table(path: Path) -> list[tuple[str, str]]:
+    entries: list[tuple[str, str]] = []
+    seen: set[str] = set()
+    for lineno, raw in enumerate(path.read_text(encoding="utf-8").splitlines(), 1):
+        line = raw.strip()
+        if not line or line.startswith("#"):
+            continue
+        key, sep, value = line.partition("=")
+        key = key.strip()
+        if not sep or not re.fullmatch(r"[A-Za-z_][A-Za-z0-9_]*", key):
+            raise SystemExit(f"[zhtext] {path}:{lineno}: expected 'key = text'")
+        if key in seen:
+            raise SystemExit(f"[zhtext] {path}:{lineno}: duplicate key '{key}'")
+        seen.add(key)
+        value = re.sub(r"\\(.)", lambda m: "\n" if m.group(1) == "n" else m.group(1), value.strip())
+        entries.append((key, value))
+    return entries
+
+
+def _break_lines(codes: list[int], wrap: int) -> list[list[int]]:
+    """按显式换行拆分；wrap > 0 时再按像素宽度贪心折行（行首禁则标点连同前一字移到下一行）。"""
+    lines: list[list[int]] = [[]]
+    width = 0
+    for code in codes:
+        if code == ord("\n"):
+            lines.append([])
+            width = 0
+            continue
+        adv = _advance(code)
+        cur = lines[-1]
+        if wrap > 0 and cur and width + adv > wrap:
+            # 行首禁则：把上一行最后一个字一起带到新行
+            carry = [cur.pop()] if _no_line_start(code) and len(cur) > 1 else []
+            lines.append(carry)
+            cur = lines[-1]
+            width = sum(_advance(c) for c in carry)
+        cur.append(code)
+        width += adv
+    return lines
+
+
+def _char_of(code: int) -> str:
+    if code < 0x80:
+        return chr(code)
+    if code == CODE_MISSING:
+        return ""
+    return bytes((code >> 8, code & 0xFF)).decode("gb2312", errors="ignore")
+
+
+def _no_line_start(code: int) -> bool:
+    ch = _char_of(code)
+    return ch != "" and ch in NO_LINE_START
+
+
+def _fmt_u16(values: list[int], per_line: int = 16) -> list[str]:
+    return ["    " + ", ".join(f"0x{v:04X}" for v in values[i : i + per_line]) + "," for i in range(0, len(values), per_line)]
+
+
+def main() -> None:
+    root = Path(__file__).resolve().parent.parent
+    parser = argparse.ArgumentParser(description="ZhFont 字符串表编译器")
+    parser.add_argument("table", type=Path, help="字符串表（UTF-8）")
+    parser.add_argument("out", type=Path, help="输出路径（不含扩展名），生成 .h 与 .cpp")
+    parser.add_argument("--name", required=True, help="符号名前缀，例如 Demo → g_DemoFont / g_DemoTexts / DEMO_TEXT_*")
+    parser.add_argument("--wrap", type=int, default=0, help="自动折行宽度（像素），0 为只按 \\n 换行")
+    parser.add_argument("--font", type=Path, default=root / "zhfont.a", help="提供点阵的 zhfont.a")
+    args = parser.parse_args()
+
+    name = args.name
+    prefix = re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+    entries = _parse_table(args.table)
+    hzk, asc = _load_font(args.font)
+
+    # 子集：按字形码排序，保证输出稳定
+    encoded = [(key, [_code_of(ch) for ch in value]) for key, value in entries]
+    used = sorted({c for _, codes in encoded for c in codes if c != ord("\n")})
+    index_of = {code: i for i, code in enumerate(used)}
+    if len(used) > 0xFFFF:
+        raise SystemExit("[zhtext] too many glyphs")
+
+    glyph_lines = []
+    for code in used:
+        rows = _glyph_rows(code, hzk, asc)
+        top, bottom = _row_range(rows)
+        row_text = ", ".join(f"0x{r:04X}" for r in rows)
+        ch = _char_of(code)
+        label = ch if ch.isprintable() and ch.strip() and ch != "\\" else f"0x{code:04X}"
+        glyph_lines.append(f"    {{ {{ {row_text} }}, 0x{code:04X}, {_advance(code)}, {top}, {bottom}, 0 }},  // {label}")
+
+    h_lines = [
+        HEADER.format(title=f"{name} 预编码文本", source=args.table.name, glyphs=len(used)),
+        "#pragma once",
+        "",
+        '#include "ZhFontText.h"',
+        "",
+        "/// <summary>",
+        f"/// {args.table.name} 中的字符串编号。",
+        "/// </summary>",
+        f"enum {name}TextId",
+        "{",
+    ]
+    for i, (key, _) in enumerate(entries):
+        h_lines.append(f"    {prefix}_TEXT_{key.upper()} = {i},")
+    h_lines += [
+        f"    {prefix}_TEXT_COUNT = {len(entries)}",
+        "};",
+        "",
+        f"extern const ZhTextFont g_{name}Font;",
+        f"extern const ZhText g_{name}Texts[{prefix}_TEXT_COUNT];",
+        "",
+    ]
+
+    c_lines = [
+        HEADER.format(title=f"{name} 预编码文本", source=args.table.name, glyphs=len(used)),
+        f'#include "{args.out.name}.h"',
+        "",
+        f"static const ZhGlyph g_{name}FontGlyphs[{max(len(used), 1)}] = {{",
+        *(glyph_lines or ["    { { 0 }, 0, 0, 0, 0, 0 },"]),
+        "};",
+        "",
+        f"extern const ZhTextFont g_{name}Font = {{ g_{name}FontGlyphs, {len(used)}, 0 }};",
+        "",
+    ]
+
+    stream_bytes = 0
+    text_lines = []
+    for key, codes in encoded:
+        lines = _break_lines(codes, args.wrap)
+        stream = [index_of[c] for line in lines for c in line]
+        stream_bytes += len(stream) * 2 + len(lines) * 8
+        c_lines.append(f"// {key}")
+        c_lines.append(f"static const u16 g_{name}Text_{key}[{max(len(stream), 1)}] = {{")
+        c_lines += _fmt_u16(stream) or ["    0,"]
+        c_lines.append("};")
+        c_lines.append(f"static const ZhTextLine g_{name}Lines_{key}[{len(lines)}] = {{")
+        first = 0
+        widths = []
+        for line in lines:
+            width = sum(_advance(c) for c in line)
+            widths.append(width)
+            c_lines.append(f"    {{ {first}, {len(line)}, {width}, 0 }},")
+            first += len(line)
+        c_lines.append("};")
+        c_lines.append("")
+        text_lines.append(f"    {{ &g_{name}Font, g_{name}Text_{key}, g_{name}Lines_{key}, {len(stream)}, {len(lines)}, {max(widths)}, 0 }},")
+
+    c_lines.append(f"extern const ZhText g_{name}Texts[{prefix}_TEXT_COUNT] = {{")
+    c_lines += text_lines
+    c_lines.append("};")
+    c_lines.append("")
+
+    args.out.parent.mkdir(parents=True, exist_ok=True)
+    args.out.with_suffix(".h").write_text("\n".join(h_lines), encoding="utf-8")
+    args.out.with_suffix(".cpp").write_text("\n".join(c_lines), encoding="utf-8")
+    print(f"[zhtext] {len(entries)} strings, {len(used)} glyphs ({len(used) * 40} bytes font, {stream_bytes} bytes text) -> {args.out}.h/.cpp")
+
+
+if __name__ == "__main__":
+    main()